@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Run the stps benchmarks with DuckDB's benchmark runner and write the timings as JSON.
+
+Usage (from the repository root, after `make stps_benchmark` built the runner):
+    python3 scripts/run-benchmarks.py [--pattern REGEX] [--out FILE] [--compare BASELINE.json]
+
+The runner prints one `<benchmark>\t<run>\t<seconds>` line per timed run. Each benchmark
+gets its runs plus min / median / max in the JSON, together with the git commit and the
+thread count, so results of different runs can be compared. With --compare the median of
+every benchmark is printed against the baseline file.
+
+The scenarios use DuckDB's runner rather than a Google Benchmark harness so that they share
+one format with the other .benchmark files under benchmark/. Those files were added together
+with the optimizations they measure; the extension had no benchmarks before them.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+DEFAULT_RUNNER = "build/release/benchmark/benchmark_runner"
+
+
+def git_commit():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "HEAD"], text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def parse_runner_output(path):
+    """Map benchmark name -> {"runs": [...], "error": str or None}."""
+    results = {}
+    with open(path) as f:
+        for line in f:
+            parts = line.rstrip("\n").split("\t")
+            if len(parts) != 3 or parts[0] == "name":
+                continue
+            name, _, timing = parts
+            entry = results.setdefault(name, {"runs": [], "error": None})
+            try:
+                entry["runs"].append(float(timing))
+            except ValueError:
+                entry["error"] = timing
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--runner", default=DEFAULT_RUNNER)
+    parser.add_argument("--pattern", default="benchmark/(fill|gobd|iban|import_folder|inso_account|mask|smart_cast)/.*")
+    parser.add_argument("--out", default="build/benchmark_results.json")
+    parser.add_argument("--threads", type=int, default=None)
+    parser.add_argument("--nruns", type=int, default=None)
+    parser.add_argument("--compare", default=None, help="earlier JSON result to compare medians against")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.runner):
+        sys.exit(f"benchmark runner not found: {args.runner} (build it with `make stps_benchmark`)")
+
+    with tempfile.NamedTemporaryFile(suffix=".tsv", delete=False) as tmp:
+        raw_path = tmp.name
+    command = [args.runner, args.pattern, f"--out={raw_path}", "--disable-timeout"]
+    if args.threads:
+        command.append(f"--threads={args.threads}")
+    if args.nruns:
+        command.append(f"--nruns={args.nruns}")
+    status = subprocess.call(command)
+
+    raw = parse_runner_output(raw_path)
+    os.unlink(raw_path)
+
+    benchmarks = []
+    for name in sorted(raw):
+        entry = raw[name]
+        runs = entry["runs"]
+        benchmarks.append({
+            "name": name,
+            "runs": runs,
+            "min": min(runs) if runs else None,
+            "median": statistics.median(runs) if runs else None,
+            "max": max(runs) if runs else None,
+            "error": entry["error"],
+        })
+
+    result = {
+        "commit": git_commit(),
+        "timestamp": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "threads": args.threads or os.cpu_count(),
+        "runner_exit_code": status,
+        "benchmarks": benchmarks,
+    }
+    os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+    with open(args.out, "w") as f:
+        json.dump(result, f, indent=2)
+    print(f"Wrote {len(benchmarks)} benchmark results to {args.out}")
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = {b["name"]: b for b in json.load(f)["benchmarks"]}
+        for bench in benchmarks:
+            before = baseline.get(bench["name"], {}).get("median")
+            after = bench["median"]
+            if before and after:
+                print(f"{bench['name']}: {before:.3f}s -> {after:.3f}s ({after / before:.2f}x)")
+            else:
+                print(f"{bench['name']}: no comparable result")
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -3,70 +3,30 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
+#include "shared/table_driver.hpp"
 #include <sstream>
 
 namespace duckdb {
 namespace stps {
 
 struct CleanDatabaseBindData : public TableFunctionData {
-    vector<string> empty_tables;
+    vector<CatalogTableInfo> tables;
+    TableDriverOptions options;
 };
 
-struct CleanDatabaseGlobalState : public GlobalTableFunctionState {
-    idx_t current_idx = 0;
-    bool finished = false;
-};
-
-// Helper: escape identifier for SQL
-static string EscapeIdentifier(const string &name) {
-    return "\"" + name + "\"";
-}
-
 static unique_ptr<FunctionData> CleanDatabaseBind(ClientContext &context, TableFunctionBindInput &input,
                                                    vector<LogicalType> &return_types, vector<string> &names) {
     auto result = make_uniq<CleanDatabaseBindData>();
+    result->options = ParallelTableDriver::ParseOptions(input.named_parameters, "stps_clean_database");
 
-    Connection conn(context.db->GetDatabase(context));
-
-    // Get all tables from the database
-    auto tables_result = conn.Query(
-        "SELECT table_name FROM information_schema.tables "
-        "WHERE table_schema = 'main' AND table_type = 'BASE TABLE'"
-    );
-
-    if (tables_result->HasError()) {
-        throw BinderException("Failed to get tables: %s", tables_result->GetError().c_str());
-    }
-
-    vector<string> all_tables;
-    while (true) {
-        auto chunk = tables_result->Fetch();
-        if (!chunk || chunk->size() == 0) break;
-
-        for (idx_t row = 0; row < chunk->size(); row++) {
-            string table_name = chunk->data[0].GetValue(row).ToString();
-            all_tables.push_back(table_name);
-        }
-    }
-
-    // Check each table for emptiness and drop if empty
-    for (const auto &table_name : all_tables) {
-        string count_query = "SELECT COUNT(*) FROM " + EscapeIdentifier(table_name);
-        auto count_result = conn.Query(count_query);
-
-        if (!count_result->HasError()) {
-            auto chunk = count_result->Fetch();
-            if (chunk && chunk->size() > 0) {
-                int64_t count = chunk->data[0].GetValue(0).GetValue<int64_t>();
-                if (count == 0) {
-                    // Table is empty, drop it
-                    string drop_query = "DROP TABLE " + EscapeIdentifier(table_name);
-                    auto drop_result = conn.Query(drop_query);
-                    if (!drop_result->HasError()) {
-                        result->empty_tables.push_back(table_name);
-                    }
-                }
-            }
+    // Tables of the default database's main schema, from the catalog
+    auto default_catalog = DatabaseManager::GetDefaultDatabase(context);
+    for (auto &table : ListTables(context, DEFAULT_SCHEMA)) {
+        if (table.catalog == default_catalog) {
+            result->tables.push_back(std::move(table));
         }
     }
 
@@ -77,34 +37,52 @@ static unique_ptr<FunctionData> CleanDatabaseBind(ClientContext &context, TableF
     return std::move(result);
 }
 
-static unique_ptr<GlobalTableFunctionState> CleanDatabaseInit(ClientContext &context, TableFunctionInitInput &input) {
-    auto state = make_uniq<CleanDatabaseGlobalState>();
-    state->finished = false;
-    return std::move(state);
-}
+// Per-thread state: checks one table and drops it if it is empty
+class CleanDatabaseLocalState : public TableDriverLocalState {
+public:
+    using TableDriverLocalState::TableDriverLocalState;
 
-static void CleanDatabaseFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &bind_data = data_p.bind_data->Cast<CleanDatabaseBindData>();
-    auto &state = data_p.global_state->Cast<CleanDatabaseGlobalState>();
+    void BeginTable(ClientContext &context, const CatalogTableInfo &table_p) override {
+        table = &table_p;
+    }
 
-    if (state.finished) {
-        output.SetCardinality(0);
-        return;
+    bool NextRows(ClientContext &context, DataChunk &output) override {
+        // Storage with no rows at all is empty. Otherwise rows may all be deleted: one row
+        // is enough to tell, no full COUNT(*) scan
+        if (table->estimated_rows != 0) {
+            auto probe_result = session.Query("SELECT 1 FROM " + table->SqlName() + " LIMIT 1");
+            if (probe_result->HasError() || probe_result->RowCount() > 0) {
+                return false;
+            }
+        }
+        // Table is empty, drop it
+        auto drop_result = session.Query("DROP TABLE " + table->SqlName());
+        if (!drop_result->HasError()) {
+            output.SetValue(0, 0, Value(table->name));
+            output.SetCardinality(1);
+        }
+        return false;
     }
 
-    idx_t output_idx = 0;
+private:
+    const CatalogTableInfo *table = nullptr;
+};
 
-    while (output_idx < STANDARD_VECTOR_SIZE && state.current_idx < bind_data.empty_tables.size()) {
-        output.data[0].SetValue(output_idx, Value(bind_data.empty_tables[state.current_idx]));
-        output_idx++;
-        state.current_idx++;
-    }
+static unique_ptr<GlobalTableFunctionState> CleanDatabaseInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<CleanDatabaseBindData>();
+    return make_uniq<ParallelTableDriver>(context, bind_data.tables, bind_data.options);
+}
 
-    if (state.current_idx >= bind_data.empty_tables.size()) {
-        state.finished = true;
-    }
+static unique_ptr<LocalTableFunctionState> CleanDatabaseInitLocal(ExecutionContext &context,
+                                                                  TableFunctionInitInput &input,
+                                                                  GlobalTableFunctionState *global_state) {
+    return make_uniq<CleanDatabaseLocalState>(context.client);
+}
 
-    output.SetCardinality(output_idx);
+// Threads check and drop tables in parallel
+static void CleanDatabaseFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &driver = data_p.global_state->Cast<ParallelTableDriver>();
+    driver.Scan(context, data_p.local_state->Cast<CleanDatabaseLocalState>(), output);
 }
 
 void RegisterCleanDatabaseFunction(ExtensionLoader& loader) {
@@ -113,8 +91,10 @@ void RegisterCleanDatabaseFunction(ExtensionLoader& loader) {
         {},
         CleanDatabaseFunction,
         CleanDatabaseBind,
-        CleanDatabaseInit
+        CleanDatabaseInit,
+        CleanDatabaseInitLocal
     );
+    ParallelTableDriver::AddNamedParameters(clean_database_func);
 
     loader.RegisterFunction(clean_database_func);
 }
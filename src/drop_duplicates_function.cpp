@@ -3,6 +3,8 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include <sstream>
 #include <set>
 
@@ -82,22 +84,17 @@ static unique_ptr<FunctionData> DuplicatesBind(ClientContext &context, TableFunc
         }
     }
 
-    // Create a connection to get table schema
-    Connection conn(context.db->GetDatabase(context));
-
     // Get table columns and types - use escaped table name
-    string schema_query = "SELECT * FROM " + EscapeIdentifier(result->table_name) + " LIMIT 0";
-    auto schema_result = conn.Query(schema_query);
-    if (schema_result->HasError()) {
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, EscapeIdentifier(result->table_name), table, error)) {
         throw BinderException("Table '%s' does not exist or cannot be queried: %s",
-                            result->table_name, schema_result->GetError());
+                            result->table_name, error);
     }
 
     // Store output schema
-    for (idx_t i = 0; i < schema_result->names.size(); i++) {
-        result->output_columns.push_back(schema_result->names[i]);
-        result->output_types.push_back(schema_result->types[i]);
-    }
+    result->output_columns = std::move(table.column_names);
+    result->output_types = std::move(table.column_types);
 
     // Validate check columns exist in table
     if (!result->check_columns.empty()) {
@@ -170,8 +167,8 @@ static unique_ptr<GlobalTableFunctionState> DropDuplicatesInit(ClientContext &co
         query << ") AS __subq WHERE __rn = 1";
     }
 
-    Connection conn(context.db->GetDatabase(context));
-    state->result = conn.Query(query.str());
+    auto session = SessionPool::Acquire(context);
+    state->result = session.Query(query.str());
 
     if (state->result->HasError()) {
         throw InternalException("Failed to deduplicate: %s", state->result->GetError());
@@ -227,8 +224,8 @@ static unique_ptr<GlobalTableFunctionState> ShowDuplicatesInit(ClientContext &co
         query << ") AS __subq WHERE __cnt > 1";
     }
 
-    Connection conn(context.db->GetDatabase(context));
-    state->result = conn.Query(query.str());
+    auto session = SessionPool::Acquire(context);
+    state->result = session.Query(query.str());
 
     if (state->result->HasError()) {
         throw InternalException("Failed to find duplicates: %s", state->result->GetError());
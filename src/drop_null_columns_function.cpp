@@ -3,7 +3,8 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
-#include <unordered_map>
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 
 namespace duckdb {
 namespace stps {
@@ -34,70 +35,56 @@ static unique_ptr<FunctionData> DropNullColumnsBind(ClientContext &context, Tabl
     }
     result->table_name = input.inputs[0].GetValue<string>();
 
-    // Create a connection to run queries
-    Connection conn(context.db->GetDatabase(context));
-
-    // Step 1: Get column types via SELECT * (reliable for types)
-    auto type_query = "SELECT * FROM " + result->table_name + " LIMIT 0";
-    auto type_result = conn.Query(type_query);
-    if (type_result->HasError()) {
+    // Step 1: Get column names and types (definition order)
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, result->table_name, table, error)) {
         throw BinderException("Table '%s' does not exist or cannot be queried: %s",
-                            result->table_name, type_result->GetError());
-    }
-
-    // Build a map: column_name -> LogicalType
-    std::unordered_map<string, LogicalType> type_map;
-    for (idx_t i = 0; i < type_result->names.size(); i++) {
-        type_map[type_result->names[i]] = type_result->types[i];
+                            result->table_name, error);
     }
 
-    // Step 2: Get column order via PRAGMA table_info (guaranteed definition order)
-    auto pragma_query = "PRAGMA table_info('" + result->table_name + "')";
-    auto pragma_result = conn.Query(pragma_query);
-    if (pragma_result->HasError()) {
-        throw BinderException("Failed to get table info: %s", pragma_result->GetError());
-    }
-
-    vector<string> ordered_names;
-    vector<LogicalType> ordered_types;
-
-    while (auto pragma_chunk = pragma_result->Fetch()) {
-        if (!pragma_chunk || pragma_chunk->size() == 0) break;
-        for (idx_t row = 0; row < pragma_chunk->size(); row++) {
-            // PRAGMA table_info returns: cid, name, type, notnull, dflt_value, pk
-            string col_name = pragma_chunk->GetValue(1, row).ToString();
-            ordered_names.push_back(col_name);
-            ordered_types.push_back(type_map[col_name]);
+    // Step 2: Columns whose storage statistics prove they hold no value at all need no
+    // counting; neither does any column of a table without rows
+    vector<idx_t> candidates;
+    if (table.estimated_rows != 0) {
+        for (idx_t i = 0; i < table.column_names.size(); i++) {
+            auto stats = GetColumnStatistics(context, table, i);
+            if (stats && !stats->CanHaveNoNull()) {
+                continue;
+            }
+            candidates.push_back(i);
         }
     }
 
-    // Step 3: Build COUNT query using ordered columns
-    string count_query = "SELECT ";
-    for (idx_t i = 0; i < ordered_names.size(); i++) {
-        if (i > 0) count_query += ", ";
-        count_query += "COUNT(\"" + ordered_names[i] + "\")";
-    }
-    count_query += " FROM " + result->table_name;
+    // Step 3: COUNT the remaining columns and keep the non-null ones (preserving definition order)
+    if (!candidates.empty()) {
+        string count_query = "SELECT ";
+        for (idx_t i = 0; i < candidates.size(); i++) {
+            if (i > 0) count_query += ", ";
+            count_query += "COUNT(\"" + table.column_names[candidates[i]] + "\")";
+        }
+        count_query += " FROM " + result->table_name;
 
-    auto count_result = conn.Query(count_query);
-    if (count_result->HasError()) {
-        throw BinderException("Failed to analyze table columns: %s", count_result->GetError());
-    }
+        auto session = SessionPool::Acquire(context);
+        auto count_result = session.Query(count_query);
+        if (count_result->HasError()) {
+            throw BinderException("Failed to analyze table columns: %s", count_result->GetError());
+        }
 
-    // Step 4: Filter non-null columns (preserving definition order)
-    auto chunk = count_result->Fetch();
-    if (chunk && chunk->size() > 0) {
-        for (idx_t i = 0; i < ordered_names.size(); i++) {
-            auto count_value = chunk->GetValue(i, 0);
-            if (!count_value.IsNull() && count_value.GetValue<int64_t>() > 0) {
-                // This column has at least one non-NULL value
-                result->non_null_columns.push_back(ordered_names[i]);
-                result->column_types.push_back(ordered_types[i]);
+        auto chunk = count_result->Fetch();
+        if (chunk && chunk->size() > 0) {
+            for (idx_t i = 0; i < candidates.size(); i++) {
+                auto count_value = chunk->GetValue(i, 0);
+                if (!count_value.IsNull() && count_value.GetValue<int64_t>() > 0) {
+                    // This column has at least one non-NULL value
+                    result->non_null_columns.push_back(table.column_names[candidates[i]]);
+                    result->column_types.push_back(table.column_types[candidates[i]]);
+                }
             }
         }
     }
 
-    // Step 5: Set output schema
+    // Step 4: Set output schema
     if (result->non_null_columns.empty()) {
         names = {"message"};
         return_types = {LogicalType::VARCHAR};
@@ -123,8 +110,8 @@ static unique_ptr<GlobalTableFunctionState> DropNullColumnsInit(ClientContext &c
         }
 
         auto query = "SELECT " + column_list + " FROM " + bind_data.table_name;
-        Connection conn(context.db->GetDatabase(context));
-        result->result = conn.Query(query);
+        auto session = SessionPool::Acquire(context);
+        result->result = session.Query(query);
 
         if (result->result->HasError()) {
             throw InternalException("Failed to query table: %s", result->result->GetError());
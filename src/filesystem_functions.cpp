@@ -2,6 +2,7 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "path_function.hpp"
 #include "scan_function.hpp"
 #ifdef _WIN32
@@ -22,12 +23,42 @@ struct PathBindData : public TableFunctionData {
     ::stps::PathOptions options;
 };
 
-// Global state for stps_path function
-struct PathGlobalState : public GlobalTableFunctionState {
-    std::vector<::stps::shared::FileInfo> files;
+// Output columns shared by stps_path and stps_scan
+enum FilesystemColumn : column_t {
+    FS_NAME = 0,
+    FS_PATH,
+    FS_TYPE,
+    FS_SIZE,
+    FS_MODIFIED_TIME,
+    FS_EXTENSION,
+    FS_PARENT_DIRECTORY,
+    // stps_scan with content_search only
+    FS_MATCH_LINE,
+    FS_MATCH_OFFSET
+};
+
+// Global state for stps_path / stps_scan: rows stream from a parallel directory walk
+struct FilesystemWalkState : public GlobalTableFunctionState {
+    unique_ptr<::stps::shared::DirectoryWalker> walker;
+    std::vector<::stps::shared::WalkEntry> buffer;
     idx_t position = 0;
+    vector<column_t> column_ids;
 };
 
+// size / modified_time need a stat per entry; name/path/type/extension come from the listing
+static bool NeedsStat(const vector<column_t> &column_ids) {
+    for (auto column_id : column_ids) {
+        if (column_id == FS_SIZE || column_id == FS_MODIFIED_TIME) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t WalkerThreads(ClientContext &context) {
+    return static_cast<size_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+}
+
 // Bind function for stps_path
 static unique_ptr<FunctionData> PathBind(ClientContext &context, TableFunctionBindInput &input,
                                           vector<LogicalType> &return_types, vector<string> &names) {
@@ -102,7 +133,8 @@ static string GetAbsolutePath(const string &path) {
 // Init function for stps_path
 static unique_ptr<GlobalTableFunctionState> PathInit(ClientContext &context, TableFunctionInitInput &input) {
     auto &bind_data = input.bind_data->Cast<PathBindData>();
-    auto result = make_uniq<PathGlobalState>();
+    auto result = make_uniq<FilesystemWalkState>();
+    result->column_ids = input.column_ids;
 
     // Get the file system from context
     auto &fs = FileSystem::GetFileSystem(context);
@@ -111,9 +143,10 @@ static unique_ptr<GlobalTableFunctionState> PathInit(ClientContext &context, Tab
     ::stps::PathOptions options = bind_data.options;
     options.base_path = GetAbsolutePath(options.base_path);
 
-    // Scan the directory
+    // Start the directory walk
     try {
-        result->files = ::stps::PathScanner::ScanPath(fs, options);
+        result->walker = ::stps::PathScanner::StartScan(context, fs, options, NeedsStat(input.column_ids),
+                                                         WalkerThreads(context));
     } catch (const std::exception &e) {
         throw IOException("Error scanning path: " + string(e.what()));
     }
@@ -121,25 +154,81 @@ static unique_ptr<GlobalTableFunctionState> PathInit(ClientContext &context, Tab
     return std::move(result);
 }
 
-// Scan function for stps_path
-static void PathScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &state = data_p.global_state->Cast<PathGlobalState>();
+// Scan function for stps_path and stps_scan: fills only the projected columns
+static void FilesystemWalkScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &state = data_p.global_state->Cast<FilesystemWalkState>();
+    auto &fs = FileSystem::GetFileSystem(context);
 
     idx_t count = 0;
-    idx_t max_count = STANDARD_VECTOR_SIZE;
-
-    while (state.position < state.files.size() && count < max_count) {
-        auto &file = state.files[state.position];
-
-        output.SetValue(0, count, Value(file.name));
-        output.SetValue(1, count, Value(file.path));
-        output.SetValue(2, count, Value(file.type));
-        output.SetValue(3, count, Value::BIGINT(file.size));
-        output.SetValue(4, count, Value::BIGINT(file.modified_time));
-        output.SetValue(5, count, Value(file.extension));
-        output.SetValue(6, count, Value(file.parent_directory));
-
-        state.position++;
+    while (count < STANDARD_VECTOR_SIZE) {
+        if (state.position >= state.buffer.size()) {
+            state.buffer.clear();
+            state.position = 0;
+            bool more;
+            try {
+                more = state.walker->Next(state.buffer, STANDARD_VECTOR_SIZE - count);
+            } catch (const std::exception &e) {
+                throw IOException("Error scanning path: " + string(e.what()));
+            }
+            if (!more) {
+                break;
+            }
+        }
+        auto &entry = state.buffer[state.position++];
+
+        for (idx_t col = 0; col < state.column_ids.size(); col++) {
+            auto &vec = output.data[col];
+            switch (state.column_ids[col]) {
+            case FS_NAME:
+                FlatVector::GetData<string_t>(vec)[count] = StringVector::AddString(vec, entry.name);
+                break;
+            case FS_PATH:
+                FlatVector::GetData<string_t>(vec)[count] = StringVector::AddString(vec, entry.path);
+                break;
+            case FS_TYPE:
+                FlatVector::GetData<string_t>(vec)[count] =
+                    string_t(entry.is_directory ? "directory" : "file");
+                break;
+            case FS_SIZE:
+                // An entry that could not be stat'ed has no known size
+                if (entry.stat_failed && !entry.is_directory) {
+                    FlatVector::SetNull(vec, count, true);
+                } else {
+                    FlatVector::GetData<int64_t>(vec)[count] = entry.size;
+                }
+                break;
+            case FS_MODIFIED_TIME:
+                if (entry.stat_failed) {
+                    FlatVector::SetNull(vec, count, true);
+                } else {
+                    FlatVector::GetData<int64_t>(vec)[count] = entry.modified_time;
+                }
+                break;
+            case FS_EXTENSION:
+                FlatVector::GetData<string_t>(vec)[count] =
+                    StringVector::AddString(vec, ::stps::shared::FileSystemUtils::GetExtension(fs, entry.path));
+                break;
+            case FS_PARENT_DIRECTORY:
+                FlatVector::GetData<string_t>(vec)[count] = StringVector::AddString(
+                    vec, ::stps::shared::FileSystemUtils::GetParentDirectory(fs, entry.path));
+                break;
+            case FS_MATCH_LINE:
+            case FS_MATCH_OFFSET: {
+                int64_t value = state.column_ids[col] == FS_MATCH_LINE ? entry.match_line : entry.match_offset;
+                if (value < 0) {
+                    // Directories are not searched
+                    FlatVector::SetNull(vec, count, true);
+                } else {
+                    FlatVector::GetData<int64_t>(vec)[count] = value;
+                }
+                break;
+            }
+            default:
+                // Row id (e.g. COUNT(*)): nothing to fill
+                FlatVector::SetNull(vec, count, true);
+                break;
+            }
+        }
         count++;
     }
 
@@ -151,12 +240,6 @@ struct ScanBindData : public TableFunctionData {
     ::stps::ScanFunctionOptions options;
 };
 
-// Global state for stps_scan function
-struct ScanGlobalState : public GlobalTableFunctionState {
-    std::vector<::stps::shared::FileInfo> files;
-    idx_t position = 0;
-};
-
 // Bind function for stps_scan
 static unique_ptr<FunctionData> ScanBind(ClientContext &context, TableFunctionBindInput &input,
                                           vector<LogicalType> &return_types, vector<string> &names) {
@@ -189,7 +272,24 @@ static unique_ptr<FunctionData> ScanBind(ClientContext &context, TableFunctionBi
         } else if (kv.first == "max_date") {
             result->options.max_date = kv.second.GetValue<int64_t>();
         } else if (kv.first == "content_search") {
-            result->options.content_search = kv.second.GetValue<string>();
+            // A single pattern or a list of patterns (any of them matches)
+            if (kv.second.IsNull()) {
+                continue;
+            }
+            if (kv.second.type().id() == LogicalTypeId::LIST) {
+                for (auto &pattern : ListValue::GetChildren(kv.second)) {
+                    if (!pattern.IsNull() && !pattern.GetValue<string>().empty()) {
+                        result->options.content_search.push_back(pattern.GetValue<string>());
+                    }
+                }
+            } else {
+                auto pattern = kv.second.GetValue<string>();
+                if (!pattern.empty()) {
+                    result->options.content_search.push_back(pattern);
+                }
+            }
+        } else if (kv.first == "content_ignore_case") {
+            result->options.content_ignore_case = kv.second.GetValue<bool>();
         }
     }
 
@@ -197,6 +297,13 @@ static unique_ptr<FunctionData> ScanBind(ClientContext &context, TableFunctionBi
     names = {"name", "path", "type", "size", "modified_time", "extension", "parent_directory"};
     return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR,
                     LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::VARCHAR, LogicalType::VARCHAR};
+    if (!result->options.content_search.empty()) {
+        // Position of the first match in each file
+        names.push_back("match_line");
+        names.push_back("match_offset");
+        return_types.push_back(LogicalType::BIGINT);
+        return_types.push_back(LogicalType::BIGINT);
+    }
 
     return std::move(result);
 }
@@ -204,7 +311,8 @@ static unique_ptr<FunctionData> ScanBind(ClientContext &context, TableFunctionBi
 // Init function for stps_scan
 static unique_ptr<GlobalTableFunctionState> ScanInit(ClientContext &context, TableFunctionInitInput &input) {
     auto &bind_data = input.bind_data->Cast<ScanBindData>();
-    auto result = make_uniq<ScanGlobalState>();
+    auto result = make_uniq<FilesystemWalkState>();
+    result->column_ids = input.column_ids;
 
     // Get the file system from context
     auto &fs = FileSystem::GetFileSystem(context);
@@ -213,9 +321,10 @@ static unique_ptr<GlobalTableFunctionState> ScanInit(ClientContext &context, Tab
     ::stps::ScanFunctionOptions options = bind_data.options;
     options.base_path = GetAbsolutePath(options.base_path);
 
-    // Scan the directory
+    // Start the directory walk
     try {
-        result->files = ::stps::ScanScanner::ScanPath(fs, options);
+        result->walker = ::stps::ScanScanner::StartScan(context, fs, options, NeedsStat(input.column_ids),
+                                                         WalkerThreads(context));
     } catch (const std::exception &e) {
         throw IOException("Error scanning path: " + string(e.what()));
     }
@@ -223,35 +332,11 @@ static unique_ptr<GlobalTableFunctionState> ScanInit(ClientContext &context, Tab
     return std::move(result);
 }
 
-// Scan function for stps_scan
-static void ScanScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &state = data_p.global_state->Cast<ScanGlobalState>();
-
-    idx_t count = 0;
-    idx_t max_count = STANDARD_VECTOR_SIZE;
-
-    while (state.position < state.files.size() && count < max_count) {
-        auto &file = state.files[state.position];
-
-        output.SetValue(0, count, Value(file.name));
-        output.SetValue(1, count, Value(file.path));
-        output.SetValue(2, count, Value(file.type));
-        output.SetValue(3, count, Value::BIGINT(file.size));
-        output.SetValue(4, count, Value::BIGINT(file.modified_time));
-        output.SetValue(5, count, Value(file.extension));
-        output.SetValue(6, count, Value(file.parent_directory));
-
-        state.position++;
-        count++;
-    }
-
-    output.SetCardinality(count);
-}
-
 // Register filesystem functions
 void RegisterFilesystemFunctions(ExtensionLoader &loader) {
     // Register stps_path table function
-    TableFunction path_func("stps_path", {LogicalType::VARCHAR}, PathScan, PathBind, PathInit);
+    TableFunction path_func("stps_path", {LogicalType::VARCHAR}, FilesystemWalkScan, PathBind, PathInit);
+    path_func.projection_pushdown = true;
     path_func.named_parameters["recursive"] = LogicalType::BOOLEAN;
     path_func.named_parameters["file_type"] = LogicalType::VARCHAR;
     path_func.named_parameters["pattern"] = LogicalType::VARCHAR;
@@ -261,7 +346,8 @@ void RegisterFilesystemFunctions(ExtensionLoader &loader) {
     loader.RegisterFunction(path_func);
 
     // Register stps_scan table function
-    TableFunction scan_func("stps_scan", {LogicalType::VARCHAR}, ScanScan, ScanBind, ScanInit);
+    TableFunction scan_func("stps_scan", {LogicalType::VARCHAR}, FilesystemWalkScan, ScanBind, ScanInit);
+    scan_func.projection_pushdown = true;
     scan_func.named_parameters["recursive"] = LogicalType::BOOLEAN;
     scan_func.named_parameters["file_type"] = LogicalType::VARCHAR;
     scan_func.named_parameters["pattern"] = LogicalType::VARCHAR;
@@ -271,7 +357,8 @@ void RegisterFilesystemFunctions(ExtensionLoader &loader) {
     scan_func.named_parameters["max_size"] = LogicalType::BIGINT;
     scan_func.named_parameters["min_date"] = LogicalType::BIGINT;
     scan_func.named_parameters["max_date"] = LogicalType::BIGINT;
-    scan_func.named_parameters["content_search"] = LogicalType::VARCHAR;
+    scan_func.named_parameters["content_search"] = LogicalType::ANY;
+    scan_func.named_parameters["content_ignore_case"] = LogicalType::BOOLEAN;
 
     loader.RegisterFunction(scan_func);
 }
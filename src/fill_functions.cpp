@@ -1,16 +1,222 @@
 #include "fill_functions.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/planner/expression.hpp"
 
 namespace duckdb {
 namespace stps {
 
+// Fill functions
+//
+// Used as window functions they are evaluated by DuckDB's custom window aggregation: once
+// per partition, window_init copies the argument column and carries the position of the
+// nearest non-NULL value through it in one pass. Each row's result is then a lookup at its
+// frame boundary, instead of a segment tree over the partition as for
+// LAST_VALUE(x IGNORE NULLS). Partitions are evaluated in parallel by the window operator.
+//
+// stps_fill_down(x) is the last non-NULL value of the frame, i.e. LAST_VALUE(x IGNORE NULLS):
+// with the default frame (ORDER BY, up to the current row) the previous value carried down.
+// stps_fill_up(x) is the first non-NULL value of the frame, i.e. FIRST_VALUE(x IGNORE NULLS):
+// the next value carried up with ROWS BETWEEN CURRENT ROW AND UNBOUNDED FOLLOWING.
+
+// Per-partition state of the window evaluation
+struct FillWindowState {
+    // The argument column, in STANDARD_VECTOR_SIZE pieces
+    vector<unique_ptr<Vector>> values;
+    // Row of the last non-NULL value at or before each row (fill_down), or of the first at or
+    // after it (fill_up); DConstants::INVALID_INDEX if there is none
+    vector<idx_t> carry;
+};
+
+struct FillState {
+    // Aggregate result so far (nullptr: no non-NULL value yet)
+    Value *value;
+    FillWindowState *window;
+};
+
+struct FillOperation {
+    template <class STATE>
+    static void Initialize(STATE &state) {
+        state.value = nullptr;
+        state.window = nullptr;
+    }
+
+    template <class STATE>
+    static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+        delete state.value;
+        delete state.window;
+        state.value = nullptr;
+        state.window = nullptr;
+    }
+};
+
+// Keep value as the state's result: fill_down takes every later value, fill_up only the first
+template <bool DOWN>
+static void FillAssign(FillState &state, const Value &value) {
+    if (!state.value) {
+        state.value = new Value(value);
+    } else if (DOWN) {
+        *state.value = value;
+    }
+}
+
+template <bool DOWN>
+static void FillUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, Vector &states,
+                       idx_t count) {
+    auto &input = inputs[0];
+    UnifiedVectorFormat idata;
+    input.ToUnifiedFormat(count, idata);
+    UnifiedVectorFormat sdata;
+    states.ToUnifiedFormat(count, sdata);
+    auto state_ptrs = UnifiedVectorFormat::GetData<FillState *>(sdata);
+    for (idx_t i = 0; i < count; i++) {
+        if (!idata.validity.RowIsValid(idata.sel->get_index(i))) {
+            continue;
+        }
+        auto &state = *state_ptrs[sdata.sel->get_index(i)];
+        if (!DOWN && state.value) {
+            continue;
+        }
+        FillAssign<DOWN>(state, input.GetValue(i));
+    }
+}
+
+// source holds the rows after target's
+template <bool DOWN>
+static void FillCombine(Vector &source, Vector &target, AggregateInputData &aggr_input_data, idx_t count) {
+    auto source_ptrs = FlatVector::GetData<FillState *>(source);
+    auto target_ptrs = FlatVector::GetData<FillState *>(target);
+    for (idx_t i = 0; i < count; i++) {
+        if (source_ptrs[i]->value) {
+            FillAssign<DOWN>(*target_ptrs[i], *source_ptrs[i]->value);
+        }
+    }
+}
+
+static void FillFinalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+                         idx_t offset) {
+    UnifiedVectorFormat sdata;
+    states.ToUnifiedFormat(count, sdata);
+    auto state_ptrs = UnifiedVectorFormat::GetData<FillState *>(sdata);
+    for (idx_t i = 0; i < count; i++) {
+        auto &state = *state_ptrs[sdata.sel->get_index(i)];
+        if (state.value) {
+            result.SetValue(offset + i, *state.value);
+        } else {
+            FlatVector::SetNull(result, offset + i, true);
+        }
+    }
+}
+
+template <bool DOWN>
+static void FillWindowInit(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+                           data_ptr_t g_state) {
+    D_ASSERT(partition.inputs);
+    auto &state = *reinterpret_cast<FillState *>(g_state);
+    state.window = new FillWindowState();
+    auto &window = *state.window;
+    window.carry.resize(partition.count, DConstants::INVALID_INDEX);
+
+    // One pass over the partition: copy the values, carry the last non-NULL row forward
+    ColumnDataScanState scan;
+    partition.inputs->InitializeScan(scan, partition.column_ids);
+    DataChunk chunk;
+    partition.inputs->InitializeScanChunk(scan, chunk);
+    idx_t row = 0;
+    idx_t last_valid = DConstants::INVALID_INDEX;
+    while (partition.inputs->Scan(scan, chunk)) {
+        auto &input = chunk.data[0];
+        auto copy = make_uniq<Vector>(input.GetType(), chunk.size());
+        VectorOperations::Copy(input, *copy, chunk.size(), 0, 0);
+        copy->Flatten(chunk.size());
+        auto &validity = FlatVector::Validity(*copy);
+        for (idx_t i = 0; i < chunk.size(); i++, row++) {
+            if (validity.RowIsValid(i) && partition.filter_mask.RowIsValid(row)) {
+                last_valid = row;
+            }
+            window.carry[row] = last_valid;
+        }
+        window.values.push_back(std::move(copy));
+    }
+    D_ASSERT(row == partition.count);
+    if (DOWN) {
+        return;
+    }
+
+    // fill_up: the first non-NULL row at or after each row, from the end
+    idx_t next_valid = DConstants::INVALID_INDEX;
+    for (idx_t i = partition.count; i-- > 0;) {
+        if (window.carry[i] == i) {
+            next_valid = i;
+        }
+        window.carry[i] = next_valid;
+    }
+}
+
+template <bool DOWN>
+static void FillWindow(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
+                       const_data_ptr_t g_state, data_ptr_t l_state, const SubFrames &frames, Vector &result,
+                       idx_t rid) {
+    auto &window = *reinterpret_cast<const FillState *>(g_state)->window;
+
+    // Frames with EXCLUDE are split into several ascending pieces
+    idx_t found = DConstants::INVALID_INDEX;
+    if (DOWN) {
+        for (idx_t f = frames.size(); f-- > 0 && found == DConstants::INVALID_INDEX;) {
+            auto &frame = frames[f];
+            if (frame.end > frame.start && window.carry[frame.end - 1] != DConstants::INVALID_INDEX &&
+                window.carry[frame.end - 1] >= frame.start) {
+                found = window.carry[frame.end - 1];
+            }
+        }
+    } else {
+        for (idx_t f = 0; f < frames.size() && found == DConstants::INVALID_INDEX; f++) {
+            auto &frame = frames[f];
+            if (frame.end > frame.start && window.carry[frame.start] < frame.end) {
+                found = window.carry[frame.start];
+            }
+        }
+    }
+
+    if (found == DConstants::INVALID_INDEX) {
+        FlatVector::SetNull(result, rid, true);
+        return;
+    }
+    auto &values = *window.values[found / STANDARD_VECTOR_SIZE];
+    auto offset = found % STANDARD_VECTOR_SIZE;
+    VectorOperations::Copy(values, result, offset + 1, offset, rid);
+}
+
+// The result has the argument's type
+static unique_ptr<FunctionData> FillBind(ClientContext &context, AggregateFunction &function,
+                                         vector<unique_ptr<Expression>> &arguments) {
+    function.arguments[0] = arguments[0]->return_type;
+    function.return_type = arguments[0]->return_type;
+    return nullptr;
+}
+
+template <bool DOWN>
+static AggregateFunction GetFillFunction(const string &name) {
+    AggregateFunction function(name, {LogicalType::ANY}, LogicalType::ANY, AggregateFunction::StateSize<FillState>,
+                               AggregateFunction::StateInitialize<FillState, FillOperation>,
+                               FillUpdate<DOWN>, FillCombine<DOWN>, FillFinalize,
+                               FunctionNullHandling::SPECIAL_HANDLING, nullptr, FillBind,
+                               AggregateFunction::StateDestroy<FillState, FillOperation>, nullptr,
+                               FillWindow<DOWN>);
+    function.window_init = FillWindowInit<DOWN>;
+    function.order_dependent = AggregateOrderDependent::ORDER_DEPENDENT;
+    return function;
+}
+
 //===--------------------------------------------------------------------===//
 // Registration
 //===--------------------------------------------------------------------===//
 
 void RegisterFillFunctions(ExtensionLoader &loader) {
-	// Registration happens automatically via WindowExecutorFactory in DuckDB core
-	// The actual implementations are in duckdb/src/function/window/window_value_function.cpp
-	// This function is here for consistency with other registration patterns
+    loader.RegisterFunction(GetFillFunction<true>("stps_fill_down"));
+    loader.RegisterFunction(GetFillFunction<false>("stps_fill_up"));
 }
 
 } // namespace stps
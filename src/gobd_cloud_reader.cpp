@@ -8,10 +8,18 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "../miniz/miniz.h"
+#include <atomic>
 #include <sstream>
 #include <algorithm>
+#include <set>
 #include "shared/archive_utils.hpp"
+#include "shared/string_arena.hpp"
+#include "shared/profiler.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
+#include "shared/schema_union.hpp"
 #include <fstream>
 #include <cstdio>
 #include <cstdlib>
@@ -148,6 +156,83 @@ static std::string ReadFileToString(const std::string &path) {
     return oss.str();
 }
 
+// Extracted archive directory, removed once the last table source reading from it is gone
+struct ExtractedDirectory {
+    explicit ExtractedDirectory(std::string path_p) : path(std::move(path_p)) {}
+    ~ExtractedDirectory() {
+        CleanupDirectory(path);
+    }
+    std::string path;
+};
+
+// Downloaded ZIP archive shared by the table sources of its members. Its bytes stay charged
+// to the load budget until the last member source is gone.
+struct GobdZipArchive {
+    GobdZipArchive(std::string data_p, unique_ptr<GobdLoadReservation> reservation_p)
+        : data(std::move(data_p)), reservation(std::move(reservation_p)) {
+        memset(&zip, 0, sizeof(zip));
+        open = mz_zip_reader_init_mem(&zip, data.data(), data.size(), 0);
+    }
+    ~GobdZipArchive() {
+        if (open) mz_zip_reader_end(&zip);
+    }
+    std::string data;
+    unique_ptr<GobdLoadReservation> reservation;
+    mz_zip_archive zip;
+    bool open = false;
+    std::mutex lock;  // miniz readers are not safe for concurrent extraction
+};
+
+// Table data stored as a member of a downloaded ZIP archive (inflated on load)
+class GobdZipMemberSource : public GobdTableSource {
+public:
+    GobdZipMemberSource(std::shared_ptr<GobdZipArchive> archive_p, int file_index_p)
+        : archive(std::move(archive_p)), file_index(file_index_p) {}
+
+    idx_t SizeHint() const override {
+        std::lock_guard<std::mutex> guard(archive->lock);
+        mz_zip_archive_file_stat file_stat;
+        if (!mz_zip_reader_file_stat(&archive->zip, file_index, &file_stat)) return 0;
+        return static_cast<idx_t>(file_stat.m_uncomp_size);
+    }
+
+    std::string Load() override {
+        std::lock_guard<std::mutex> guard(archive->lock);
+        size_t size = 0;
+        void *data = mz_zip_reader_extract_to_heap(&archive->zip, file_index, &size, 0);
+        if (!data) return "";
+        std::string content(static_cast<char*>(data), size);
+        mz_free(data);
+        return content;
+    }
+
+    bool HoldsBudget() const override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<GobdZipArchive> archive;
+    int file_index;
+};
+
+// Table data downloaded from a WebDAV folder when the import reaches it
+class GobdDownloadSource : public GobdTableSource {
+public:
+    GobdDownloadSource(std::string folder_url_p, std::string filename_p, std::string username_p,
+                       std::string password_p)
+        : folder_url(std::move(folder_url_p)), filename(std::move(filename_p)),
+          username(std::move(username_p)), password(std::move(password_p)) {}
+
+    idx_t SizeHint() const override;
+    std::string Load() override;
+
+private:
+    std::string folder_url;
+    std::string filename;
+    std::string username;
+    std::string password;
+};
+
 // Recursively collect all files in a directory.
 // Returns vector of pairs: (relative_name, full_path).
 static void CollectFiles(const std::string &dir, std::vector<std::pair<std::string, std::string>> &files) {
@@ -187,9 +272,37 @@ static void CollectFiles(const std::string &dir, std::vector<std::pair<std::stri
 #endif
 }
 
-// Read GoBD data from an extracted directory (finds index.xml, parses it, reads CSVs).
+// Path of a table's CSV in an extracted archive: relative to the index.xml directory,
+// falling back to a case-insensitive filename match among all files. Empty if not found.
+static std::string FindExtractedTableFile(const std::string &index_xml_dir, const std::string &url,
+                                          const std::vector<std::pair<std::string, std::string>> &all_files) {
+    std::string csv_path = index_xml_dir;
+#ifdef _WIN32
+    csv_path += "\\" + url;
+#else
+    csv_path += "/" + url;
+#endif
+    if (std::ifstream(csv_path, std::ios::binary).is_open()) {
+        return csv_path;
+    }
+
+    std::string target_lower = url;
+    std::transform(target_lower.begin(), target_lower.end(), target_lower.begin(), ::tolower);
+    for (auto &f : all_files) {
+        std::string lower_name = f.first;
+        std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
+        if (lower_name == target_lower) {
+            return f.second;
+        }
+    }
+    return "";
+}
+
+// Read GoBD data from an extracted directory (finds index.xml, parses it, locates CSVs).
 // Returns GobdImportData ready for ExecuteGobdImportPipeline.
-static GobdImportData ReadGobdFromDirectory(const std::string &dir_path, const std::string &url_for_errors, int32_t read_folder = 0) {
+static GobdImportData ReadGobdFromDirectory(const std::shared_ptr<ExtractedDirectory> &extracted,
+                                            const std::string &url_for_errors, int32_t read_folder = 0) {
+    const std::string &dir_path = extracted->path;
     // Collect all files recursively
     std::vector<std::pair<std::string, std::string>> all_files;
     CollectFiles(dir_path, all_files);
@@ -247,33 +360,11 @@ static GobdImportData ReadGobdFromDirectory(const std::string &dir_path, const s
     GobdImportData import_data;
     import_data.tables = tables;
 
-    // Read each CSV referenced by the tables
+    // Locate each CSV referenced by the tables; it is read when the import reaches it
     for (auto &table : tables) {
-        // Try direct path relative to index.xml directory
-        std::string csv_path = index_xml_dir;
-#ifdef _WIN32
-        csv_path += "\\" + table.url;
-#else
-        csv_path += "/" + table.url;
-#endif
-        std::string csv_content = ReadFileToString(csv_path);
-
-        // Fallback: search by filename (case-insensitive) among all collected files
-        if (csv_content.empty()) {
-            std::string target_lower = table.url;
-            std::transform(target_lower.begin(), target_lower.end(), target_lower.begin(), ::tolower);
-            for (auto &f : all_files) {
-                std::string lower_name = f.first;
-                std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-                if (lower_name == target_lower) {
-                    csv_content = ReadFileToString(f.second);
-                    break;
-                }
-            }
-        }
-
-        if (!csv_content.empty()) {
-            import_data.csv_contents[table.url] = csv_content;
+        std::string csv_path = FindExtractedTableFile(index_xml_dir, table.url, all_files);
+        if (!csv_path.empty()) {
+            import_data.table_sources[table.url] = MakeGobdFileSource(csv_path, extracted);
         }
     }
 
@@ -318,6 +409,7 @@ static bool IsParentEntry(const std::string &entry_href, const std::string &pare
 // Download a file from URL, returns body string. Empty on failure.
 static std::string DownloadFile(const std::string &url, const std::string &username, const std::string &password,
                                 long *http_code_out = nullptr) {
+    ::stps::shared::ScopedTimer timer("gobd_cloud.download");
     CurlHeaders headers;
     BuildAuthHeaders(headers, username, password);
 
@@ -330,6 +422,7 @@ static std::string DownloadFile(const std::string &url, const std::string &usern
     if (body.find("ERROR:") == 0 || http_code >= 400 || body.empty()) {
         return "";
     }
+    timer.AddBytes(body.size());
     return body;
 }
 
@@ -376,6 +469,54 @@ static std::string DownloadFileCaseInsensitive(const std::string &folder_url,
     return "";
 }
 
+// Size of a remote file from a Depth 0 PROPFIND; 0 if it is unknown
+static idx_t RemoteFileSize(const std::string &url, const std::string &username, const std::string &password) {
+    CurlHeaders headers;
+    BuildAuthHeaders(headers, username, password);
+    headers.append("Depth: 0");
+    headers.append("Content-Type: application/xml");
+
+    long http_code = 0;
+    std::string request_url = NormalizeRequestUrl(url);
+    std::string response = curl_propfind(request_url, PROPFIND_BODY_EXTENDED, headers, &http_code);
+    if (response.find("ERROR:") == 0 || http_code >= 400) return 0;
+
+    for (auto &entry : ParsePropfindResponse(response)) {
+        if (!entry.is_collection && entry.content_length > 0) {
+            return static_cast<idx_t>(entry.content_length);
+        }
+    }
+    return 0;
+}
+
+// Download url as a ZIP archive whose bytes are held against the load budget
+static std::shared_ptr<GobdZipArchive> DownloadZipArchive(ClientContext &context, const std::string &url,
+                                                          const std::string &username,
+                                                          const std::string &password) {
+    auto reservation = make_uniq<GobdLoadReservation>(context, GobdLoadBudget::Get(context),
+                                                      RemoteFileSize(url, username, password));
+    std::string zip_data = DownloadFile(url, username, password);
+    if (zip_data.empty()) {
+        throw IOException("Could not download ZIP file from: " + url);
+    }
+    reservation->Resize(zip_data.size());
+
+    auto archive = std::make_shared<GobdZipArchive>(std::move(zip_data), std::move(reservation));
+    if (!archive->open) {
+        throw IOException("Failed to open ZIP archive from: " + url);
+    }
+    return archive;
+}
+
+// A case-insensitive match of the file name is not sized (the download looks it up)
+idx_t GobdDownloadSource::SizeHint() const {
+    return RemoteFileSize(EnsureTrailingSlash(folder_url) + filename, username, password);
+}
+
+std::string GobdDownloadSource::Load() {
+    return DownloadFileCaseInsensitive(folder_url, filename, username, password);
+}
+
 // PROPFIND a folder, return entries
 static std::vector<PropfindEntry> PropfindFolder(const std::string &url, const std::string &username,
                                                   const std::string &password) {
@@ -483,7 +624,10 @@ static std::string DiscoverAndDownloadIndexXml(const std::string &folder_url,
 
 struct GobdCloudReaderBindData : public TableFunctionData {
     std::string csv_content;
+    GobdTable table;
+    GobdCharset charset = GobdCharset::UTF8;
     vector<string> column_names;
+    vector<GobdColumnPlan> plans;
     idx_t column_count;
     char delimiter;
 
@@ -491,10 +635,11 @@ struct GobdCloudReaderBindData : public TableFunctionData {
 };
 
 struct GobdCloudReaderGlobalState : public GlobalTableFunctionState {
-    std::istringstream stream;
+    size_t position = 0;  // Byte offset of the next unread record in csv_content
+    unique_ptr<GobdRecordDecoder> decoder;
+    vector<string_t> fields;
     bool finished = false;
     idx_t column_count = 0;
-    char delimiter = ';';
 
     idx_t MaxThreads() const override { return 1; }
 };
@@ -506,6 +651,7 @@ static unique_ptr<FunctionData> GobdCloudReaderBind(ClientContext &context, Tabl
     std::string folder_url = input.inputs[0].ToString();
     std::string table_name = input.inputs[1].ToString();
     std::string username, password;
+    bool all_varchar = false;
     result->delimiter = ';';
 
     for (auto &kv : input.named_parameters) {
@@ -518,6 +664,8 @@ static unique_ptr<FunctionData> GobdCloudReaderBind(ClientContext &context, Tabl
             if (!delim_str.empty()) {
                 result->delimiter = delim_str[0];
             }
+        } else if (kv.first == "all_varchar") {
+            all_varchar = BooleanValue::Get(kv.second);
         }
     }
 
@@ -561,14 +709,16 @@ static unique_ptr<FunctionData> GobdCloudReaderBind(ClientContext &context, Tabl
         throw IOException("Could not download CSV file: " + EnsureTrailingSlash(index_base_url) + found_table->url);
     }
 
-    // Convert encoding to UTF-8 if needed (GoBD exports are often Windows-1252)
-    result->csv_content = EnsureUtf8(result->csv_content);
+    // Fields are converted to UTF-8 while decoding (GoBD exports are often Windows-1252)
+    result->table = *found_table;
+    result->charset = GobdTableCharset(result->table, &result->csv_content);
 
-    // Build schema - all VARCHAR (matching local reader)
-    for (const auto &col : found_table->columns) {
-        result->column_names.push_back(col.name);
-        names.push_back(col.name);
-        return_types.push_back(LogicalType::VARCHAR);
+    // Build schema - typed from the index (matching local reader)
+    result->plans = PlanGobdColumns(*found_table, all_varchar);
+    for (idx_t i = 0; i < found_table->columns.size(); i++) {
+        result->column_names.push_back(found_table->columns[i].name);
+        names.push_back(found_table->columns[i].name);
+        return_types.push_back(result->plans[i].type);
     }
     result->column_count = result->column_names.size();
 
@@ -579,14 +729,14 @@ static unique_ptr<GlobalTableFunctionState> GobdCloudReaderInit(ClientContext &c
     auto &bind_data = input.bind_data->Cast<GobdCloudReaderBindData>();
     auto result = make_uniq<GobdCloudReaderGlobalState>();
 
-    result->stream = std::istringstream(bind_data.csv_content);
     result->column_count = bind_data.column_count;
-    result->delimiter = bind_data.delimiter;
+    result->decoder = make_uniq<GobdRecordDecoder>(bind_data.table, bind_data.delimiter, bind_data.charset);
 
     return std::move(result);
 }
 
 static void GobdCloudReaderScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<GobdCloudReaderBindData>();
     auto &state = data_p.global_state->Cast<GobdCloudReaderGlobalState>();
 
     if (state.finished) {
@@ -594,36 +744,20 @@ static void GobdCloudReaderScan(ClientContext &context, TableFunctionInput &data
         return;
     }
 
-    idx_t count = 0;
-    string line;
-
-    while (count < STANDARD_VECTOR_SIZE && std::getline(state.stream, line)) {
-        if (line.empty()) continue;
-
-        // Remove trailing \r
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
-        }
-
-        if (line.empty()) continue;
+    auto &arena = ::stps::shared::StringArena::ThreadLocal();
+    auto &content = bind_data.csv_content;
 
-        auto fields = ParseCsvLine(line, state.delimiter);
-
-        for (idx_t col = 0; col < state.column_count; col++) {
-            if (col < fields.size()) {
-                output.SetValue(col, count, Value(fields[col]));
-            } else {
-                output.SetValue(col, count, Value());
-            }
+    idx_t count = 0;
+    while (count < STANDARD_VECTOR_SIZE) {
+        arena.Reset();
+        if (!state.decoder->Next(content.data(), content.size(), state.position, true, arena, state.fields)) {
+            state.finished = true;
+            break;
         }
-
+        WriteGobdFields(output, count, state.fields, bind_data.plans);
         count++;
     }
 
-    if (count == 0 || state.stream.eof()) {
-        state.finished = true;
-    }
-
     output.SetCardinality(count);
 }
 
@@ -631,9 +765,19 @@ static void GobdCloudReaderScan(ClientContext &context, TableFunctionInput &data
 // stps_read_gobd_cloud_folder
 // ============================================================================
 
+// CSV content downloaded from one subfolder
+struct GobdCloudFolderSource {
+    string parent_folder;
+    std::string csv_content;
+    GobdTable table;  // Layout of this subfolder's export
+    GobdCharset charset = GobdCharset::UTF8;
+};
+
 struct GobdCloudFolderBindData : public TableFunctionData {
-    // Materialized rows: parent_folder | child_folder | [data columns...]
-    vector<vector<Value>> all_rows;
+    // Output: parent_folder | child_folder | [data columns...]; rows are split from the
+    // downloaded content during the scan
+    vector<GobdCloudFolderSource> sources;
+    string child_folder;
     vector<string> column_names;
     idx_t data_col_count = 0;
     char delimiter;
@@ -642,7 +786,10 @@ struct GobdCloudFolderBindData : public TableFunctionData {
 };
 
 struct GobdCloudFolderGlobalState : public GlobalTableFunctionState {
-    idx_t current_row = 0;
+    idx_t current_source = 0;
+    size_t position = 0;  // Byte offset of the next unread record in the current source
+    unique_ptr<GobdRecordDecoder> decoder;  // For the current source
+    vector<string_t> fields;
     idx_t MaxThreads() const override { return 1; }
 };
 
@@ -742,34 +889,15 @@ static unique_ptr<FunctionData> GobdCloudFolderBind(ClientContext &context, Tabl
         std::string csv_content = DownloadFileCaseInsensitive(index_base_url, found_table->url, username, password);
         if (csv_content.empty()) continue;
 
-        // Convert encoding to UTF-8 if needed (GoBD exports are often Windows-1252)
-        csv_content = EnsureUtf8(csv_content);
-
-        // Parse CSV lines
-        std::istringstream stream(csv_content);
-        string line;
-        while (std::getline(stream, line)) {
-            if (line.empty()) continue;
-            if (!line.empty() && line.back() == '\r') line.pop_back();
-            if (line.empty()) continue;
-
-            auto fields = ParseCsvLine(line, result->delimiter);
-
-            vector<Value> row;
-            row.push_back(Value(mandant_name));
-            row.push_back(Value(child_folder));
-
-            for (idx_t col = 0; col < result->data_col_count; col++) {
-                if (col < fields.size()) {
-                    row.push_back(Value(fields[col]));
-                } else {
-                    row.push_back(Value());
-                }
-            }
-
-            result->all_rows.push_back(std::move(row));
-        }
+        // Fields are converted to UTF-8 while decoding (GoBD exports are often Windows-1252)
+        GobdCloudFolderSource source;
+        source.parent_folder = mandant_name;
+        source.table = *found_table;
+        source.charset = GobdTableCharset(source.table, &csv_content);
+        source.csv_content = std::move(csv_content);
+        result->sources.push_back(std::move(source));
     }
+    result->child_folder = child_folder;
 
     // If nothing was found, throw a helpful error instead of silently returning empty
     if (!schema_detected) {
@@ -834,13 +962,27 @@ static void GobdCloudFolderScan(ClientContext &context, TableFunctionInput &data
     auto &bind_data = data_p.bind_data->Cast<GobdCloudFolderBindData>();
     auto &state = data_p.global_state->Cast<GobdCloudFolderGlobalState>();
 
+    auto &arena = ::stps::shared::StringArena::ThreadLocal();
+
     idx_t count = 0;
-    while (state.current_row < bind_data.all_rows.size() && count < STANDARD_VECTOR_SIZE) {
-        auto &row = bind_data.all_rows[state.current_row];
-        for (idx_t col = 0; col < row.size() && col < output.ColumnCount(); col++) {
-            output.SetValue(col, count, row[col]);
-        }
-        state.current_row++;
+    while (state.current_source < bind_data.sources.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &source = bind_data.sources[state.current_source];
+        if (!state.decoder) {
+            state.decoder = make_uniq<GobdRecordDecoder>(source.table, bind_data.delimiter, source.charset);
+        }
+        arena.Reset();
+        if (!state.decoder->Next(source.csv_content.data(), source.csv_content.size(), state.position, true, arena,
+                                 state.fields)) {
+            state.current_source++;
+            state.position = 0;
+            state.decoder.reset();
+            continue;
+        }
+        FlatVector::GetData<string_t>(output.data[0])[count] =
+            StringVector::AddString(output.data[0], source.parent_folder);
+        FlatVector::GetData<string_t>(output.data[1])[count] =
+            StringVector::AddString(output.data[1], bind_data.child_folder);
+        WriteCsvFields(output, count, state.fields, 2);
         count++;
     }
 
@@ -925,7 +1067,7 @@ static void GobdListTablesCloudScan(ClientContext &context, TableFunctionInput &
 // ============================================================================
 
 struct GobdSchemaCloudBindData : public TableFunctionData {
-    vector<GobdColumn> columns;
+    GobdTable table;
 };
 
 struct GobdSchemaCloudGlobalState : public GlobalTableFunctionState {
@@ -959,7 +1101,7 @@ static unique_ptr<FunctionData> GobdSchemaCloudBind(ClientContext &context, Tabl
     auto tables = ParseGobdIndexFromString(xml_content);
     for (auto &t : tables) {
         if (t.name == table_name) {
-            result->columns = t.columns;
+            result->table = t;
             break;
         }
     }
@@ -972,6 +1114,10 @@ static unique_ptr<FunctionData> GobdSchemaCloudBind(ClientContext &context, Tabl
     return_types.emplace_back(LogicalType::INTEGER);
     names.emplace_back("column_order");
     return_types.emplace_back(LogicalType::INTEGER);
+    names.emplace_back("primary_key");
+    return_types.emplace_back(LogicalType::BOOLEAN);
+    names.emplace_back("references");
+    return_types.emplace_back(LogicalType::VARCHAR);
 
     return std::move(result);
 }
@@ -985,13 +1131,16 @@ static void GobdSchemaCloudScan(ClientContext &context, TableFunctionInput &data
     auto &state = data_p.global_state->Cast<GobdSchemaCloudGlobalState>();
 
     idx_t count = 0;
-    while (state.offset < bind_data.columns.size() && count < STANDARD_VECTOR_SIZE) {
-        auto &col = bind_data.columns[state.offset];
+    while (state.offset < bind_data.table.columns.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &col = bind_data.table.columns[state.offset];
+        string references = GobdColumnReference(bind_data.table, col);
 
         output.SetValue(0, count, Value(col.name));
         output.SetValue(1, count, Value(col.data_type));
         output.SetValue(2, count, col.accuracy >= 0 ? Value::INTEGER(col.accuracy) : Value());
         output.SetValue(3, count, Value::INTEGER(col.order));
+        output.SetValue(4, count, Value::BOOLEAN(col.primary_key));
+        output.SetValue(5, count, references.empty() ? Value() : Value(references));
 
         state.offset++;
         count++;
@@ -1048,15 +1197,13 @@ static unique_ptr<FunctionData> GobdCloudAllBind(ClientContext &context, TableFu
         throw BinderException("No tables found in GoBD index at: " + folder_url);
     }
 
-    // Build import data: download each CSV
+    // Build import data: each CSV is downloaded when the pipeline reaches its table
     GobdImportData import_data;
     import_data.tables = tables;
 
     for (auto &table : tables) {
-        std::string csv_content = DownloadFileCaseInsensitive(index_base_url, table.url, username, password);
-        if (!csv_content.empty()) {
-            import_data.csv_contents[table.url] = csv_content;
-        }
+        import_data.table_sources[table.url] =
+            make_shared_ptr<GobdDownloadSource>(index_base_url, table.url, username, password);
     }
 
     // Execute shared pipeline
@@ -1135,15 +1282,6 @@ static string CloudEscapeIdentifier(const string &name) {
     return "\"" + escaped + "\"";
 }
 
-static string CloudEscapeStringLiteral(const string &value) {
-    string escaped;
-    for (char c : value) {
-        if (c == '\'') escaped += "''";
-        else escaped += c;
-    }
-    return "'" + escaped + "'";
-}
-
 // Get the last path segment (folder or file name) from a path
 static std::string GetLastSegment(const std::string &path) {
     std::string p = path;
@@ -1182,8 +1320,10 @@ static std::string SecondFolderFromPath(const std::string &path) {
 
 // Extract ALL GoBD folders from a 7z archive (returns folder_name -> import_data pairs)
 static std::vector<std::pair<std::string, GobdImportData>> ReadAllGobdFromDirectory(
-        const std::string &dir_path, const std::string &url_for_errors, bool use_subfolder = false) {
+        const std::shared_ptr<ExtractedDirectory> &extracted, const std::string &url_for_errors,
+        bool use_subfolder = false) {
     std::vector<std::pair<std::string, GobdImportData>> results;
+    const std::string &dir_path = extracted->path;
 
     std::vector<std::pair<std::string, std::string>> all_files;
     CollectFiles(dir_path, all_files);
@@ -1250,29 +1390,9 @@ static std::vector<std::pair<std::string, GobdImportData>> ReadAllGobdFromDirect
         import_data.tables = tables;
 
         for (auto &table : tables) {
-            std::string csv_path = xml_dir;
-#ifdef _WIN32
-            csv_path += "\\" + table.url;
-#else
-            csv_path += "/" + table.url;
-#endif
-            std::string csv_content = ReadFileToString(csv_path);
-
-            if (csv_content.empty()) {
-                std::string target_lower = table.url;
-                std::transform(target_lower.begin(), target_lower.end(), target_lower.begin(), ::tolower);
-                for (auto &f : all_files) {
-                    std::string lower_name = f.first;
-                    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-                    if (lower_name == target_lower) {
-                        csv_content = ReadFileToString(f.second);
-                        break;
-                    }
-                }
-            }
-
-            if (!csv_content.empty()) {
-                import_data.csv_contents[table.url] = csv_content;
+            std::string csv_path = FindExtractedTableFile(xml_dir, table.url, all_files);
+            if (!csv_path.empty()) {
+                import_data.table_sources[table.url] = MakeGobdFileSource(csv_path, extracted);
             }
         }
 
@@ -1285,10 +1405,13 @@ static std::vector<std::pair<std::string, GobdImportData>> ReadAllGobdFromDirect
 // Extract ALL GoBD folders from a single archive URL
 // Returns: vector of (folder_name, GobdImportData) - one per index.xml found
 static std::vector<std::pair<std::string, GobdImportData>> ExtractAllGobdFromArchiveUrl(
+        ClientContext &context,
         const std::string &archive_url,
         const std::string &username,
         const std::string &password,
         bool use_subfolder = false) {
+    // Download plus extraction of the whole archive
+    ::stps::shared::ScopedTimer timer("gobd_cloud.archive");
 
     if (Is7zUrl(archive_url)) {
         // ---- 7z path ----
@@ -1313,31 +1436,21 @@ static std::vector<std::pair<std::string, GobdImportData>> ExtractAllGobdFromArc
         archive_data.clear();
         archive_data.shrink_to_fit();
 
-        std::string extract_dir;
-        std::vector<std::pair<std::string, GobdImportData>> results;
+        std::shared_ptr<ExtractedDirectory> extracted;
         try {
-            extract_dir = Extract7zToDirectory(temp_file);
-            std::remove(temp_file.c_str());
-            results = ReadAllGobdFromDirectory(extract_dir, archive_url, use_subfolder);
-            CleanupDirectory(extract_dir);
+            extracted = std::make_shared<ExtractedDirectory>(Extract7zToDirectory(temp_file));
         } catch (...) {
             std::remove(temp_file.c_str());
-            if (!extract_dir.empty()) CleanupDirectory(extract_dir);
             throw;
         }
-        return results;
+        std::remove(temp_file.c_str());
+        // The directory is removed once the returned table sources are gone
+        return ReadAllGobdFromDirectory(extracted, archive_url, use_subfolder);
     } else {
         // ---- ZIP path ----
-        std::string zip_data = DownloadFile(archive_url, username, password);
-        if (zip_data.empty()) {
-            throw IOException("Could not download ZIP file from: " + archive_url);
-        }
-
-        mz_zip_archive zip_archive;
-        memset(&zip_archive, 0, sizeof(zip_archive));
-        if (!mz_zip_reader_init_mem(&zip_archive, zip_data.data(), zip_data.size(), 0)) {
-            throw IOException("Failed to open ZIP archive from: " + archive_url);
-        }
+        // Members are inflated one at a time when the import reaches them
+        auto archive = DownloadZipArchive(context, archive_url, username, password);
+        mz_zip_archive &zip_archive = archive->zip;
 
         // Find ALL index.xml files
         struct ZipIndexEntry {
@@ -1371,7 +1484,6 @@ static std::vector<std::pair<std::string, GobdImportData>> ExtractAllGobdFromArc
         }
 
         if (zip_index_xmls.empty()) {
-            mz_zip_reader_end(&zip_archive);
             throw IOException("No index.xml found in ZIP archive: " + archive_url);
         }
 
@@ -1408,73 +1520,17 @@ static std::vector<std::pair<std::string, GobdImportData>> ExtractAllGobdFromArc
                     fi = mz_zip_reader_locate_file(&zip_archive, table.url.c_str(), nullptr, 0);
                 }
                 if (fi >= 0) {
-                    size_t csv_size = 0;
-                    void *csv_data = mz_zip_reader_extract_to_heap(&zip_archive, fi, &csv_size, 0);
-                    if (csv_data) {
-                        import_data.csv_contents[table.url] = std::string(static_cast<char*>(csv_data), csv_size);
-                        mz_free(csv_data);
-                    }
+                    import_data.table_sources[table.url] = make_shared_ptr<GobdZipMemberSource>(archive, fi);
                 }
             }
 
             results.push_back({folder_name, std::move(import_data)});
         }
 
-        mz_zip_reader_end(&zip_archive);
         return results;
     }
 }
 
-// Get column names of a table
-static std::vector<std::string> GetTableColumns(Connection &conn, const std::string &schema, const std::string &table) {
-    std::string sql = "SELECT column_name FROM information_schema.columns WHERE table_schema = " +
-                      CloudEscapeStringLiteral(schema) + " AND table_name = " +
-                      CloudEscapeStringLiteral(table) + " ORDER BY ordinal_position";
-    auto result = conn.Query(sql);
-    std::vector<std::string> cols;
-    if (result && result->RowCount() > 0) {
-        for (idx_t i = 0; i < result->RowCount(); i++) {
-            cols.push_back(result->GetValue(0, i).ToString());
-        }
-    }
-    return cols;
-}
-
-// Enrich all tables in a schema with mandantendaten columns (cross join with 1-row mandantendaten)
-static void EnrichWithMandantendaten(Connection &conn, const std::string &schema_name,
-                                      const std::vector<std::string> &table_names) {
-    auto md_cols = GetTableColumns(conn, schema_name, "mandantendaten");
-    if (md_cols.empty()) return;
-
-    std::string escaped_schema = CloudEscapeIdentifier(schema_name);
-
-    for (auto &table_name : table_names) {
-        if (table_name == "mandantendaten") continue;
-
-        auto t_cols = GetTableColumns(conn, schema_name, table_name);
-        if (t_cols.empty()) continue;
-
-        // Build SELECT: mandantendaten cols not already in target table, then all target cols
-        std::set<std::string> t_col_set(t_cols.begin(), t_cols.end());
-        std::string select_list;
-        for (auto &mc : md_cols) {
-            if (t_col_set.count(mc) == 0) {
-                if (!select_list.empty()) select_list += ", ";
-                select_list += "m." + CloudEscapeIdentifier(mc);
-            }
-        }
-        if (select_list.empty()) continue;
-
-        select_list += ", t.*";
-
-        std::string sql = "CREATE OR REPLACE TABLE " + escaped_schema + "." + CloudEscapeIdentifier(table_name) +
-                          " AS SELECT " + select_list +
-                          " FROM " + escaped_schema + ".mandantendaten m, " +
-                          escaped_schema + "." + CloudEscapeIdentifier(table_name) + " t";
-        conn.Query(sql);
-    }
-}
-
 // Escape a string value for use in SQL literals (double single quotes)
 static std::string EscapeSqlString(const std::string &s) {
     std::string result;
@@ -1486,39 +1542,77 @@ static std::string EscapeSqlString(const std::string &s) {
     return result;
 }
 
+// Consolidate one table name into main: the union of its columns over all schemas is planned
+// from the catalog, main.<table> is created with it, and each schema's table is appended in
+// turn with its columns mapped by name and the missing ones NULL (the result of UNION ALL BY
+// NAME, without building the union over all schemas in one query). With folders set, an
+// ordner column with the original folder name comes first.
+static void ConsolidateTableIntoMain(SessionLease &session, const std::string &table_name,
+                                     const std::vector<std::string> &schemas,
+                                     const std::vector<std::string> *folders) {
+    SchemaUnionPlan plan;
+    std::vector<CatalogTableInfo> sources;
+    std::vector<idx_t> source_folders;
+    for (idx_t i = 0; i < schemas.size(); i++) {
+        CatalogTableInfo info;
+        bool found = false;
+        InTransaction(session.Conn(),
+                      [&](ClientContext &context) { found = LookupTable(context, schemas[i], table_name, info); });
+        if (!found) continue;
+        plan.AddSource(info.column_names, info.column_types);
+        sources.push_back(std::move(info));
+        source_folders.push_back(i);
+    }
+    if (sources.empty()) return;
+
+    auto &conn = session.Conn();
+    std::string target = "main." + CloudEscapeIdentifier(table_name);
+    conn.BeginTransaction();
+    std::string sql = "CREATE OR REPLACE TABLE " + target + " (";
+    if (folders) {
+        sql += "ordner VARCHAR, ";
+    }
+    auto result = session.Query(sql + plan.ColumnDefinitions() + ")");
+    for (idx_t i = 0; i < sources.size() && !result->HasError(); i++) {
+        std::string select = "SELECT ";
+        if (folders) {
+            select += "'" + EscapeSqlString((*folders)[source_folders[i]]) + "', ";
+        }
+        select += plan.SelectList(i, sources[i].column_names);
+        result = session.Query("INSERT INTO " + target + " " + select + " FROM " +
+                               CloudEscapeIdentifier(sources[i].schema) + "." + CloudEscapeIdentifier(table_name));
+    }
+    if (result->HasError()) {
+        conn.Rollback();
+        return;
+    }
+    conn.Commit();
+}
+
 // Consolidate all schemas into main WITH an ordner column containing original folder name
 static void ConsolidateIntoMainWithFolderColumn(
-    Connection &conn,
+    SessionLease &session,
     const std::vector<std::tuple<std::string, std::string, std::vector<std::string>>> &schema_folder_tables) {
     // schema_folder_tables: (schema_name, original_folder_name, table_names)
 
-    // Collect table_name -> list of (schema, folder_name)
-    std::map<std::string, std::vector<std::pair<std::string, std::string>>> table_to_schema_folders;
+    // Collect table_name -> schemas and folder names that have it
+    std::map<std::string, std::pair<std::vector<std::string>, std::vector<std::string>>> table_to_schema_folders;
     for (auto &sft : schema_folder_tables) {
         const auto &schema = std::get<0>(sft);
         const auto &folder = std::get<1>(sft);
         for (auto &t : std::get<2>(sft)) {
-            table_to_schema_folders[t].push_back({schema, folder});
+            table_to_schema_folders[t].first.push_back(schema);
+            table_to_schema_folders[t].second.push_back(folder);
         }
     }
 
     for (auto &entry : table_to_schema_folders) {
-        const std::string &table_name = entry.first;
-        const auto &schema_folders = entry.second;
-        if (schema_folders.empty()) continue;
-
-        std::string sql = "CREATE OR REPLACE TABLE main." + CloudEscapeIdentifier(table_name) + " AS ";
-        for (size_t i = 0; i < schema_folders.size(); i++) {
-            if (i > 0) sql += " UNION ALL BY NAME ";
-            sql += "SELECT '" + EscapeSqlString(schema_folders[i].second) + "' AS ordner, * FROM " +
-                   CloudEscapeIdentifier(schema_folders[i].first) + "." + CloudEscapeIdentifier(table_name);
-        }
-        conn.Query(sql);
+        ConsolidateTableIntoMain(session, entry.first, entry.second.first, &entry.second.second);
     }
 }
 
-// Consolidate all schemas into main: for each table name, UNION ALL BY NAME from all schemas
-static void ConsolidateIntoMain(Connection &conn,
+// Consolidate all schemas into main: for each table name, the union by name of all schemas
+static void ConsolidateIntoMain(SessionLease &session,
                                  const std::vector<std::pair<std::string, std::vector<std::string>>> &schema_tables) {
     // Collect table_name -> list of schemas that have it
     std::map<std::string, std::vector<std::string>> table_to_schemas;
@@ -1529,16 +1623,7 @@ static void ConsolidateIntoMain(Connection &conn,
     }
 
     for (auto &entry : table_to_schemas) {
-        const std::string &table_name = entry.first;
-        const std::vector<std::string> &schemas = entry.second;
-        if (schemas.empty()) continue;
-
-        std::string sql = "CREATE OR REPLACE TABLE main." + CloudEscapeIdentifier(table_name) + " AS ";
-        for (size_t i = 0; i < schemas.size(); i++) {
-            if (i > 0) sql += " UNION ALL BY NAME ";
-            sql += "SELECT * FROM " + CloudEscapeIdentifier(schemas[i]) + "." + CloudEscapeIdentifier(table_name);
-        }
-        conn.Query(sql);
+        ConsolidateTableIntoMain(session, entry.first, entry.second, nullptr);
     }
 }
 
@@ -1556,10 +1641,12 @@ static std::string ArchiveUrlToSchemaName(const std::string &url) {
 }
 
 // Helper: download and extract GoBD data from a single archive URL
-static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
+static GobdImportData ExtractGobdFromArchiveUrl(ClientContext &context,
+                                                  const std::string &archive_url,
                                                   const std::string &username,
                                                   const std::string &password,
                                                   int32_t read_folder = 0) {
+    ::stps::shared::ScopedTimer timer("gobd_cloud.archive");
     GobdImportData import_data;
 
     if (Is7zUrl(archive_url)) {
@@ -1591,32 +1678,20 @@ static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
         archive_data.clear();
         archive_data.shrink_to_fit();
 
-        std::string extract_dir;
+        std::shared_ptr<ExtractedDirectory> extracted;
         try {
-            extract_dir = Extract7zToDirectory(temp_file);
-            std::remove(temp_file.c_str());
-            import_data = ReadGobdFromDirectory(extract_dir, archive_url, read_folder);
-            CleanupDirectory(extract_dir);
+            extracted = std::make_shared<ExtractedDirectory>(Extract7zToDirectory(temp_file));
         } catch (...) {
             std::remove(temp_file.c_str());
-            if (!extract_dir.empty()) {
-                CleanupDirectory(extract_dir);
-            }
             throw;
         }
+        std::remove(temp_file.c_str());
+        // The directory is removed once the returned table sources are gone
+        import_data = ReadGobdFromDirectory(extracted, archive_url, read_folder);
     } else {
-        // ---- ZIP path: in-memory extraction with miniz ----
-        std::string zip_data = DownloadFile(archive_url, username, password);
-        if (zip_data.empty()) {
-            throw IOException("Could not download ZIP file from: " + archive_url);
-        }
-
-        mz_zip_archive zip_archive;
-        memset(&zip_archive, 0, sizeof(zip_archive));
-
-        if (!mz_zip_reader_init_mem(&zip_archive, zip_data.data(), zip_data.size(), 0)) {
-            throw IOException("Failed to open ZIP archive from: " + archive_url);
-        }
+        // ---- ZIP path: in-memory extraction with miniz, members inflated on demand ----
+        auto archive = DownloadZipArchive(context, archive_url, username, password);
+        mz_zip_archive &zip_archive = archive->zip;
 
         // Collect ALL index.xml files in the ZIP (case-insensitive)
         struct IndexXmlEntry {
@@ -1652,7 +1727,6 @@ static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
         }
 
         if (index_xmls.empty()) {
-            mz_zip_reader_end(&zip_archive);
             throw IOException("No index.xml found in ZIP archive: " + archive_url);
         }
 
@@ -1664,7 +1738,6 @@ static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
         size_t selected = 0;
         if (read_folder > 0) {
             if (static_cast<size_t>(read_folder) > index_xmls.size()) {
-                mz_zip_reader_end(&zip_archive);
                 throw IOException("read_folder=" + std::to_string(read_folder) +
                                   " but only " + std::to_string(index_xmls.size()) +
                                   " folders with index.xml found in ZIP: " + archive_url);
@@ -1684,14 +1757,12 @@ static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
         }
 
         if (xml_content.empty()) {
-            mz_zip_reader_end(&zip_archive);
             throw IOException("Failed to extract index.xml from ZIP archive: " + archive_url);
         }
 
         xml_content = EnsureUtf8(xml_content);
         auto tables = ParseGobdIndexFromString(xml_content);
         if (tables.empty()) {
-            mz_zip_reader_end(&zip_archive);
             throw BinderException("No tables found in GoBD index within ZIP: " + archive_url);
         }
 
@@ -1704,113 +1775,95 @@ static GobdImportData ExtractGobdFromArchiveUrl(const std::string &archive_url,
                 file_index = mz_zip_reader_locate_file(&zip_archive, table.url.c_str(), nullptr, 0);
             }
             if (file_index >= 0) {
-                size_t file_size = 0;
-                void *file_data = mz_zip_reader_extract_to_heap(&zip_archive, file_index, &file_size, 0);
-                if (file_data) {
-                    import_data.csv_contents[table.url] = std::string(static_cast<char*>(file_data), file_size);
-                    mz_free(file_data);
-                }
+                import_data.table_sources[table.url] = make_shared_ptr<GobdZipMemberSource>(archive, file_index);
             }
         }
-
-        mz_zip_reader_end(&zip_archive);
     }
 
     return import_data;
 }
 
-static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, TableFunctionBindInput &input,
-                                                      vector<LogicalType> &return_types, vector<string> &names) {
-    auto result = make_uniq<GobdCloudZipAllBindData>();
+// One archive of stps_read_gobd_cloud_zip_all
+struct GobdZipArchiveJob {
+    std::string url;
+    std::string schema;  // For a root-level index.xml, and for the folder picked by read_folder
+};
 
-    std::string url = input.inputs[0].ToString();
+struct GobdZipImportBindData : public TableFunctionData {
+    vector<GobdZipArchiveJob> archives;
+    std::set<std::string> reserved_schemas;  // Archive schemas (folder mode)
     std::string username, password;
     char delimiter = ';';
     bool overwrite = false;
     int32_t read_folder = 0;
+    bool single_archive = false;  // url is an archive, not a folder of archives
+    // A single archive with read_folder imports into the default schema, without
+    // Mandantendaten enrichment or consolidation
+    bool default_schema = false;
+};
+
+// Work proceeds archive -> GoBD folder -> table; every imported table is returned as soon
+// as it is done, and the progress bar follows the same hierarchy. A LIMIT (or cancel) stops
+// the scan after the tables returned so far; the destructor then imports the rest and
+// consolidates into main, so the import is always complete. A cancelled query skips the
+// remaining tables, but the ones already imported are still consolidated.
+struct GobdZipImportGlobalState : public GlobalTableFunctionState {
+    GobdZipImportGlobalState(ClientContext &context_p, const GobdZipImportBindData &bind_data_p)
+        : context(context_p), bind_data(bind_data_p) {
+    }
+    ~GobdZipImportGlobalState() override;
+
+    ClientContext &context;
+    GobdZipImportBindData bind_data;  // Copied: the destructor may outlive the bind data
+    idx_t next_archive = 0;
+    bool archive_open = false;
+    bool archive_schema_taken = false;
+    std::vector<std::pair<std::string, GobdImportData>> folders;  // Of the open archive
+    idx_t next_folder = 0;
+    unique_ptr<GobdImportPipeline> pipeline;  // Of the current folder
+    std::string schema;
+    std::vector<std::string> imported_tables;
+    std::set<std::string> used_schemas;
+    std::vector<std::pair<std::string, std::vector<std::string>>> schema_table_list;  // For consolidation
+
+    // Counters for the progress callback, which runs concurrently with the scan and must
+    // not touch the members above
+    std::atomic<idx_t> archives_done {0};
+    std::atomic<idx_t> folders_done {0};
+    std::atomic<idx_t> folders_total {0};  // Of the open archive, 0 if none is open
+    std::atomic<idx_t> tables_done {0};
+    std::atomic<idx_t> tables_total {0};   // Of the current folder
+    std::atomic<bool> finished {false};
+
+    idx_t MaxThreads() const override { return 1; }
+};
+
+static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<GobdZipImportBindData>();
+
+    std::string url = input.inputs[0].ToString();
 
     for (auto &kv : input.named_parameters) {
         if (kv.first == "username") {
-            username = kv.second.ToString();
+            result->username = kv.second.ToString();
         } else if (kv.first == "password") {
-            password = kv.second.ToString();
+            result->password = kv.second.ToString();
         } else if (kv.first == "delimiter") {
             string delim_str = kv.second.ToString();
-            if (!delim_str.empty()) delimiter = delim_str[0];
+            if (!delim_str.empty()) result->delimiter = delim_str[0];
         } else if (kv.first == "overwrite") {
-            overwrite = BooleanValue::Get(kv.second);
+            result->overwrite = BooleanValue::Get(kv.second);
         } else if (kv.first == "read_folder") {
-            read_folder = IntegerValue::Get(kv.second);
+            result->read_folder = IntegerValue::Get(kv.second);
         }
     }
 
+    // Only the archives are listed here; downloads and imports run in the scan
     if (IsArchiveUrl(url)) {
-        if (read_folder > 0) {
-            // ---- Single folder mode: import only the specified folder (backward compat) ----
-            GobdImportData import_data = ExtractGobdFromArchiveUrl(url, username, password, read_folder);
-            result->import_results = ExecuteGobdImportPipeline(context, import_data, delimiter, overwrite);
-        } else {
-            // ---- All folders mode: import every index.xml folder into its own schema ----
-            auto all_folders = ExtractAllGobdFromArchiveUrl(url, username, password);
-            std::string archive_base = ArchiveUrlToSchemaName(url);
-
-            // Deduplicate schema names
-            std::set<std::string> used_schemas;
-            std::vector<std::pair<std::string, std::vector<std::string>>> schema_table_list; // for consolidation
-
-            for (auto &folder_pair : all_folders) {
-                std::string folder_name = folder_pair.first;
-                std::string schema_name = folder_name.empty()
-                    ? archive_base
-                    : ToSnakeCase(folder_name);
-
-                std::string base_schema = schema_name;
-                int suffix = 2;
-                while (used_schemas.count(schema_name)) {
-                    schema_name = base_schema + "_" + std::to_string(suffix++);
-                }
-                used_schemas.insert(schema_name);
-
-                try {
-                    auto archive_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter, overwrite, schema_name);
-
-                    // Collect table names for enrichment + consolidation
-                    std::vector<std::string> table_names;
-                    for (auto &r : archive_results) {
-                        r.archive_url = url;
-                        if (r.error.empty()) {
-                            table_names.push_back(r.table_name);
-                        }
-                    }
-
-                    // Enrich tables with mandantendaten columns
-                    if (!table_names.empty()) {
-                        Connection conn(context.db->GetDatabase(context));
-                        EnrichWithMandantendaten(conn, schema_name, table_names);
-                    }
-
-                    schema_table_list.push_back({schema_name, table_names});
-
-                    result->import_results.insert(result->import_results.end(),
-                                                  archive_results.begin(), archive_results.end());
-                } catch (std::exception &e) {
-                    GobdImportResult err_result;
-                    err_result.schema_name = schema_name;
-                    err_result.table_name = "(folder)";
-                    err_result.rows_imported = 0;
-                    err_result.columns_created = 0;
-                    err_result.archive_url = url;
-                    err_result.error = e.what();
-                    result->import_results.push_back(err_result);
-                }
-            }
-
-            // Consolidate all schemas into main
-            if (!schema_table_list.empty()) {
-                Connection conn(context.db->GetDatabase(context));
-                ConsolidateIntoMain(conn, schema_table_list);
-            }
-        }
+        result->single_archive = true;
+        result->default_schema = result->read_folder > 0;
+        result->archives.push_back({url, ArchiveUrlToSchemaName(url)});
     } else {
         // ---- Folder mode: list folder, find all zip/7z files, create schema per archive ----
 
@@ -1822,7 +1875,7 @@ static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, Tabl
 
         // List folder contents via WebDAV PROPFIND
         CurlHeaders headers;
-        BuildAuthHeaders(headers, username, password);
+        BuildAuthHeaders(headers, result->username, result->password);
         headers.append("Depth: 1");
 
         std::string request_url = NormalizeRequestUrl(folder_url);
@@ -1841,22 +1894,10 @@ static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, Tabl
 
         for (auto &entry : entries) {
             if (entry.is_collection) continue;
-
-            std::string entry_url_lower = entry.href;
-            std::transform(entry_url_lower.begin(), entry_url_lower.end(), entry_url_lower.begin(), ::tolower);
-
-            bool is_archive = (entry_url_lower.size() >= 4 && entry_url_lower.substr(entry_url_lower.size() - 4) == ".zip") ||
-                              (entry_url_lower.size() >= 3 && entry_url_lower.substr(entry_url_lower.size() - 3) == ".7z");
-
-            if (is_archive) {
+            if (IsArchiveUrl(entry.href)) {
                 // Build full URL from href
-                std::string full_url;
-                if (entry.href.find("://") != std::string::npos) {
-                    full_url = entry.href;
-                } else {
-                    full_url = base_url + entry.href;
-                }
-                archive_urls.push_back(full_url);
+                archive_urls.push_back(entry.href.find("://") != std::string::npos ? entry.href
+                                                                                  : base_url + entry.href);
             }
         }
 
@@ -1868,109 +1909,15 @@ static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, Tabl
         std::sort(archive_urls.begin(), archive_urls.end());
 
         // Deduplicate schema names
-        std::set<std::string> used_schemas;
-        std::vector<std::pair<std::string, std::string>> archive_schema_pairs; // (url, schema_name)
-
         for (auto &archive_url : archive_urls) {
             std::string schema = ArchiveUrlToSchemaName(archive_url);
             std::string base_schema = schema;
             int suffix = 2;
-            while (used_schemas.count(schema)) {
+            while (result->reserved_schemas.count(schema)) {
                 schema = base_schema + "_" + std::to_string(suffix++);
             }
-            used_schemas.insert(schema);
-            archive_schema_pairs.push_back({archive_url, schema});
-        }
-
-        // Process each archive — extract all GoBD folders within each
-        std::vector<std::pair<std::string, std::vector<std::string>>> folder_schema_table_list;
-
-        for (auto &pair : archive_schema_pairs) {
-            const std::string &archive_url = pair.first;
-            const std::string &archive_schema = pair.second;
-
-            try {
-                if (read_folder > 0) {
-                    // Specific folder only
-                    GobdImportData import_data = ExtractGobdFromArchiveUrl(archive_url, username, password, read_folder);
-                    auto archive_results = ExecuteGobdImportPipeline(context, import_data, delimiter, overwrite, archive_schema);
-
-                    std::vector<std::string> table_names;
-                    for (auto &r : archive_results) {
-                        r.archive_url = archive_url;
-                        if (r.error.empty()) table_names.push_back(r.table_name);
-                    }
-
-                    if (!table_names.empty()) {
-                        Connection conn(context.db->GetDatabase(context));
-                        EnrichWithMandantendaten(conn, archive_schema, table_names);
-                    }
-                    folder_schema_table_list.push_back({archive_schema, table_names});
-                    result->import_results.insert(result->import_results.end(),
-                                                  archive_results.begin(), archive_results.end());
-                } else {
-                    // All folders within this archive
-                    auto all_folders = ExtractAllGobdFromArchiveUrl(archive_url, username, password);
-
-                    for (auto &folder_pair : all_folders) {
-                        std::string folder_name = folder_pair.first;
-                        // Schema: use folder name if available, otherwise archive name
-                        std::string schema_name = folder_name.empty()
-                            ? archive_schema
-                            : ToSnakeCase(folder_name);
-
-                        // Deduplicate
-                        std::string base_schema = schema_name;
-                        int suffix = 2;
-                        while (used_schemas.count(schema_name)) {
-                            schema_name = base_schema + "_" + std::to_string(suffix++);
-                        }
-                        used_schemas.insert(schema_name);
-
-                        try {
-                            auto folder_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter, overwrite, schema_name);
-
-                            std::vector<std::string> table_names;
-                            for (auto &r : folder_results) {
-                                r.archive_url = archive_url;
-                                if (r.error.empty()) table_names.push_back(r.table_name);
-                            }
-
-                            if (!table_names.empty()) {
-                                Connection conn(context.db->GetDatabase(context));
-                                EnrichWithMandantendaten(conn, schema_name, table_names);
-                            }
-                            folder_schema_table_list.push_back({schema_name, table_names});
-                            result->import_results.insert(result->import_results.end(),
-                                                          folder_results.begin(), folder_results.end());
-                        } catch (std::exception &e) {
-                            GobdImportResult err_result;
-                            err_result.schema_name = schema_name;
-                            err_result.table_name = "(folder)";
-                            err_result.rows_imported = 0;
-                            err_result.columns_created = 0;
-                            err_result.archive_url = archive_url;
-                            err_result.error = e.what();
-                            result->import_results.push_back(err_result);
-                        }
-                    }
-                }
-            } catch (std::exception &e) {
-                GobdImportResult err_result;
-                err_result.schema_name = archive_schema;
-                err_result.table_name = "(archive)";
-                err_result.rows_imported = 0;
-                err_result.columns_created = 0;
-                err_result.archive_url = archive_url;
-                err_result.error = e.what();
-                result->import_results.push_back(err_result);
-            }
-        }
-
-        // Consolidate all schemas into main
-        if (!folder_schema_table_list.empty()) {
-            Connection conn(context.db->GetDatabase(context));
-            ConsolidateIntoMain(conn, folder_schema_table_list);
+            result->reserved_schemas.insert(schema);
+            result->archives.push_back({archive_url, schema});
         }
     }
 
@@ -1991,6 +1938,208 @@ static unique_ptr<FunctionData> GobdCloudZipAllBind(ClientContext &context, Tabl
     return std::move(result);
 }
 
+static unique_ptr<GlobalTableFunctionState> GobdZipImportInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<GobdZipImportBindData>();
+    auto result = make_uniq<GobdZipImportGlobalState>(context, bind_data);
+    result->used_schemas = bind_data.reserved_schemas;
+    return std::move(result);
+}
+
+static GobdImportResult GobdZipErrorRow(const std::string &schema, const std::string &unit, const std::string &url,
+                                        const std::string &error) {
+    GobdImportResult err_result;
+    err_result.schema_name = schema;
+    err_result.table_name = unit;
+    err_result.rows_imported = 0;
+    err_result.columns_created = 0;
+    err_result.archive_url = url;
+    err_result.error = error;
+    return err_result;
+}
+
+// Consolidate all schemas into main
+static void FinishGobdZipImport(GobdZipImportGlobalState &state) {
+    if (!state.schema_table_list.empty()) {
+        auto session = SessionPool::Acquire(state.context);
+        ConsolidateIntoMain(session, state.schema_table_list);
+    }
+    state.finished = true;
+}
+
+// Advance by one step: import one table, close a finished folder, start the next folder,
+// open the next archive, or consolidate at the end. Finished units are added to rows.
+static void StepGobdZipImport(ClientContext &context, const GobdZipImportBindData &bind_data,
+                              GobdZipImportGlobalState &state, vector<GobdImportResult> &rows) {
+    if (state.pipeline) {
+        auto &archive = bind_data.archives[state.next_archive - 1];
+        GobdImportResult result;
+        bool imported;
+        try {
+            imported = state.pipeline->Next(result);
+        } catch (std::exception &e) {
+            rows.push_back(GobdZipErrorRow(state.schema, "(folder)", archive.url, e.what()));
+            imported = false;
+        }
+        if (imported) {
+            result.archive_url = archive.url;
+            if (result.error.empty()) {
+                state.imported_tables.push_back(result.table_name);
+            }
+            rows.push_back(result);
+            state.tables_done = state.pipeline->TablesDone();
+            return;
+        }
+        // Folder done: keep its tables for consolidation
+        if (!bind_data.default_schema) {
+            state.schema_table_list.push_back({state.schema, state.imported_tables});
+        }
+        state.pipeline.reset();
+        state.imported_tables.clear();
+        state.tables_total = 0;
+        state.tables_done = 0;
+        state.folders_done++;
+        return;
+    }
+
+    if (state.archive_open && state.next_folder < state.folders.size()) {
+        auto &archive = bind_data.archives[state.next_archive - 1];
+        auto &folder_pair = state.folders[state.next_folder++];
+
+        // Schema: the folder name if available, otherwise the archive name
+        std::string schema_name;
+        if (!bind_data.default_schema) {
+            schema_name = folder_pair.first.empty() || bind_data.read_folder > 0 ? archive.schema
+                                                                                 : ToSnakeCase(folder_pair.first);
+            if (schema_name == archive.schema && !state.archive_schema_taken) {
+                state.archive_schema_taken = true;
+            } else {
+                std::string base_schema = schema_name;
+                int suffix = 2;
+                while (state.used_schemas.count(schema_name)) {
+                    schema_name = base_schema + "_" + std::to_string(suffix++);
+                }
+            }
+            state.used_schemas.insert(schema_name);
+        }
+        state.schema = schema_name;
+
+        try {
+            // Each folder's tables get its mandantendaten columns
+            state.pipeline = make_uniq<GobdImportPipeline>(context, std::move(folder_pair.second), bind_data.delimiter,
+                                                           bind_data.overwrite, schema_name, !bind_data.default_schema);
+            state.tables_done = 0;
+            state.tables_total = state.pipeline->TableCount();
+        } catch (std::exception &e) {
+            rows.push_back(GobdZipErrorRow(schema_name, "(folder)", archive.url, e.what()));
+            state.folders_done++;
+        }
+        return;
+    }
+
+    if (state.archive_open) {
+        // Releases the extracted data of the archive
+        state.folders.clear();
+        state.archive_open = false;
+        state.folders_total = 0;
+        state.archives_done++;
+        return;
+    }
+
+    if (state.next_archive < bind_data.archives.size()) {
+        auto &archive = bind_data.archives[state.next_archive++];
+        state.next_folder = 0;
+        state.folders_done = 0;
+        state.archive_schema_taken = false;
+        try {
+            if (bind_data.read_folder > 0) {
+                // Specific folder only
+                state.folders.clear();
+                state.folders.emplace_back(
+                    "", ExtractGobdFromArchiveUrl(context, archive.url, bind_data.username, bind_data.password,
+                                                  bind_data.read_folder));
+            } else {
+                state.folders =
+                    ExtractAllGobdFromArchiveUrl(context, archive.url, bind_data.username, bind_data.password);
+            }
+            state.archive_open = true;
+            state.folders_total = state.folders.size();
+        } catch (std::exception &e) {
+            if (bind_data.single_archive) {
+                throw;
+            }
+            rows.push_back(GobdZipErrorRow(archive.schema, "(archive)", archive.url, e.what()));
+            state.archives_done++;
+        }
+        return;
+    }
+
+    FinishGobdZipImport(state);
+}
+
+GobdZipImportGlobalState::~GobdZipImportGlobalState() {
+    if (finished) {
+        return;
+    }
+    try {
+        vector<GobdImportResult> rows;
+        while (!finished && !context.interrupted) {
+            StepGobdZipImport(context, bind_data, *this, rows);
+            rows.clear();
+        }
+        if (!finished) {
+            // Cancelled: keep the tables of the open folder for consolidation
+            if (pipeline && !bind_data.default_schema) {
+                schema_table_list.push_back({schema, imported_tables});
+            }
+            pipeline.reset();
+            FinishGobdZipImport(*this);
+        }
+    } catch (...) {
+        // A destructor cannot report errors; the imported schemas are left as they are
+    }
+}
+
+static void GobdZipImportScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &state = data_p.global_state->Cast<GobdZipImportGlobalState>();
+
+    vector<GobdImportResult> rows;
+    while (rows.empty() && !state.finished) {
+        StepGobdZipImport(context, state.bind_data, state, rows);
+    }
+
+    for (idx_t i = 0; i < rows.size(); i++) {
+        auto &r = rows[i];
+        output.SetValue(0, i, r.schema_name.empty() ? Value() : Value(r.schema_name));
+        output.SetValue(1, i, Value(r.table_name));
+        output.SetValue(2, i, Value::BIGINT(r.rows_imported));
+        output.SetValue(3, i, Value::INTEGER(r.columns_created));
+        output.SetValue(4, i, r.archive_url.empty() ? Value() : Value(r.archive_url));
+        output.SetValue(5, i, r.error.empty() ? Value() : Value(r.error));
+    }
+    output.SetCardinality(rows.size());
+}
+
+static double GobdZipImportProgress(ClientContext &context, const FunctionData *bind_data_p,
+                                    const GlobalTableFunctionState *global_state) {
+    auto &bind_data = bind_data_p->Cast<GobdZipImportBindData>();
+    auto &state = global_state->Cast<GobdZipImportGlobalState>();
+    if (state.finished || bind_data.archives.empty()) {
+        return 100.0;
+    }
+    double archive_part = 0.0;
+    idx_t folders_total = state.folders_total;
+    if (folders_total > 0) {
+        double folder_part = 0.0;
+        idx_t tables_total = state.tables_total;
+        if (tables_total > 0) {
+            folder_part = MinValue<double>(double(state.tables_done) / double(tables_total), 1.0);
+        }
+        archive_part = MinValue<double>((double(state.folders_done) + folder_part) / double(folders_total), 1.0);
+    }
+    return 100.0 * MinValue<double>((double(state.archives_done) + archive_part) / double(bind_data.archives.size()),
+                                    1.0);
+}
+
 static unique_ptr<GlobalTableFunctionState> GobdCloudZipAllInit(ClientContext &context, TableFunctionInitInput &input) {
     return make_uniq<GobdCloudZipAllGlobalState>();
 }
@@ -2042,7 +2191,7 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
 
     if (IsArchiveUrl(url)) {
         // ---- Direct archive URL: extract all folders (use subfolder names) ----
-        auto all_folders = ExtractAllGobdFromArchiveUrl(url, username, password, /*use_subfolder=*/true);
+        auto all_folders = ExtractAllGobdFromArchiveUrl(context, url, username, password, /*use_subfolder=*/true);
         std::string archive_base = ArchiveUrlToSchemaName(url);
 
         std::set<std::string> used_schemas;
@@ -2065,7 +2214,8 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
             std::string original_folder = folder_name.empty() ? schema_name : folder_name;
 
             try {
-                auto archive_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter, overwrite, schema_name);
+                auto archive_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter, overwrite,
+                                                                 schema_name, /*enrich_mandantendaten=*/true);
 
                 std::vector<std::string> table_names;
                 for (auto &r : archive_results) {
@@ -2075,11 +2225,6 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
                     }
                 }
 
-                if (!table_names.empty()) {
-                    Connection conn(context.db->GetDatabase(context));
-                    EnrichWithMandantendaten(conn, schema_name, table_names);
-                }
-
                 schema_folder_table_list.push_back({schema_name, original_folder, table_names});
 
                 result->import_results.insert(result->import_results.end(),
@@ -2098,8 +2243,8 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
 
         // Consolidate all schemas into main with ordner column
         if (!schema_folder_table_list.empty()) {
-            Connection conn(context.db->GetDatabase(context));
-            ConsolidateIntoMainWithFolderColumn(conn, schema_folder_table_list);
+            auto session = SessionPool::Acquire(context);
+            ConsolidateIntoMainWithFolderColumn(session, schema_folder_table_list);
         }
     } else {
         // ---- Folder mode: list folder, find all zip/7z files ----
@@ -2166,7 +2311,8 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
             }
 
             try {
-                auto all_folders = ExtractAllGobdFromArchiveUrl(archive_url, username, password, /*use_subfolder=*/true);
+                auto all_folders = ExtractAllGobdFromArchiveUrl(context, archive_url, username, password,
+                                                                /*use_subfolder=*/true);
 
                 for (auto &folder_pair : all_folders) {
                     std::string folder_name = folder_pair.first;
@@ -2184,7 +2330,9 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
                     std::string original_folder = folder_name.empty() ? schema_name : folder_name;
 
                     try {
-                        auto folder_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter, overwrite, schema_name);
+                        auto folder_results = ExecuteGobdImportPipeline(context, folder_pair.second, delimiter,
+                                                                        overwrite, schema_name,
+                                                                        /*enrich_mandantendaten=*/true);
 
                         std::vector<std::string> table_names;
                         for (auto &r : folder_results) {
@@ -2192,10 +2340,6 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
                             if (r.error.empty()) table_names.push_back(r.table_name);
                         }
 
-                        if (!table_names.empty()) {
-                            Connection conn(context.db->GetDatabase(context));
-                            EnrichWithMandantendaten(conn, schema_name, table_names);
-                        }
                         folder_schema_folder_table_list.push_back({schema_name, original_folder, table_names});
                         result->import_results.insert(result->import_results.end(),
                                                       folder_results.begin(), folder_results.end());
@@ -2224,8 +2368,8 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
 
         // Consolidate all schemas into main with ordner column
         if (!folder_schema_folder_table_list.empty()) {
-            Connection conn(context.db->GetDatabase(context));
-            ConsolidateIntoMainWithFolderColumn(conn, folder_schema_folder_table_list);
+            auto session = SessionPool::Acquire(context);
+            ConsolidateIntoMainWithFolderColumn(session, folder_schema_folder_table_list);
         }
     }
 
@@ -2246,6 +2390,131 @@ static unique_ptr<FunctionData> GobdCloudZipReadFoldersAllBind(ClientContext &co
     return std::move(result);
 }
 
+// ============================================================================
+// stps_gobd_cloud_to_parquet / stps_gobd_cloud_zip_to_parquet
+// ============================================================================
+
+struct GobdCloudParquetBindData : public TableFunctionData {
+    vector<GobdParquetResult> results;
+};
+
+struct GobdCloudParquetGlobalState : public GlobalTableFunctionState {
+    idx_t offset = 0;
+    idx_t MaxThreads() const override { return 1; }
+};
+
+static void ParseCloudParquetParameters(TableFunctionBindInput &input, std::string &username, std::string &password,
+                                        GobdParquetOptions &options, int32_t *read_folder = nullptr) {
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "username") {
+            username = kv.second.ToString();
+        } else if (kv.first == "password") {
+            password = kv.second.ToString();
+        } else if (kv.first == "read_folder" && read_folder) {
+            *read_folder = IntegerValue::Get(kv.second);
+        } else {
+            ParseGobdParquetOption(kv.first, kv.second, options);
+        }
+    }
+}
+
+static unique_ptr<FunctionData> GobdCloudParquetBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<GobdCloudParquetBindData>();
+
+    std::string folder_url = input.inputs[0].ToString();
+    std::string target_dir = input.inputs[1].ToString();
+    std::string username, password;
+    GobdParquetOptions options;
+    ParseCloudParquetParameters(input, username, password, options);
+
+    std::string index_base_url;
+    std::string xml_content = DiscoverAndDownloadIndexXml(folder_url, username, password, index_base_url);
+    if (xml_content.empty()) {
+        throw IOException("Could not find or download index.xml from: " + folder_url);
+    }
+    auto tables = ParseGobdIndexFromString(xml_content);
+    if (tables.empty()) {
+        throw BinderException("No tables found in GoBD index at: " + folder_url);
+    }
+
+    // Each CSV is downloaded when a worker reaches its table
+    GobdImportData export_data;
+    export_data.tables = tables;
+    for (auto &table : tables) {
+        export_data.table_sources[table.url] =
+            make_shared_ptr<GobdDownloadSource>(index_base_url, table.url, username, password);
+    }
+
+    result->results = ExecuteGobdParquetExport(context, export_data, target_dir, options);
+    GobdParquetResultSchema(return_types, names);
+
+    return std::move(result);
+}
+
+static unique_ptr<FunctionData> GobdCloudZipParquetBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<GobdCloudParquetBindData>();
+
+    std::string url = input.inputs[0].ToString();
+    std::string target_dir = input.inputs[1].ToString();
+    std::string username, password;
+    GobdParquetOptions options;
+    int32_t read_folder = 0;
+    ParseCloudParquetParameters(input, username, password, options, &read_folder);
+
+    if (!IsArchiveUrl(url)) {
+        throw BinderException("stps_gobd_cloud_zip_to_parquet expects a .zip or .7z URL: " + url);
+    }
+
+    if (read_folder > 0) {
+        GobdImportData export_data = ExtractGobdFromArchiveUrl(context, url, username, password, read_folder);
+        result->results = ExecuteGobdParquetExport(context, export_data, target_dir, options);
+    } else {
+        // Every index.xml folder goes to its own subdirectory, named like the schemas of
+        // stps_read_gobd_cloud_zip_all
+        auto all_folders = ExtractAllGobdFromArchiveUrl(context, url, username, password);
+        std::string archive_base = ArchiveUrlToSchemaName(url);
+        auto &fs = FileSystem::GetFileSystem(context);
+
+        std::set<std::string> used_folders;
+        for (auto &folder_pair : all_folders) {
+            std::string folder_name = folder_pair.first.empty() ? archive_base : ToSnakeCase(folder_pair.first);
+            std::string base_folder = folder_name;
+            int suffix = 2;
+            while (used_folders.count(folder_name)) {
+                folder_name = base_folder + "_" + std::to_string(suffix++);
+            }
+            used_folders.insert(folder_name);
+
+            std::string folder_dir = fs.JoinPath(target_dir, folder_name);
+            try {
+                auto folder_results = ExecuteGobdParquetExport(context, folder_pair.second, folder_dir, options);
+                result->results.insert(result->results.end(), folder_results.begin(), folder_results.end());
+            } catch (std::exception &ex) {
+                GobdParquetResult err;
+                err.table_name = folder_name;
+                err.file_path = folder_dir;
+                err.error = ex.what();
+                result->results.push_back(err);
+            }
+        }
+    }
+
+    GobdParquetResultSchema(return_types, names);
+    return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> GobdCloudParquetInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<GobdCloudParquetGlobalState>();
+}
+
+static void GobdCloudParquetScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<GobdCloudParquetBindData>();
+    auto &state = data_p.global_state->Cast<GobdCloudParquetGlobalState>();
+    WriteGobdParquetResults(bind_data.results, state.offset, output);
+}
+
 // ============================================================================
 // Registration
 // ============================================================================
@@ -2259,6 +2528,7 @@ void RegisterGobdCloudReaderFunctions(ExtensionLoader &loader) {
         func.named_parameters["username"] = LogicalType::VARCHAR;
         func.named_parameters["password"] = LogicalType::VARCHAR;
         func.named_parameters["delimiter"] = LogicalType::VARCHAR;
+        func.named_parameters["all_varchar"] = LogicalType::BOOLEAN;
 
         CreateTableFunctionInfo info(func);
         loader.RegisterFunction(info);
@@ -2320,7 +2590,8 @@ void RegisterGobdCloudReaderFunctions(ExtensionLoader &loader) {
     {
         TableFunction func("stps_read_gobd_cloud_zip_all",
                           {LogicalType::VARCHAR},
-                          GobdCloudZipAllScan, GobdCloudZipAllBind, GobdCloudZipAllInit);
+                          GobdZipImportScan, GobdCloudZipAllBind, GobdZipImportInit);
+        func.table_scan_progress = GobdZipImportProgress;
         func.named_parameters["username"] = LogicalType::VARCHAR;
         func.named_parameters["password"] = LogicalType::VARCHAR;
         func.named_parameters["delimiter"] = LogicalType::VARCHAR;
@@ -2345,6 +2616,33 @@ void RegisterGobdCloudReaderFunctions(ExtensionLoader &loader) {
         CreateTableFunctionInfo info(func);
         loader.RegisterFunction(info);
     }
+
+    // stps_gobd_cloud_to_parquet(url, target_dir, username, password, delimiter, row_group_size, compression, threads, overwrite)
+    {
+        TableFunction func("stps_gobd_cloud_to_parquet",
+                          {LogicalType::VARCHAR, LogicalType::VARCHAR},
+                          GobdCloudParquetScan, GobdCloudParquetBind, GobdCloudParquetInit);
+        func.named_parameters["username"] = LogicalType::VARCHAR;
+        func.named_parameters["password"] = LogicalType::VARCHAR;
+        AddGobdParquetParameters(func);
+
+        CreateTableFunctionInfo info(func);
+        loader.RegisterFunction(info);
+    }
+
+    // stps_gobd_cloud_zip_to_parquet(url, target_dir, username, password, read_folder, + parquet options)
+    {
+        TableFunction func("stps_gobd_cloud_zip_to_parquet",
+                          {LogicalType::VARCHAR, LogicalType::VARCHAR},
+                          GobdCloudParquetScan, GobdCloudZipParquetBind, GobdCloudParquetInit);
+        func.named_parameters["username"] = LogicalType::VARCHAR;
+        func.named_parameters["password"] = LogicalType::VARCHAR;
+        func.named_parameters["read_folder"] = LogicalType::INTEGER;
+        AddGobdParquetParameters(func);
+
+        CreateTableFunctionInfo info(func);
+        loader.RegisterFunction(info);
+    }
 }
 
 } // namespace stps
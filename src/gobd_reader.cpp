@@ -1,11 +1,20 @@
 #include "gobd_reader.hpp"
 #include "shared/archive_utils.hpp"
+#include "shared/string_arena.hpp"
+#include "shared/profiler.hpp"
+#include "shared/catalog_helper.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/main/client_context_state.hpp"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
@@ -13,6 +22,10 @@
 #include <unordered_map>
 #include <random>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <mutex>
 
 namespace duckdb {
 namespace stps {
@@ -72,6 +85,78 @@ vector<string> ExtractAllTags(const string &xml, const string &tag_name) {
     return results;
 }
 
+// Resolve character references and the predefined entities in element text, e.g. the
+// &#59; / &#13;&#10; used for delimiters
+static string DecodeXmlText(const string &text) {
+    string result;
+    for (size_t i = 0; i < text.size(); i++) {
+        size_t end = text[i] == '&' ? text.find(';', i) : string::npos;
+        if (end == string::npos) {
+            result += text[i];
+            continue;
+        }
+        string entity = text.substr(i + 1, end - i - 1);
+        if (entity.size() > 1 && entity[0] == '#') {
+            bool hex = entity[1] == 'x' || entity[1] == 'X';
+            uint32_t code = 0;
+            try { code = static_cast<uint32_t>(std::stoul(entity.substr(hex ? 2 : 1), nullptr, hex ? 16 : 10)); } catch (...) {}
+            if (code > 0 && code < 0x80) {
+                result += static_cast<char>(code);
+            }
+        } else if (entity == "amp") {
+            result += '&';
+        } else if (entity == "lt") {
+            result += '<';
+        } else if (entity == "gt") {
+            result += '>';
+        } else if (entity == "quot") {
+            result += '"';
+        } else if (entity == "apos") {
+            result += '\'';
+        } else {
+            result += text.substr(i, end - i + 1);
+        }
+        i = end;
+    }
+    return result;
+}
+
+static idx_t ParseGobdCount(const string &value) {
+    try { return value.empty() ? 0 : static_cast<idx_t>(std::stoull(value)); } catch (...) { return 0; }
+}
+
+// Parse one VariablePrimaryKey / VariableColumn / FixedPrimaryKey / FixedColumn element
+static GobdColumn ParseGobdColumn(const string &col_xml, int order) {
+    GobdColumn col;
+    col.name = ExtractTagValue(col_xml, "Name");
+    col.order = order;
+    col.primary_key = col_xml.compare(0, 19, "<VariablePrimaryKey") == 0 ||
+                      col_xml.compare(0, 16, "<FixedPrimaryKey") == 0;
+
+    string fixed_range = ExtractTagValue(col_xml, "FixedRange");
+    if (!fixed_range.empty()) {
+        col.fixed_from = ParseGobdCount(ExtractTagValue(fixed_range, "From"));
+        idx_t to = ParseGobdCount(ExtractTagValue(fixed_range, "To"));
+        col.fixed_length = to >= col.fixed_from && col.fixed_from > 0
+            ? to - col.fixed_from + 1
+            : ParseGobdCount(ExtractTagValue(fixed_range, "Length"));
+    }
+
+    if (col_xml.find("<Numeric>") != string::npos || col_xml.find("<Numeric/>") != string::npos) {
+        col.data_type = "Numeric";
+        string accuracy_str = ExtractTagValue(col_xml, "Accuracy");
+        if (!accuracy_str.empty()) {
+            try { col.accuracy = std::stoi(accuracy_str); } catch (...) {}
+        }
+    } else if (col_xml.find("<Date>") != string::npos || col_xml.find("<Date/>") != string::npos) {
+        col.data_type = "Date";
+        col.date_format = ExtractTagValue(col_xml, "Format");
+    } else {
+        col.data_type = "AlphaNumeric";
+    }
+    return col;
+}
+
 // Parse GoBD index.xml from an in-memory XML string
 vector<GobdTable> ParseGobdIndexFromString(const string &xml) {
     vector<GobdTable> tables;
@@ -87,52 +172,70 @@ vector<GobdTable> ParseGobdIndexFromString(const string &xml) {
 
         if (table.name.empty() || table.url.empty()) continue;
 
-        // Extract VariablePrimaryKey and VariableColumn elements
-        int col_order = 0;
-
-        auto pk_elements = ExtractAllTags(table_xml, "VariablePrimaryKey");
-        for (const auto &pk_xml : pk_elements) {
-            GobdColumn col;
-            col.name = ExtractTagValue(pk_xml, "Name");
-            col.order = col_order++;
-
-            if (pk_xml.find("<Numeric>") != string::npos) {
-                col.data_type = "Numeric";
-                string accuracy_str = ExtractTagValue(pk_xml, "Accuracy");
-                if (!accuracy_str.empty()) {
-                    try { col.accuracy = std::stoi(accuracy_str); } catch (...) {}
-                }
-            } else if (pk_xml.find("<Date>") != string::npos || pk_xml.find("<Date/>") != string::npos) {
-                col.data_type = "Date";
-            } else {
-                col.data_type = "AlphaNumeric";
-            }
+        string decimal_symbol = ExtractTagValue(table_xml, "DecimalSymbol");
+        if (!decimal_symbol.empty()) table.decimal_symbol = decimal_symbol[0];
+        string grouping_symbol = ExtractTagValue(table_xml, "DigitGroupingSymbol");
+        if (!grouping_symbol.empty()) table.digit_grouping_symbol = grouping_symbol[0];
 
-            if (!col.name.empty()) {
-                table.columns.push_back(col);
+        for (const char *charset : {"UTF8", "ANSI", "Macintosh", "OEM"}) {
+            if (table_xml.find("<" + string(charset) + "/>") != string::npos ||
+                table_xml.find("<" + string(charset) + ">") != string::npos) {
+                table.charset = charset;
+                break;
             }
         }
+        table.skip_bytes = ParseGobdCount(ExtractTagValue(table_xml, "SkipNumBytes"));
+        string range = ExtractTagValue(table_xml, "Range");
+        if (!range.empty()) {
+            table.range_from = MaxValue<idx_t>(ParseGobdCount(ExtractTagValue(range, "From")), 1);
+            idx_t to = ParseGobdCount(ExtractTagValue(range, "To"));
+            idx_t length = ParseGobdCount(ExtractTagValue(range, "Length"));
+            table.range_to = to > 0 ? to : length > 0 ? table.range_from + length - 1 : 0;
+        }
 
-        auto col_elements = ExtractAllTags(table_xml, "VariableColumn");
-        for (const auto &col_xml : col_elements) {
-            GobdColumn col;
-            col.name = ExtractTagValue(col_xml, "Name");
-            col.order = col_order++;
+        // Layout: <VariableLength> (delimited) or <FixedLength> (byte offsets)
+        string layout = ExtractTagValue(table_xml, "FixedLength");
+        table.fixed_length = !layout.empty();
+        if (!table.fixed_length) {
+            layout = ExtractTagValue(table_xml, "VariableLength");
+        }
+        // Layout-level settings precede the first column element
+        string layout_head = layout.substr(0, layout.find(table.fixed_length ? "<Fixed" : "<Variable"));
+        if (table.fixed_length) {
+            table.record_length = ParseGobdCount(ExtractTagValue(layout_head, "Length"));
+        }
+        string column_delimiter = DecodeXmlText(ExtractTagValue(layout_head, "ColumnDelimiter"));
+        if (!column_delimiter.empty()) table.column_delimiter = column_delimiter[0];
+        table.record_delimiter = DecodeXmlText(ExtractTagValue(layout_head, "RecordDelimiter"));
+        if (layout_head.find("<TextEncapsulator") != string::npos) {
+            string encapsulator = DecodeXmlText(ExtractTagValue(layout_head, "TextEncapsulator"));
+            table.text_encapsulator = encapsulator.empty() ? '\0' : encapsulator[0];
+        }
 
-            if (col_xml.find("<Numeric>") != string::npos) {
-                col.data_type = "Numeric";
-                string accuracy_str = ExtractTagValue(col_xml, "Accuracy");
-                if (!accuracy_str.empty()) {
-                    try { col.accuracy = std::stoi(accuracy_str); } catch (...) {}
+        // Primary key columns first, then the others (each in document order)
+        int col_order = 0;
+        string key_tag = table.fixed_length ? "FixedPrimaryKey" : "VariablePrimaryKey";
+        string column_tag = table.fixed_length ? "FixedColumn" : "VariableColumn";
+        for (const string &tag : {key_tag, column_tag}) {
+            for (const auto &col_xml : ExtractAllTags(table_xml, tag)) {
+                auto col = ParseGobdColumn(col_xml, col_order++);
+                if (!col.name.empty()) {
+                    table.columns.push_back(col);
                 }
-            } else if (col_xml.find("<Date>") != string::npos || col_xml.find("<Date/>") != string::npos) {
-                col.data_type = "Date";
-            } else {
-                col.data_type = "AlphaNumeric";
             }
+        }
 
-            if (!col.name.empty()) {
-                table.columns.push_back(col);
+        for (const auto &fk_xml : ExtractAllTags(table_xml, "ForeignKey")) {
+            GobdForeignKey fk;
+            for (const auto &name_xml : ExtractAllTags(fk_xml, "Name")) {
+                fk.columns.push_back(ExtractTagValue(name_xml, "Name"));
+            }
+            for (const auto &alias_xml : ExtractAllTags(fk_xml, "Alias")) {
+                fk.aliases.push_back(ExtractTagValue(alias_xml, "Alias"));
+            }
+            fk.references = ExtractTagValue(fk_xml, "References");
+            if (!fk.columns.empty() && !fk.references.empty()) {
+                table.foreign_keys.push_back(std::move(fk));
             }
         }
 
@@ -160,7 +263,7 @@ static vector<GobdTable> ParseGobdIndex(const string &filepath) {
 // Helper function to convert GoBD data type to DuckDB type
 LogicalType GobdTypeToDuckDbType(const string &gobd_type, int accuracy) {
     if (gobd_type == "Numeric") {
-        if (accuracy >= 0) {
+        if (accuracy >= 0 && accuracy <= 18) {
             return LogicalType::DECIMAL(18, accuracy);
         }
         return LogicalType::DOUBLE;
@@ -170,35 +273,228 @@ LogicalType GobdTypeToDuckDbType(const string &gobd_type, int accuracy) {
     return LogicalType::VARCHAR;
 }
 
+// "Table.Column" referenced by a column through a declared ForeignKey
+string GobdColumnReference(const GobdTable &table, const GobdColumn &col) {
+    for (auto &fk : table.foreign_keys) {
+        for (size_t k = 0; k < fk.columns.size(); k++) {
+            if (fk.columns[k] == col.name) {
+                return fk.references + "." + (k < fk.aliases.size() ? fk.aliases[k] : col.name);
+            }
+        }
+    }
+    return "";
+}
+
+// ============ Typed Columns ============
+
+// Date layout from a GoBD <Format> such as DD.MM.YYYY, YYYY-MM-DD, YYYYMMDD or YYMMDD
+static void PlanGobdDate(const string &format, GobdColumnPlan &plan) {
+    string upper = format;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    if (upper.compare(0, 2, "YY") == 0) {
+        plan.date_format = DateFormat::YMD;
+        if (upper == "YYYY-MM-DD") plan.date_kernel = DateKernel::ISO;
+        else if (upper == "YYYYMMDD") plan.date_kernel = DateKernel::COMPACT_YMD;
+    } else if (upper.compare(0, 2, "MM") == 0) {
+        plan.date_format = DateFormat::MDY;
+        if (upper.size() == 10) plan.date_kernel = DateKernel::DAY_MONTH_YEAR;
+    } else {
+        plan.date_format = DateFormat::DMY;
+        if (upper.size() == 10) plan.date_kernel = DateKernel::DAY_MONTH_YEAR;
+        else if (upper == "DDMMYYYY") plan.date_kernel = DateKernel::COMPACT_DMY;
+    }
+}
+
+vector<GobdColumnPlan> PlanGobdColumns(const GobdTable &table, bool all_varchar) {
+    vector<GobdColumnPlan> plans;
+    for (auto &col : table.columns) {
+        GobdColumnPlan plan;
+        plan.locale = table.decimal_symbol == '.' ? NumberLocale::US : NumberLocale::GERMAN;
+        char locale_grouping = plan.locale == NumberLocale::US ? ',' : '.';
+        if (table.digit_grouping_symbol != locale_grouping && table.digit_grouping_symbol != table.decimal_symbol) {
+            plan.grouping_symbol = table.digit_grouping_symbol;
+        }
+        if (!all_varchar) {
+            plan.type = GobdTypeToDuckDbType(col.data_type, col.accuracy);
+            if (plan.type.id() == LogicalTypeId::DECIMAL) {
+                plan.scale = DecimalType::GetScale(plan.type);
+            } else if (plan.type.id() == LogicalTypeId::DATE) {
+                PlanGobdDate(col.date_format, plan);
+            }
+        }
+        plans.push_back(plan);
+    }
+    return plans;
+}
+
+// True if the field is empty or only whitespace (NULL in a typed column)
+static bool IsBlankGobdField(const string_t &field) {
+    const char *data = field.GetData();
+    for (idx_t i = 0; i < field.GetSize(); i++) {
+        if (!StringUtil::CharacterIsSpace(data[i])) return false;
+    }
+    return true;
+}
+
+// Scan a Numeric field, first mapping a non-standard DigitGroupingSymbol onto the locale's
+static bool ScanGobdNumber(const string_t &field, const GobdColumnPlan &plan, ScannedNumber &number) {
+    const char *data = field.GetData();
+    idx_t size = field.GetSize();
+    char buffer[64];
+    if (plan.grouping_symbol != '\0' && size <= sizeof(buffer) && memchr(data, plan.grouping_symbol, size)) {
+        char locale_grouping = plan.locale == NumberLocale::US ? ',' : '.';
+        for (idx_t i = 0; i < size; i++) {
+            buffer[i] = data[i] == plan.grouping_symbol ? locale_grouping : data[i];
+        }
+        data = buffer;
+    }
+    return SmartCastUtils::ScanNumber(data, size, plan.locale, number);
+}
+
+// Convert a non-VARCHAR field into typed storage; false if empty or not convertible
+static bool ParseGobdDecimal(const string_t &field, const GobdColumnPlan &plan, int64_t &out) {
+    ScannedNumber number;
+    return ScanGobdNumber(field, plan, number) && SmartCastUtils::ScannedToDecimal(number, plan.scale, out);
+}
+
+static bool ParseGobdDouble(const string_t &field, const GobdColumnPlan &plan, double &out) {
+    ScannedNumber number;
+    return ScanGobdNumber(field, plan, number) && SmartCastUtils::ScannedToDouble(number, plan.locale, out);
+}
+
+static bool ParseGobdDate(const string_t &field, const GobdColumnPlan &plan, date_t &out) {
+    return SmartCastUtils::ParseDateFast(plan.date_kernel, field.GetData(), field.GetSize(), plan.date_format, out);
+}
+
+void WriteGobdFields(DataChunk &output, idx_t row, const vector<string_t> &fields,
+                     const vector<GobdColumnPlan> &plans, idx_t first_column) {
+    for (idx_t col = first_column; col < output.ColumnCount(); col++) {
+        auto &vec = output.data[col];
+        idx_t field = col - first_column;
+        if (field >= fields.size()) {
+            FlatVector::SetNull(vec, row, true);
+            continue;
+        }
+        auto &plan = plans[field];
+        bool ok = true;
+        switch (plan.type.id()) {
+        case LogicalTypeId::DECIMAL:
+            ok = ParseGobdDecimal(fields[field], plan, FlatVector::GetData<int64_t>(vec)[row]);
+            break;
+        case LogicalTypeId::DOUBLE:
+            ok = ParseGobdDouble(fields[field], plan, FlatVector::GetData<double>(vec)[row]);
+            break;
+        case LogicalTypeId::DATE:
+            ok = ParseGobdDate(fields[field], plan, FlatVector::GetData<date_t>(vec)[row]);
+            break;
+        default:
+            FlatVector::GetData<string_t>(vec)[row] = StringVector::AddString(vec, fields[field]);
+            break;
+        }
+        if (!ok) {
+            if (!IsBlankGobdField(fields[field])) {
+                throw InvalidInputException("GoBD value '%s' in column %llu does not match its declared type %s; "
+                                            "read the table with all_varchar := true to keep it as text",
+                                            fields[field].GetString(), field + 1, plan.type.ToString());
+            }
+            FlatVector::SetNull(vec, row, true);
+        }
+    }
+}
+
+// Append text to the pre-processed import CSV (';'-separated, '"' quotes), quoted only
+// when it contains a separator, quote or line break
+static void AppendCleanCsvText(string &out, const string_t &field) {
+    const char *data = field.GetData();
+    idx_t size = field.GetSize();
+    bool needs_quotes = false;
+    for (idx_t i = 0; i < size && !needs_quotes; i++) {
+        needs_quotes = data[i] == ';' || data[i] == '"' || data[i] == '\n' || data[i] == '\r';
+    }
+    if (!needs_quotes) {
+        out.append(data, size);
+        return;
+    }
+    out += '"';
+    for (idx_t i = 0; i < size; i++) {
+        if (data[i] == '"') out += '"';
+        out += data[i];
+    }
+    out += '"';
+}
+
+// Append a field to the pre-processed import CSV: VARCHAR as text, typed columns in the
+// canonical form read_csv expects (1234.56, YYYY-MM-DD). Blank fields are left empty and
+// load as NULL; returns false (appending nothing) if a field does not convert.
+static bool AppendGobdField(string &out, const string_t &field, const GobdColumnPlan &plan) {
+    char buffer[32];
+    switch (plan.type.id()) {
+    case LogicalTypeId::DECIMAL: {
+        int64_t value;
+        if (!ParseGobdDecimal(field, plan, value)) return IsBlankGobdField(field);
+        uint64_t magnitude = value < 0 ? static_cast<uint64_t>(-(value + 1)) + 1 : static_cast<uint64_t>(value);
+        // Digits are produced right to left, with the decimal point after scale digits
+        int pos = sizeof(buffer);
+        for (int digit = 0; magnitude > 0 || digit <= plan.scale; digit++) {
+            if (digit == plan.scale && plan.scale > 0) buffer[--pos] = '.';
+            buffer[--pos] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        }
+        if (value < 0) buffer[--pos] = '-';
+        out.append(buffer + pos, sizeof(buffer) - pos);
+        return true;
+    }
+    case LogicalTypeId::DOUBLE: {
+        double value;
+        if (!ParseGobdDouble(field, plan, value)) return IsBlankGobdField(field);
+        int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+        out.append(buffer, static_cast<size_t>(length));
+        return true;
+    }
+    case LogicalTypeId::DATE: {
+        date_t value;
+        int32_t year, month, day;
+        if (!ParseGobdDate(field, plan, value)) return IsBlankGobdField(field);
+        Date::Convert(value, year, month, day);
+        if (year < 1 || year > 9999) return false;
+        int length = snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", year, month, day);
+        out.append(buffer, static_cast<size_t>(length));
+        return true;
+    }
+    default:
+        AppendCleanCsvText(out, field);
+        return true;
+    }
+}
+
 // ============ CSV Parsing Helpers ============
 
 // Parse a single CSV line respecting quotes
 vector<string> ParseCsvLine(const string &line, char delimiter) {
+    // Sized for the whole line, so at most one allocation (only if a field is quoted)
+    ::stps::shared::StringArena arena(line.size() + 1);
+    vector<string_t> views;
+    ::stps::shared::SplitCsvLine(line.data(), line.size(), delimiter, arena, views);
+
     vector<string> fields;
-    string current_field;
-    bool in_quotes = false;
-
-    for (size_t i = 0; i < line.length(); i++) {
-        char c = line[i];
-
-        if (c == '"') {
-            if (in_quotes && i + 1 < line.length() && line[i + 1] == '"') {
-                // Escaped quote
-                current_field += '"';
-                i++;
-            } else {
-                in_quotes = !in_quotes;
-            }
-        } else if (c == delimiter && !in_quotes) {
-            fields.push_back(current_field);
-            current_field.clear();
+    fields.reserve(views.size());
+    for (auto &view : views) {
+        fields.emplace_back(view.GetData(), view.GetSize());
+    }
+    return fields;
+}
+
+// Fields go straight from the line/arena views into the output vectors
+void WriteCsvFields(DataChunk &output, idx_t row, const vector<string_t> &fields, idx_t first_column) {
+    for (idx_t col = first_column; col < output.ColumnCount(); col++) {
+        auto &vec = output.data[col];
+        idx_t field = col - first_column;
+        if (field < fields.size()) {
+            FlatVector::GetData<string_t>(vec)[row] = StringVector::AddString(vec, fields[field]);
         } else {
-            current_field += c;
+            FlatVector::SetNull(vec, row, true);  // NULL for missing fields
         }
     }
-    fields.push_back(current_field);
-
-    return fields;
 }
 
 // ============ Encoding Helpers ============
@@ -239,6 +535,62 @@ static const uint16_t CP1250_MAP[128] = {
     0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9
 };
 
+// Code page 850 (DOS Latin-1, GoBD "OEM") mapping for bytes 0x80-0xFF
+static const uint16_t CP850_MAP[128] = {
+    // 0x80-0x8F
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    // 0x90-0x9F
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192,
+    // 0xA0-0xAF
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    // 0xB0-0xBF
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0,
+    0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+    // 0xC0-0xCF
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+    // 0xD0-0xDF
+    0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE,
+    0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+    // 0xE0-0xEF
+    0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE,
+    0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
+    // 0xF0-0xFF
+    0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8,
+    0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
+};
+
+// Mac OS Roman (GoBD "Macintosh") mapping for bytes 0x80-0xFF
+static const uint16_t MAC_ROMAN_MAP[128] = {
+    // 0x80-0x8F
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1,
+    0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+    // 0x90-0x9F
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3,
+    0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+    // 0xA0-0xAF
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF,
+    0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+    // 0xB0-0xBF
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211,
+    0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8,
+    // 0xC0-0xCF
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB,
+    0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+    // 0xD0-0xDF
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA,
+    0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0xFB01, 0xFB02,
+    // 0xE0-0xEF
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1,
+    0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+    // 0xF0-0xFF
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC,
+    0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7
+};
+
 // ISO-8859-1 (Latin-1): bytes 0x80-0xFF map directly to Unicode code points 0x0080-0x00FF
 // No table needed — the byte value IS the Unicode code point.
 
@@ -255,28 +607,44 @@ static void AppendUtf8Char(std::string &out, uint32_t cp) {
     }
 }
 
-bool IsValidUtf8(const std::string &str) {
-    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(str.data());
-    size_t len = str.size();
+bool IsValidUtf8(const char *data, size_t len) {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
     for (size_t i = 0; i < len; ) {
-        if (bytes[i] <= 0x7F) {
+        unsigned char c = bytes[i];
+        if (c <= 0x7F) {
             i++;
-        } else if ((bytes[i] & 0xE0) == 0xC0) {
-            if (i + 1 >= len || (bytes[i + 1] & 0xC0) != 0x80) return false;
-            i += 2;
-        } else if ((bytes[i] & 0xF0) == 0xE0) {
-            if (i + 2 >= len || (bytes[i + 1] & 0xC0) != 0x80 || (bytes[i + 2] & 0xC0) != 0x80) return false;
-            i += 3;
-        } else if ((bytes[i] & 0xF8) == 0xF0) {
-            if (i + 3 >= len || (bytes[i + 1] & 0xC0) != 0x80 || (bytes[i + 2] & 0xC0) != 0x80 || (bytes[i + 3] & 0xC0) != 0x80) return false;
-            i += 4;
+            continue;
+        }
+        // Sequence length and the allowed range of the second byte (rules out overlong
+        // forms, UTF-16 surrogates and code points above U+10FFFF)
+        size_t length;
+        unsigned char low = 0x80, high = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF) {
+            length = 2;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            length = 3;
+            if (c == 0xE0) low = 0xA0;
+            if (c == 0xED) high = 0x9F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            length = 4;
+            if (c == 0xF0) low = 0x90;
+            if (c == 0xF4) high = 0x8F;
         } else {
             return false;
         }
+        if (i + length > len || bytes[i + 1] < low || bytes[i + 1] > high) return false;
+        for (size_t k = 2; k < length; k++) {
+            if ((bytes[i + k] & 0xC0) != 0x80) return false;
+        }
+        i += length;
     }
     return true;
 }
 
+bool IsValidUtf8(const std::string &str) {
+    return IsValidUtf8(str.data(), str.size());
+}
+
 std::string ConvertWindows1252ToUtf8(const std::string &input) {
     std::string output;
     output.reserve(input.size() * 2);
@@ -312,6 +680,20 @@ static std::string ConvertCp1250ToUtf8(const std::string &input) {
     return output;
 }
 
+// Single-byte code page given by the mapping of bytes 0x80-0xFF
+static std::string ConvertCodePageToUtf8(const std::string &input, const uint16_t *map) {
+    std::string output;
+    output.reserve(input.size() * 2);
+    for (unsigned char c : input) {
+        if (c <= 0x7F) {
+            output.push_back(static_cast<char>(c));
+        } else {
+            AppendUtf8Char(output, map[c - 0x80]);
+        }
+    }
+    return output;
+}
+
 static std::string ConvertLatin1ToUtf8(const std::string &input) {
     std::string output;
     output.reserve(input.size() * 2);
@@ -350,7 +732,184 @@ std::string ConvertToUtf8(const std::string &input, const std::string &encoding)
     if (enc == "latin1" || enc == "iso88591" || enc == "iso885915") {
         return ConvertLatin1ToUtf8(input);
     }
-    throw std::runtime_error("Unsupported encoding: " + encoding + ". Supported: utf-8, cp1250, cp1252, latin1/iso-8859-1");
+    if (enc == "cp850" || enc == "ibm850" || enc == "oem") {
+        return ConvertCodePageToUtf8(input, CP850_MAP);
+    }
+    if (enc == "macroman" || enc == "macintosh" || enc == "mac") {
+        return ConvertCodePageToUtf8(input, MAC_ROMAN_MAP);
+    }
+    throw std::runtime_error("Unsupported encoding: " + encoding +
+                             ". Supported: utf-8, cp1250, cp1252, latin1/iso-8859-1, cp850, macroman");
+}
+
+// ============ Record Decoder ============
+
+GobdCharset GobdTableCharset(const GobdTable &table, const std::string *content) {
+    if (table.charset == "UTF8") return GobdCharset::UTF8;
+    if (table.charset == "ANSI") return GobdCharset::ANSI;
+    if (table.charset == "OEM") return GobdCharset::OEM;
+    if (table.charset == "Macintosh") return GobdCharset::MACINTOSH;
+    return content && !IsValidUtf8(*content) ? GobdCharset::ANSI : GobdCharset::UTF8;
+}
+
+// Unicode code point of a byte >= 0x80 in a single-byte charset
+static uint32_t GobdCodePoint(GobdCharset charset, unsigned char c) {
+    switch (charset) {
+    case GobdCharset::OEM:
+        return CP850_MAP[c - 0x80];
+    case GobdCharset::MACINTOSH:
+        return MAC_ROMAN_MAP[c - 0x80];
+    default:
+        return c <= 0x9F ? CP1252_MAP[c - 0x80] : c;
+    }
+}
+
+// Re-encode a field with bytes >= 0x80 as UTF-8 in the arena (at most 3 bytes per byte)
+static string_t ConvertGobdField(const string_t &field, GobdCharset charset, ::stps::shared::StringArena &arena) {
+    auto data = reinterpret_cast<const unsigned char *>(field.GetData());
+    idx_t size = field.GetSize();
+    idx_t first_high = 0;
+    while (first_high < size && data[first_high] < 0x80) {
+        first_high++;
+    }
+    if (first_high == size) {
+        return field;
+    }
+    char *target = arena.Allocate(size * 3);
+    memcpy(target, data, first_high);
+    idx_t out = first_high;
+    for (idx_t i = first_high; i < size; i++) {
+        if (data[i] < 0x80) {
+            target[out++] = static_cast<char>(data[i]);
+            continue;
+        }
+        uint32_t cp = GobdCodePoint(charset, data[i]);
+        if (cp <= 0x7FF) {
+            target[out++] = static_cast<char>(0xC0 | (cp >> 6));
+        } else {
+            target[out++] = static_cast<char>(0xE0 | (cp >> 12));
+            target[out++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        }
+        target[out++] = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return string_t(target, static_cast<uint32_t>(out));
+}
+
+GobdRecordDecoder::GobdRecordDecoder(const GobdTable &table, char default_delimiter, GobdCharset charset_p)
+    : fixed(table.fixed_length), record_length(table.record_length),
+      delimiter(table.column_delimiter != '\0' ? table.column_delimiter : default_delimiter),
+      quote(table.text_encapsulator), record_delimiter(table.record_delimiter), charset(charset_p),
+      skip_remaining(table.skip_bytes), range_from(table.range_from), range_to(table.range_to) {
+    line_records = record_delimiter.empty() || record_delimiter == "\n" || record_delimiter == "\r\n";
+    if (fixed) {
+        idx_t widest = 0;
+        for (auto &col : table.columns) {
+            FixedSlice slice {col.fixed_from > 0 ? col.fixed_from - 1 : 0, col.fixed_length};
+            widest = MaxValue<idx_t>(widest, slice.offset + slice.length);
+            slices.push_back(slice);
+        }
+        if (record_length == 0) {
+            record_length = widest;
+        }
+    }
+}
+
+bool GobdRecordDecoder::NextRecord(const char *data, size_t size, size_t &position, bool final,
+                                   const char *&record, size_t &length) {
+    if (fixed && record_delimiter.empty()) {
+        // Back-to-back records of record_length bytes; a short tail only counts at the end
+        // and when it is not just a trailing line break
+        if (record_length == 0 || position >= size) return false;
+        if (size - position < record_length) {
+            if (!final) return false;
+            record = data + position;
+            length = size - position;
+            position = size;
+            while (length > 0 && (record[length - 1] == '\n' || record[length - 1] == '\r')) {
+                length--;
+            }
+            return length > 0;
+        }
+        record = data + position;
+        length = record_length;
+        position += record_length;
+        return true;
+    }
+    while (position < size) {
+        size_t start = position;
+        size_t end;
+        if (line_records) {
+            auto newline = static_cast<const char *>(memchr(data + start, '\n', size - start));
+            if (!newline && !final) return false;
+            end = newline ? static_cast<size_t>(newline - data) : size;
+            position = newline ? end + 1 : size;
+            if (end > start && data[end - 1] == '\r') {
+                end--;
+            }
+        } else {
+            auto found = std::search(data + start, data + size, record_delimiter.begin(), record_delimiter.end());
+            if (found == data + size && !final) return false;
+            end = static_cast<size_t>(found - data);
+            position = found == data + size ? size : end + record_delimiter.size();
+        }
+        if (end > start) {
+            record = data + start;
+            length = end - start;
+            return true;
+        }
+    }
+    return false;
+}
+
+void GobdRecordDecoder::Split(const char *record, size_t length, ::stps::shared::StringArena &arena,
+                              vector<string_t> &fields) {
+    if (fixed) {
+        // Pure offset arithmetic: each column is a byte range of the record, padding trimmed
+        fields.clear();
+        for (auto &slice : slices) {
+            idx_t begin = MinValue<idx_t>(slice.offset, length);
+            idx_t end = MinValue<idx_t>(slice.offset + slice.length, length);
+            while (begin < end && record[begin] == ' ') begin++;
+            while (end > begin && record[end - 1] == ' ') end--;
+            fields.emplace_back(record + begin, static_cast<uint32_t>(end - begin));
+        }
+    } else {
+        ::stps::shared::SplitCsvLine(record, length, delimiter, arena, fields, quote);
+    }
+    if (charset != GobdCharset::UTF8) {
+        for (auto &field : fields) {
+            field = ConvertGobdField(field, charset, arena);
+        }
+        return;
+    }
+    // The charset of an undeclared table is guessed from a prefix, and a declared UTF8 file
+    // can still contain other bytes: a field that is not valid UTF-8 is read as ANSI
+    // (Windows-1252), which maps every byte, instead of passing invalid UTF-8 on
+    for (auto &field : fields) {
+        if (!IsValidUtf8(field.GetData(), field.GetSize())) {
+            field = ConvertGobdField(field, GobdCharset::ANSI, arena);
+        }
+    }
+}
+
+bool GobdRecordDecoder::Next(const char *data, size_t size, size_t &position, bool final,
+                             ::stps::shared::StringArena &arena, vector<string_t> &fields) {
+    if (skip_remaining > 0) {
+        idx_t skipped = MinValue<idx_t>(skip_remaining, size - position);
+        position += skipped;
+        skip_remaining -= skipped;
+        if (skip_remaining > 0) return false;
+    }
+    const char *record;
+    size_t length;
+    while (!Finished() && NextRecord(data, size, position, final, record, length)) {
+        records++;
+        if (records >= range_from) {
+            Split(record, length, arena, fields);
+            return true;
+        }
+    }
+    return false;
 }
 
 // ============ Shared Import Pipeline ============
@@ -390,6 +949,22 @@ string ToSnakeCase(const string &input) {
     return result.empty() ? "column" : result;
 }
 
+vector<string> NormalizeGobdColumnNames(const GobdTable &table) {
+    vector<string> normalized_cols;
+    std::set<string> used_names;
+    for (auto &col : table.columns) {
+        string name = ToSnakeCase(col.name);
+        string base_name = name;
+        int suffix = 2;
+        while (used_names.count(name)) {
+            name = base_name + "_" + std::to_string(suffix++);
+        }
+        used_names.insert(name);
+        normalized_cols.push_back(name);
+    }
+    return normalized_cols;
+}
+
 // Escape a SQL identifier (double-quote)
 static string EscapeIdentifier(const string &name) {
     string escaped;
@@ -410,6 +985,17 @@ static string EscapeStringLiteral(const string &value) {
     return "'" + escaped + "'";
 }
 
+// Append a SQL string literal for a field view without an intermediate string
+static void AppendStringLiteral(string &out, const string_t &value) {
+    auto data = value.GetData();
+    out += '\'';
+    for (idx_t i = 0; i < value.GetSize(); i++) {
+        if (data[i] == '\'') out += '\'';
+        out += data[i];
+    }
+    out += '\'';
+}
+
 // Generate unique temp filename for bulk CSV loading
 static std::string GenerateGobdTempFilename() {
     auto now = std::chrono::system_clock::now();
@@ -431,273 +1017,633 @@ static string NormalizeSqlPath(const string &path) {
     return result;
 }
 
-vector<GobdImportResult> ExecuteGobdImportPipeline(ClientContext &context,
-                                                    const GobdImportData &data,
-                                                    char delimiter,
-                                                    bool overwrite,
-                                                    const string &schema_name) {
-    vector<GobdImportResult> results;
-    Connection conn(context.db->GetDatabase(context));
+// ============ Table Sources ============
 
-    // Create schema if specified
-    string escaped_schema;
-    string table_prefix;  // "schema"."table" or just "table"
-    if (!schema_name.empty()) {
-        escaped_schema = EscapeIdentifier(schema_name);
-        conn.Query("CREATE SCHEMA IF NOT EXISTS " + escaped_schema);
+class GobdFileSource : public GobdTableSource {
+public:
+    GobdFileSource(string path_p, std::shared_ptr<void> keep_alive_p)
+        : path(std::move(path_p)), keep_alive(std::move(keep_alive_p)) {}
+
+    idx_t SizeHint() const override {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return 0;
+        auto size = file.tellg();
+        return size > 0 ? static_cast<idx_t>(size) : 0;
     }
 
-    for (auto &table : data.tables) {
-        GobdImportResult result;
-        result.rows_imported = 0;
-        result.columns_created = 0;
-        result.schema_name = schema_name;
+    std::string Load() override {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return "";
+        auto size = file.tellg();
+        if (size <= 0) return "";
+        // Read straight into the result (no stringstream copy)
+        std::string content(static_cast<size_t>(size), '\0');
+        file.seekg(0);
+        file.read(&content[0], size);
+        content.resize(static_cast<size_t>(file.gcount()));
+        return content;
+    }
 
-        // Get CSV content for this table
-        auto csv_it = data.csv_contents.find(table.url);
-        if (csv_it == data.csv_contents.end() || csv_it->second.empty()) {
-            result.table_name = ToSnakeCase(table.name);
-            result.error = "CSV content not found for table: " + table.name;
-            results.push_back(result);
-            continue;
-        }
+    string LocalPath() const override {
+        return path;
+    }
 
-        // Normalize table name
-        string table_name = ToSnakeCase(table.name);
-        result.table_name = table_name;
-        string escaped_table = schema_name.empty()
-            ? EscapeIdentifier(table_name)
-            : escaped_schema + "." + EscapeIdentifier(table_name);
+private:
+    string path;
+    std::shared_ptr<void> keep_alive;
+};
 
-        // Normalize column names, handle duplicates
-        vector<string> normalized_cols;
-        std::set<string> used_names;
-        for (auto &col : table.columns) {
-            string name = ToSnakeCase(col.name);
-            string base_name = name;
-            int suffix = 2;
-            while (used_names.count(name)) {
-                name = base_name + "_" + std::to_string(suffix++);
+shared_ptr<GobdTableSource> MakeGobdFileSource(string path, std::shared_ptr<void> keep_alive) {
+    return make_shared_ptr<GobdFileSource>(std::move(path), std::move(keep_alive));
+}
+
+shared_ptr<GobdLoadBudget> GobdLoadBudget::Get(ClientContext &context) {
+    auto budget = ObjectCache::GetObjectCache(context).GetOrCreate<GobdLoadBudget>(ObjectType());
+    budget->SetLimit(BufferManager::GetBufferManager(context).GetMaxMemory() / 2);
+    return budget;
+}
+
+void GobdLoadBudget::SetLimit(idx_t bytes) {
+    std::lock_guard<std::mutex> guard(lock);
+    limit = bytes;
+    released.notify_all();
+}
+
+void GobdLoadBudget::Acquire(ClientContext &context, idx_t bytes) {
+    std::unique_lock<std::mutex> guard(lock);
+    auto fits = [&]() { return in_use == 0 || limit == 0 || in_use + bytes <= limit; };
+    if (!fits()) {
+        // Throttled: wake up now and then to notice an interrupted query
+        ::stps::shared::ScopedTimer wait_timer("gobd.load.wait");
+        wait_timer.AddBytes(bytes);
+        while (!released.wait_for(guard, std::chrono::milliseconds(100), fits)) {
+            if (context.interrupted) {
+                throw InterruptException();
             }
-            used_names.insert(name);
-            normalized_cols.push_back(name);
         }
+    }
+    in_use += bytes;
+}
 
-        if (normalized_cols.empty()) {
-            result.error = "No columns found for table: " + table.name;
-            results.push_back(result);
-            continue;
+void GobdLoadBudget::Add(idx_t bytes) {
+    std::lock_guard<std::mutex> guard(lock);
+    in_use += bytes;
+}
+
+void GobdLoadBudget::Release(idx_t bytes) {
+    std::lock_guard<std::mutex> guard(lock);
+    in_use -= MinValue(bytes, in_use);
+    released.notify_all();
+}
+
+GobdLoadReservation::GobdLoadReservation(ClientContext &context, shared_ptr<GobdLoadBudget> budget_p, idx_t bytes,
+                                         bool wait)
+    : budget(std::move(budget_p)), reserved(bytes) {
+    if (wait) {
+        budget->Acquire(context, reserved);
+    } else {
+        budget->Add(reserved);
+    }
+}
+
+GobdLoadReservation::~GobdLoadReservation() {
+    Release();
+}
+
+void GobdLoadReservation::Resize(idx_t bytes) {
+    if (bytes > reserved) {
+        budget->Add(bytes - reserved);
+    } else {
+        budget->Release(reserved - bytes);
+    }
+    reserved = bytes;
+}
+
+void GobdLoadReservation::Release() {
+    budget->Release(reserved);
+    reserved = 0;
+}
+
+// Bytes read from a table file per refill of the decode buffer
+static constexpr idx_t GOBD_READ_BLOCK_SIZE = 1 << 20;
+
+// Length of data without an incomplete UTF-8 sequence cut off at its end
+static size_t Utf8CompleteLength(const string &data) {
+    size_t size = data.size();
+    for (size_t back = 1; back <= 3 && back <= size; back++) {
+        auto c = static_cast<unsigned char>(data[size - back]);
+        if ((c & 0xC0) == 0x80) continue;
+        size_t needed = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+        return needed > back ? size - back : size;
+    }
+    return size;
+}
+
+// Records of one table for a GobdRecordDecoder. A local file is streamed in blocks of
+// GOBD_READ_BLOCK_SIZE; any other source is loaded whole. Either way the buffered bytes
+// are held against the load budget until Close().
+class GobdTableReader {
+public:
+    // Open the data of source (or of the local file at path when there is no source);
+    // false if a file cannot be opened or a loaded source came back empty
+    bool Open(ClientContext &context, GobdTableSource *source, const string &path) {
+        auto budget = GobdLoadBudget::Get(context);
+        string local_path = source ? source->LocalPath() : path;
+        if (!local_path.empty()) {
+            file.open(local_path, std::ios::binary);
+            if (!file.is_open()) return false;
+            reservation = make_uniq<GobdLoadReservation>(context, std::move(budget), GOBD_READ_BLOCK_SIZE);
+            ReadBlock();
+            return true;
         }
+        reservation = make_uniq<GobdLoadReservation>(context, std::move(budget), source->SizeHint(),
+                                                     !source->HoldsBudget());
+        ::stps::shared::ScopedTimer load_timer("gobd.load");
+        buffer = source->Load();
+        load_timer.AddBytes(buffer.size());
+        bytes_read = buffer.size();
+        reservation->Resize(buffer.size());
+        end_of_file = true;
+        return !buffer.empty();
+    }
 
-        // Check if table exists
-        {
-            string check_sql = "SELECT 1 FROM information_schema.tables WHERE table_name = " +
-                               EscapeStringLiteral(table_name);
-            if (!schema_name.empty()) {
-                check_sql += " AND table_schema = " + EscapeStringLiteral(schema_name);
+    // Decode the next record into fields; false once the data is done
+    bool Next(GobdRecordDecoder &decoder, ::stps::shared::StringArena &arena, vector<string_t> &fields) {
+        while (true) {
+            if (decoder.Next(buffer.data(), buffer.size(), position, end_of_file, arena, fields)) {
+                return true;
             }
-            check_sql += " LIMIT 1";
-            auto check = conn.Query(check_sql);
-            if (check && check->RowCount() > 0) {
-                if (overwrite) {
-                    conn.Query("DROP TABLE IF EXISTS " + escaped_table);
-                } else {
-                    result.error = "Table already exists: " + table_name + " (use overwrite := true to replace)";
-                    results.push_back(result);
-                    continue;
-                }
+            if (end_of_file || decoder.Finished()) {
+                return false;
             }
+            ReadBlock();
         }
+    }
 
-        // Step 1+2: Pre-process CSV (strip quotes, handle encoding), then bulk load via read_csv
-        std::string csv_content = EnsureUtf8(csv_it->second);
-        std::string temp_path = GenerateGobdTempFilename();
-        bool bulk_loaded = false;
+    // Start over at the first record (for another pass with a fresh decoder)
+    void Rewind() {
+        position = 0;
+        if (file.is_open()) {
+            file.clear();
+            file.seekg(0);
+            buffer.clear();
+            end_of_file = false;
+            ReadBlock();
+        }
+    }
 
-        // Pre-process: parse each line with our quote-aware parser to strip quotes,
-        // then re-write with the same delimiter. read_csv loads with quote='' since
-        // the data is already clean.
-        {
-            std::string clean_csv;
-            clean_csv.reserve(csv_content.size());
-            std::istringstream stream(csv_content);
-            string line;
+    // The data read so far, cut to whole UTF-8 sequences (charset detection)
+    string Sample() const {
+        return end_of_file ? buffer : buffer.substr(0, Utf8CompleteLength(buffer));
+    }
 
-            while (std::getline(stream, line)) {
-                if (line.empty()) continue;
-                if (!line.empty() && line.back() == '\r') line.pop_back();
-                if (line.empty()) continue;
+    idx_t BytesRead() const {
+        return bytes_read;
+    }
 
-                auto fields = ParseCsvLine(line, delimiter);
+    // Free the buffer and its budget
+    void Close() {
+        if (file.is_open()) {
+            file.close();
+        }
+        string().swap(buffer);
+        position = 0;
+        if (reservation) {
+            reservation->Release();
+        }
+    }
 
-                for (size_t i = 0; i < normalized_cols.size(); i++) {
-                    if (i > 0) clean_csv += delimiter;
-                    if (i < fields.size()) {
-                        clean_csv += fields[i];
-                    }
-                }
-                clean_csv += '\n';
-            }
+private:
+    // Keep the unread bytes of the buffer and append the next block of the file
+    void ReadBlock() {
+        ::stps::shared::ScopedTimer timer("gobd.read.block");
+        buffer.erase(0, position);
+        position = 0;
+        size_t kept = buffer.size();
+        buffer.resize(kept + GOBD_READ_BLOCK_SIZE);
+        file.read(&buffer[kept], GOBD_READ_BLOCK_SIZE);
+        auto count = static_cast<size_t>(file.gcount());
+        buffer.resize(kept + count);
+        end_of_file = !file;
+        bytes_read += count;
+        timer.AddBytes(count);
+        // A record longer than a block grows the buffer past its reservation
+        if (buffer.size() > reservation->Reserved()) {
+            reservation->Resize(buffer.size());
+        }
+    }
 
-            std::ofstream out(temp_path, std::ios::binary);
-            if (out) {
-                out.write(clean_csv.data(), clean_csv.size());
-                out.close();
+    std::ifstream file;
+    unique_ptr<GobdLoadReservation> reservation;
+    // Unread bytes of the data; reused across blocks so it stops allocating after warm-up
+    string buffer;
+    size_t position = 0;
+    bool end_of_file = false;
+    idx_t bytes_read = 0;
+};
 
-                // Build columns={col1: 'VARCHAR', col2: 'VARCHAR', ...} for read_csv
-                string columns_spec = "{";
-                for (size_t i = 0; i < normalized_cols.size(); i++) {
-                    if (i > 0) columns_spec += ", ";
-                    columns_spec += EscapeStringLiteral(normalized_cols[i]) + ": 'VARCHAR'";
-                }
-                columns_spec += "}";
+// Write buffer size for the pre-processed temp CSV
+static constexpr idx_t GOBD_CLEAN_BUFFER_SIZE = 1 << 20;
+
+static constexpr const char *MANDANTENDATEN_TABLE = "mandantendaten";
+
+GobdImportPipeline::GobdImportPipeline(ClientContext &context_p, GobdImportData data_p, char delimiter_p,
+                                       bool overwrite_p, string schema_name_p, bool enrich_mandantendaten_p)
+    : context(context_p),
+      data(std::move(data_p)),
+      delimiter(delimiter_p),
+      overwrite(overwrite_p),
+      schema_name(std::move(schema_name_p)),
+      session(SessionPool::Acquire(context_p)),
+      conn(session.Conn()),
+      enrich_mandantendaten(enrich_mandantendaten_p) {
+    // Create schema if specified
+    if (!schema_name.empty()) {
+        escaped_schema = EscapeIdentifier(schema_name);
+        conn.Query("CREATE SCHEMA IF NOT EXISTS " + escaped_schema);
+    }
+    // The client master data is needed before any table it enriches
+    if (enrich_mandantendaten) {
+        std::stable_partition(data.tables.begin(), data.tables.end(), [](const GobdTable &table) {
+            return ToSnakeCase(table.name) == MANDANTENDATEN_TABLE;
+        });
+    }
+}
 
-                string delim_escaped = EscapeStringLiteral(string(1, delimiter));
-                string sql_path = EscapeStringLiteral(NormalizeSqlPath(temp_path));
+bool GobdImportPipeline::Next(GobdImportResult &result) {
+    if (next_table >= data.tables.size()) {
+        return false;
+    }
+    result = ImportTable(data.tables[next_table++]);
+    return true;
+}
 
-                string create_sql = "CREATE TABLE " + escaped_table +
-                                    " AS SELECT * FROM read_csv(" + sql_path +
-                                    ", delim=" + delim_escaped +
-                                    ", header=false, all_varchar=true, quote='', columns=" + columns_spec +
-                                    ", ignore_errors=true, null_padding=true)";
+void GobdImportPipeline::LoadMandantendaten(const string &escaped_table) {
+    auto md_result = conn.Query("SELECT * FROM " + escaped_table);
+    // Several rows (or none) would multiply (or empty) every table; those are left as imported
+    if (md_result->HasError() || md_result->RowCount() != 1) {
+        return;
+    }
+    constant_names = md_result->names;
+    for (idx_t i = 0; i < md_result->ColumnCount(); i++) {
+        constant_values.push_back(md_result->GetValue(i, 0));
+    }
+}
 
-                auto create_result = conn.Query(create_sql);
-                if (create_result && !create_result->HasError()) {
-                    bulk_loaded = true;
-                }
+GobdImportResult GobdImportPipeline::ImportTable(const GobdTable &table) {
+    // Quoted fields are unescaped into the arena
+    auto &arena = ::stps::shared::StringArena::ThreadLocal();
+
+    ::stps::shared::ScopedTimer table_timer("gobd.import");
+    GobdImportResult result;
+    result.rows_imported = 0;
+    result.columns_created = 0;
+    result.schema_name = schema_name;
+
+    // Get the data source for this table (read further down)
+    auto source_it = data.table_sources.find(table.url);
+    if (source_it == data.table_sources.end() || !source_it->second) {
+        result.table_name = ToSnakeCase(table.name);
+        result.error = "CSV content not found for table: " + table.name;
+        return result;
+    }
 
-                std::remove(temp_path.c_str());
-            }
-        }
+    // Normalize table name
+    string table_name = ToSnakeCase(table.name);
+    result.table_name = table_name;
+    string escaped_table = schema_name.empty()
+        ? EscapeIdentifier(table_name)
+        : escaped_schema + "." + EscapeIdentifier(table_name);
 
-        // Fallback: batched multi-row INSERT if read_csv failed
-        if (!bulk_loaded) {
-            // Create the table first
-            {
-                string create_sql = "CREATE TABLE " + escaped_table + " (";
-                for (size_t i = 0; i < normalized_cols.size(); i++) {
-                    if (i > 0) create_sql += ", ";
-                    create_sql += EscapeIdentifier(normalized_cols[i]) + " VARCHAR";
-                }
-                create_sql += ")";
+    // Normalize column names, handle duplicates
+    auto normalized_cols = NormalizeGobdColumnNames(table);
 
-                auto create_result = conn.Query(create_sql);
-                if (create_result->HasError()) {
-                    result.error = "Failed to create table: " + create_result->GetError();
-                    results.push_back(result);
-                    continue;
-                }
-            }
+    if (normalized_cols.empty()) {
+        result.error = "No columns found for table: " + table.name;
+        return result;
+    }
 
-            // Batched INSERT (1000 rows per statement instead of 1 row per statement)
-            std::istringstream stream(csv_content);
-            string line;
-            const size_t BATCH_SIZE = 1000;
-            string batch_sql;
-            size_t batch_count = 0;
+    // Numeric and Date columns are typed from the index while the CSV is parsed
+    auto plans = PlanGobdColumns(table);
 
-            string insert_prefix = "INSERT INTO " + escaped_table + " VALUES ";
+    // Mandantendaten columns the table lacks, in front of its own columns
+    string constant_select;
+    string constant_definitions;
+    if (table_name != MANDANTENDATEN_TABLE) {
+        for (idx_t i = 0; i < constant_names.size(); i++) {
+            if (std::find(normalized_cols.begin(), normalized_cols.end(), constant_names[i]) != normalized_cols.end()) {
+                continue;
+            }
+            auto &value = constant_values[i];
+            string literal = "CAST(" + value.ToSQLString() + " AS " + value.type().ToString() + ")";
+            constant_select += literal + " AS " + EscapeIdentifier(constant_names[i]) + ", ";
+            constant_definitions += EscapeIdentifier(constant_names[i]) + " " + value.type().ToString() +
+                                    " DEFAULT " + literal + ", ";
+        }
+    }
 
-            while (std::getline(stream, line)) {
-                if (line.empty()) continue;
-                if (!line.empty() && line.back() == '\r') line.pop_back();
-                if (line.empty()) continue;
+    // Check if table exists (an existing table is only dropped once the new data loaded)
+    bool drop_existing = false;
+    {
+        CatalogTableInfo existing;
+        InTransaction(conn, [&](ClientContext &conn_context) {
+            drop_existing = LookupTable(conn_context, schema_name, table_name, existing);
+        });
+        if (drop_existing && !overwrite) {
+            result.error = "Table already exists: " + table_name + " (use overwrite := true to replace)";
+            return result;
+        }
+    }
 
-                auto fields = ParseCsvLine(line, delimiter);
+    // Open the table's data only now, within the shared memory budget
+    GobdTableReader reader;
+    if (!reader.Open(context, source_it->second.get(), "") || reader.BytesRead() == 0) {
+        result.error = "CSV content not found for table: " + table.name;
+        return result;
+    }
+    // Fields are converted to UTF-8 as they are decoded, so fixed-width offsets stay in bytes
+    // of the declared charset. An undeclared charset is ANSI unless the data (or the first
+    // block of a file) is valid UTF-8.
+    auto sample = reader.Sample();
+    auto charset = GobdTableCharset(table, &sample);
+    string().swap(sample);
+    if (drop_existing) {
+        conn.Query("DROP TABLE IF EXISTS " + escaped_table);
+    }
 
-                if (batch_count > 0) batch_sql += ", ";
-                batch_sql += "(";
+    // Step 1+2: Pre-process CSV (strip quotes), then bulk load via read_csv
+    std::string temp_path = GenerateGobdTempFilename();
+    bool bulk_loaded = false;
+
+    // Pre-process: decode each record following the table's layout (delimited or fixed
+    // width), then re-write it as a plain ';'-separated CSV in which only fields that
+    // need it are quoted. Rows are streamed to the temp file through a fixed buffer
+    // instead of building a second copy of the table.
+    //
+    // A typed column with a value that does not convert is re-planned as VARCHAR and the
+    // table decoded once more, so no value is lost (VARCHAR fields always convert).
+    {
+        std::ofstream out;
+        bool decoded = false;
+        for (idx_t pass = 0; !decoded; pass++) {
+            if (pass > 0) {
+                reader.Rewind();
+            }
+            out.open(temp_path, std::ios::binary | std::ios::trunc);
+            if (!out) break;
+            ::stps::shared::ScopedTimer decode_timer("gobd.import.decode");
+            std::string clean_buffer;
+            clean_buffer.reserve(GOBD_CLEAN_BUFFER_SIZE + 4096);
+            GobdRecordDecoder decoder(table, delimiter, charset);
+            decoded = true;
+
+            while (reader.Next(decoder, arena, fields)) {
                 for (size_t i = 0; i < normalized_cols.size(); i++) {
-                    if (i > 0) batch_sql += ", ";
-                    if (i < fields.size() && !fields[i].empty()) {
-                        batch_sql += EscapeStringLiteral(fields[i]);
-                    } else {
-                        batch_sql += "NULL";
+                    if (i > 0) clean_buffer += ';';
+                    if (i < fields.size() && !AppendGobdField(clean_buffer, fields[i], plans[i])) {
+                        plans[i] = GobdColumnPlan();
+                        decoded = false;
                     }
                 }
-                batch_sql += ")";
-                batch_count++;
-
-                if (batch_count >= BATCH_SIZE) {
-                    conn.Query(insert_prefix + batch_sql);
-                    batch_sql.clear();
-                    batch_count = 0;
+                clean_buffer += '\n';
+                decode_timer.AddRows(1);
+                if (clean_buffer.size() >= GOBD_CLEAN_BUFFER_SIZE) {
+                    decode_timer.AddBytes(clean_buffer.size());
+                    out.write(clean_buffer.data(), clean_buffer.size());
+                    clean_buffer.clear();
                 }
+                arena.Reset();
+            }
+            decode_timer.AddBytes(clean_buffer.size());
+            out.write(clean_buffer.data(), clean_buffer.size());
+            out.close();
+            decode_timer.Stop();
+        }
+        if (decoded) {
+            // Build columns={col1: 'VARCHAR', col2: 'DECIMAL(18,2)', ...} for read_csv
+            string columns_spec = "{";
+            for (size_t i = 0; i < normalized_cols.size(); i++) {
+                if (i > 0) columns_spec += ", ";
+                columns_spec += EscapeStringLiteral(normalized_cols[i]) + ": " +
+                                EscapeStringLiteral(plans[i].type.ToString());
             }
+            columns_spec += "}";
+
+            string sql_path = EscapeStringLiteral(NormalizeSqlPath(temp_path));
+
+            string create_sql = "CREATE TABLE " + escaped_table +
+                                " AS SELECT " + constant_select + "* FROM read_csv(" + sql_path +
+                                ", delim=';', header=false, quote='\"', escape='\"', columns=" + columns_spec +
+                                ", null_padding=true)";
 
-            // Flush remaining rows
-            if (batch_count > 0) {
-                conn.Query(insert_prefix + batch_sql);
+            ::stps::shared::ScopedTimer read_csv_timer("gobd.import.read_csv");
+            auto create_result = conn.Query(create_sql);
+            if (create_result && !create_result->HasError()) {
+                bulk_loaded = true;
             }
+            read_csv_timer.Stop();
+
+            std::remove(temp_path.c_str());
         }
+    }
 
-        // Convert empty strings to NULL
+    // Fallback: batched multi-row INSERT if read_csv failed
+    if (!bulk_loaded) {
+        ::stps::shared::ScopedTimer insert_timer("gobd.import.insert");
+        // Create the table first
         {
-            string nullify_sql = "UPDATE " + escaped_table + " SET ";
+            string create_sql = "CREATE TABLE " + escaped_table + " (" + constant_definitions;
             for (size_t i = 0; i < normalized_cols.size(); i++) {
-                if (i > 0) nullify_sql += ", ";
-                string col_id = EscapeIdentifier(normalized_cols[i]);
-                nullify_sql += col_id + " = CASE WHEN " + col_id + " = '' THEN NULL ELSE " + col_id + " END";
+                if (i > 0) create_sql += ", ";
+                create_sql += EscapeIdentifier(normalized_cols[i]) + " " + plans[i].type.ToString();
             }
-            conn.Query(nullify_sql);
-        }
+            create_sql += ")";
 
-        // Get row count
-        {
-            auto count_result = conn.Query("SELECT COUNT(*) FROM " + escaped_table);
-            if (count_result && count_result->RowCount() > 0) {
-                result.rows_imported = count_result->GetValue(0, 0).GetValue<int64_t>();
+            auto create_result = conn.Query(create_sql);
+            if (create_result->HasError()) {
+                result.error = "Failed to create table: " + create_result->GetError();
+                return result;
             }
         }
 
-        // Step 3: Drop empty columns - single query checks all columns at once
-        {
-            vector<string> cols_to_drop;
+        // Batched INSERT (1000 rows per statement instead of 1 row per statement)
+        reader.Rewind();
+        GobdRecordDecoder decoder(table, delimiter, charset);
+        const size_t BATCH_SIZE = 1000;
+        string batch_sql;
+        size_t batch_count = 0;
+
+        // Columns listed: the mandantendaten columns take their defaults
+        string insert_prefix = "INSERT INTO " + escaped_table + " (";
+        for (size_t i = 0; i < normalized_cols.size(); i++) {
+            if (i > 0) insert_prefix += ", ";
+            insert_prefix += EscapeIdentifier(normalized_cols[i]);
+        }
+        insert_prefix += ") VALUES ";
+        string typed_value;
 
-            // Build one query that counts non-empty values for ALL columns
-            string check_sql = "SELECT ";
+        while (reader.Next(decoder, arena, fields)) {
+            if (batch_count > 0) batch_sql += ", ";
+            batch_sql += "(";
             for (size_t i = 0; i < normalized_cols.size(); i++) {
-                if (i > 0) check_sql += ", ";
-                check_sql += "COUNT(CASE WHEN " + EscapeIdentifier(normalized_cols[i]) +
-                             " IS NOT NULL AND " + EscapeIdentifier(normalized_cols[i]) +
-                             " <> '' THEN 1 END)";
-            }
-            check_sql += " FROM " + escaped_table;
-
-            auto check_result = conn.Query(check_sql);
-            if (check_result && !check_result->HasError() && check_result->RowCount() > 0) {
-                for (size_t i = 0; i < normalized_cols.size(); i++) {
-                    auto count_val = check_result->GetValue(i, 0).GetValue<int64_t>();
-                    if (count_val == 0) {
-                        cols_to_drop.push_back(normalized_cols[i]);
+                if (i > 0) batch_sql += ", ";
+                if (i < fields.size() && plans[i].type.id() != LogicalTypeId::VARCHAR) {
+                    // Canonical text of the typed value, cast by the INSERT
+                    typed_value.clear();
+                    if (!AppendGobdField(typed_value, fields[i], plans[i])) {
+                        // Left for the INSERT's cast to reject
+                        AppendStringLiteral(batch_sql, fields[i]);
+                    } else {
+                        batch_sql += typed_value.empty() ? "NULL" : "'" + typed_value + "'";
                     }
+                } else if (i < fields.size() && fields[i].GetSize() > 0) {
+                    AppendStringLiteral(batch_sql, fields[i]);
+                } else {
+                    batch_sql += "NULL";
                 }
             }
+            batch_sql += ")";
+            batch_count++;
+
+            if (batch_count >= BATCH_SIZE) {
+                auto insert_result = conn.Query(insert_prefix + batch_sql);
+                if (insert_result->HasError()) {
+                    result.error = "Failed to insert rows: " + insert_result->GetError();
+                    return result;
+                }
+                batch_sql.clear();
+                batch_count = 0;
+            }
+            arena.Reset();
+        }
 
-            for (auto &col_name : cols_to_drop) {
-                conn.Query("ALTER TABLE " + escaped_table + " DROP COLUMN " + EscapeIdentifier(col_name));
+        // Flush remaining rows
+        if (batch_count > 0) {
+            auto insert_result = conn.Query(insert_prefix + batch_sql);
+            if (insert_result->HasError()) {
+                result.error = "Failed to insert rows: " + insert_result->GetError();
+                return result;
             }
+        }
+    }
 
-            result.columns_created = static_cast<int32_t>(normalized_cols.size() - cols_to_drop.size());
+    // The data now lives in the table; free the buffer before the post-processing queries
+    table_timer.AddBytes(reader.BytesRead());
+    reader.Close();
+
+    // Convert empty strings to NULL (typed columns are NULL already)
+    ::stps::shared::ScopedTimer cleanup_timer("gobd.import.cleanup");
+    bool has_varchar = false;
+    {
+        string nullify_sql = "UPDATE " + escaped_table + " SET ";
+        for (size_t i = 0; i < normalized_cols.size(); i++) {
+            if (plans[i].type.id() != LogicalTypeId::VARCHAR) continue;
+            if (has_varchar) nullify_sql += ", ";
+            has_varchar = true;
+            string col_id = EscapeIdentifier(normalized_cols[i]);
+            nullify_sql += col_id + " = CASE WHEN " + col_id + " = '' THEN NULL ELSE " + col_id + " END";
+        }
+        if (has_varchar) {
+            conn.Query(nullify_sql);
         }
+    }
+
+    // Get row count
+    {
+        auto count_result = conn.Query("SELECT COUNT(*) FROM " + escaped_table);
+        if (count_result && count_result->RowCount() > 0) {
+            result.rows_imported = count_result->GetValue(0, 0).GetValue<int64_t>();
+        }
+    }
 
-        // Step 4: Smart cast types
-        if (result.rows_imported > 0) {
-            // stps_smart_cast needs schema-qualified name when using schemas
-            string smart_cast_arg = schema_name.empty()
-                ? EscapeStringLiteral(table_name)
-                : EscapeStringLiteral(schema_name + "." + table_name);
-            string cast_sql = "CREATE OR REPLACE TABLE " + escaped_table +
-                              " AS SELECT * FROM stps_smart_cast(" + smart_cast_arg + ")";
-            auto cast_result = conn.Query(cast_sql);
-            if (cast_result && cast_result->HasError()) {
-                // Smart cast failed - keep VARCHAR table, not a fatal error
+    // Step 3: Drop empty columns - single query checks all columns at once
+    {
+        vector<string> cols_to_drop;
+
+        // Build one query that counts non-empty values for ALL columns
+        string check_sql = "SELECT ";
+        for (size_t i = 0; i < normalized_cols.size(); i++) {
+            if (i > 0) check_sql += ", ";
+            if (plans[i].type.id() != LogicalTypeId::VARCHAR) {
+                check_sql += "COUNT(" + EscapeIdentifier(normalized_cols[i]) + ")";
+                continue;
             }
+            check_sql += "COUNT(CASE WHEN " + EscapeIdentifier(normalized_cols[i]) +
+                         " IS NOT NULL AND " + EscapeIdentifier(normalized_cols[i]) +
+                         " <> '' THEN 1 END)";
         }
+        check_sql += " FROM " + escaped_table;
 
-        results.push_back(result);
+        auto check_result = conn.Query(check_sql);
+        if (check_result && !check_result->HasError() && check_result->RowCount() > 0) {
+            for (size_t i = 0; i < normalized_cols.size(); i++) {
+                auto count_val = check_result->GetValue(i, 0).GetValue<int64_t>();
+                if (count_val == 0) {
+                    cols_to_drop.push_back(normalized_cols[i]);
+                }
+            }
+        }
+
+        for (auto &col_name : cols_to_drop) {
+            conn.Query("ALTER TABLE " + escaped_table + " DROP COLUMN " + EscapeIdentifier(col_name));
+        }
+
+        result.columns_created = static_cast<int32_t>(normalized_cols.size() - cols_to_drop.size());
+    }
+    cleanup_timer.Stop();
+    table_timer.AddRows(static_cast<uint64_t>(result.rows_imported));
+
+    // Step 4: Smart cast the remaining AlphaNumeric (VARCHAR) columns; typed columns pass through
+    if (result.rows_imported > 0 && has_varchar) {
+        ::stps::shared::ScopedTimer smart_cast_timer("gobd.import.smart_cast");
+        // stps_smart_cast needs schema-qualified name when using schemas
+        string smart_cast_arg = schema_name.empty()
+            ? EscapeStringLiteral(table_name)
+            : EscapeStringLiteral(schema_name + "." + table_name);
+        string cast_sql = "CREATE OR REPLACE TABLE " + escaped_table +
+                          " AS SELECT * FROM stps_smart_cast(" + smart_cast_arg + ")";
+        auto cast_result = conn.Query(cast_sql);
+        if (cast_result && cast_result->HasError()) {
+            // Smart cast failed - keep VARCHAR table, not a fatal error
+        }
     }
 
+    // Step 5: Record declared foreign keys as column comments ("REFERENCES table(column)").
+    // They stay metadata rather than constraints: DuckDB cannot add a FOREIGN KEY to an
+    // existing table, and exports are not guaranteed to be referentially complete.
+    for (auto &fk : table.foreign_keys) {
+        string referenced_table = ToSnakeCase(fk.references);
+        for (size_t k = 0; k < fk.columns.size(); k++) {
+            auto col_it = std::find_if(table.columns.begin(), table.columns.end(),
+                                       [&](const GobdColumn &col) { return col.name == fk.columns[k]; });
+            if (col_it == table.columns.end()) continue;
+            string referenced_column = ToSnakeCase(k < fk.aliases.size() ? fk.aliases[k] : fk.columns[k]);
+            string comment = "REFERENCES " + referenced_table + "(" + referenced_column + ")";
+            // Fails harmlessly if the column was dropped as empty
+            conn.Query("COMMENT ON COLUMN " + escaped_table + "." +
+                       EscapeIdentifier(normalized_cols[col_it - table.columns.begin()]) +
+                       " IS " + EscapeStringLiteral(comment));
+        }
+    }
+
+    if (enrich_mandantendaten && table_name == MANDANTENDATEN_TABLE) {
+        LoadMandantendaten(escaped_table);
+    }
+    return result;
+}
+
+vector<GobdImportResult> ExecuteGobdImportPipeline(ClientContext &context,
+                                                    const GobdImportData &data,
+                                                    char delimiter,
+                                                    bool overwrite,
+                                                    const string &schema_name,
+                                                    bool enrich_mandantendaten) {
+    vector<GobdImportResult> results;
+    GobdImportPipeline pipeline(context, data, delimiter, overwrite, schema_name, enrich_mandantendaten);
+    GobdImportResult result;
+    while (pipeline.Next(result)) {
+        results.push_back(result);
+    }
     return results;
 }
 
@@ -708,7 +1654,10 @@ struct GobdReaderBindData : public TableFunctionData {
     string table_name;
     char delimiter;
     string csv_path;
+    shared_ptr<GobdTableSource> source;  // Instead of csv_path (export scans)
+    GobdTable table;
     vector<string> column_names;
+    vector<GobdColumnPlan> plans;
     idx_t column_count;
 
     GobdReaderBindData(string index_path_p, string table_name_p, char delimiter_p)
@@ -719,10 +1668,12 @@ struct GobdReaderBindData : public TableFunctionData {
 };
 
 struct GobdReaderGlobalState : public GlobalTableFunctionState {
-    std::shared_ptr<std::ifstream> file;
+    GobdTableReader reader;
     bool finished = false;
     idx_t column_count = 0;
-    char delimiter = ';';
+    const vector<GobdColumnPlan> *plans = nullptr;
+    unique_ptr<GobdRecordDecoder> decoder;
+    vector<string_t> fields;
 
     idx_t MaxThreads() const override {
         return 1;
@@ -732,6 +1683,7 @@ struct GobdReaderGlobalState : public GlobalTableFunctionState {
 static unique_ptr<FunctionData> GobdReaderBind(ClientContext &context, TableFunctionBindInput &input,
                                                 vector<LogicalType> &return_types, vector<string> &names) {
     char delimiter = ';';
+    bool all_varchar = false;
 
     for (auto &kv : input.named_parameters) {
         if (kv.first == "delimiter") {
@@ -739,6 +1691,8 @@ static unique_ptr<FunctionData> GobdReaderBind(ClientContext &context, TableFunc
             if (!delim_str.empty()) {
                 delimiter = delim_str[0];
             }
+        } else if (kv.first == "all_varchar") {
+            all_varchar = BooleanValue::Get(kv.second);
         }
     }
 
@@ -783,12 +1737,15 @@ static unique_ptr<FunctionData> GobdReaderBind(ClientContext &context, TableFunc
     // Build CSV path
     string index_dir = GetDirectory(result->index_path);
     result->csv_path = index_dir + "/" + found_table->url;
-
-    // Build column names - all VARCHAR
-    for (const auto &col : found_table->columns) {
-        result->column_names.push_back(col.name);
-        names.push_back(col.name);
-        return_types.push_back(LogicalType::VARCHAR);
+    result->table = *found_table;
+
+    // Column types follow the index (Numeric -> DECIMAL(18, Accuracy), DOUBLE without an
+    // Accuracy of 0-18; Date -> DATE; else VARCHAR)
+    result->plans = PlanGobdColumns(*found_table, all_varchar);
+    for (idx_t i = 0; i < found_table->columns.size(); i++) {
+        result->column_names.push_back(found_table->columns[i].name);
+        names.push_back(found_table->columns[i].name);
+        return_types.push_back(result->plans[i].type);
     }
     result->column_count = result->column_names.size();
 
@@ -799,13 +1756,18 @@ static unique_ptr<GlobalTableFunctionState> GobdReaderInit(ClientContext &contex
     auto &bind_data = input.bind_data->Cast<GobdReaderBindData>();
     auto result = make_uniq<GobdReaderGlobalState>();
 
-    result->file = std::make_shared<std::ifstream>(bind_data.csv_path);
-    if (!result->file->is_open()) {
-        throw IOException("Cannot open CSV file: " + bind_data.csv_path);
+    // Local files are streamed in blocks; other sources are loaded whole within the budget
+    if (!result->reader.Open(context, bind_data.source.get(), bind_data.csv_path)) {
+        throw IOException(bind_data.source ? "CSV content not found for table: " + bind_data.table_name
+                                           : "Cannot open CSV file: " + bind_data.csv_path);
     }
 
+    // An undeclared charset is ANSI unless the data (or the first block of a file) is valid UTF-8
+    auto sample = result->reader.Sample();
     result->column_count = bind_data.column_count;
-    result->delimiter = bind_data.delimiter;
+    result->plans = &bind_data.plans;
+    result->decoder = make_uniq<GobdRecordDecoder>(bind_data.table, bind_data.delimiter,
+                                                   GobdTableCharset(bind_data.table, &sample));
 
     return std::move(result);
 }
@@ -813,42 +1775,25 @@ static unique_ptr<GlobalTableFunctionState> GobdReaderInit(ClientContext &contex
 static void GobdReaderFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
     auto &state = data_p.global_state->Cast<GobdReaderGlobalState>();
 
-    if (state.finished || !state.file || !state.file->is_open()) {
+    if (state.finished) {
         output.SetCardinality(0);
         return;
     }
 
     idx_t count = 0;
-    string line;
-
-    while (count < STANDARD_VECTOR_SIZE && std::getline(*state.file, line)) {
-        // Skip empty lines
-        if (line.empty()) continue;
+    auto &arena = ::stps::shared::StringArena::ThreadLocal();
 
-        // Remove trailing \r if present (Windows line endings)
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
-        }
-
-        auto fields = ParseCsvLine(line, state.delimiter);
-
-        // Set values for each column
-        for (idx_t col = 0; col < state.column_count; col++) {
-            if (col < fields.size()) {
-                output.SetValue(col, count, Value(fields[col]));
-            } else {
-                output.SetValue(col, count, Value());  // NULL for missing fields
-            }
+    while (count < STANDARD_VECTOR_SIZE) {
+        arena.Reset();
+        if (!state.reader.Next(*state.decoder, arena, state.fields)) {
+            state.finished = true;
+            state.reader.Close();
+            break;
         }
-
+        WriteGobdFields(output, count, state.fields, *state.plans);
         count++;
     }
 
-    if (count == 0 || state.file->eof()) {
-        state.finished = true;
-        state.file->close();
-    }
-
     output.SetCardinality(count);
 }
 
@@ -922,7 +1867,7 @@ struct GobdSchemaBindData : public TableFunctionData {
 };
 
 struct GobdSchemaGlobalState : public GlobalTableFunctionState {
-    vector<GobdColumn> columns;
+    GobdTable table;
     idx_t offset = 0;
     idx_t MaxThreads() const override { return 1; }
 };
@@ -939,6 +1884,10 @@ static unique_ptr<FunctionData> GobdSchemaBind(ClientContext &context, TableFunc
     return_types.emplace_back(LogicalType::INTEGER);
     names.emplace_back("column_order");
     return_types.emplace_back(LogicalType::INTEGER);
+    names.emplace_back("primary_key");
+    return_types.emplace_back(LogicalType::BOOLEAN);
+    names.emplace_back("references");
+    return_types.emplace_back(LogicalType::VARCHAR);
 
     return std::move(result);
 }
@@ -950,7 +1899,7 @@ static unique_ptr<GlobalTableFunctionState> GobdSchemaInit(ClientContext &contex
     auto tables = ParseGobdIndex(bind_data.index_path);
     for (auto &t : tables) {
         if (t.name == bind_data.table_name) {
-            result->columns = t.columns;
+            result->table = t;
             break;
         }
     }
@@ -962,13 +1911,16 @@ static void GobdSchemaFunction(ClientContext &context, TableFunctionInput &data_
     auto &state = data_p.global_state->Cast<GobdSchemaGlobalState>();
 
     idx_t count = 0;
-    while (state.offset < state.columns.size() && count < STANDARD_VECTOR_SIZE) {
-        auto &col = state.columns[state.offset];
+    while (state.offset < state.table.columns.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &col = state.table.columns[state.offset];
+        string references = GobdColumnReference(state.table, col);
 
         output.SetValue(0, count, Value(col.name));
         output.SetValue(1, count, Value(col.data_type));
         output.SetValue(2, count, col.accuracy >= 0 ? Value::INTEGER(col.accuracy) : Value());
         output.SetValue(3, count, Value::INTEGER(col.order));
+        output.SetValue(4, count, Value::BOOLEAN(col.primary_key));
+        output.SetValue(5, count, references.empty() ? Value() : Value(references));
 
         state.offset++;
         count++;
@@ -1015,19 +1967,12 @@ static unique_ptr<FunctionData> GobdReadAllBind(ClientContext &context, TableFun
 
     string index_dir = GetDirectory(index_path);
 
-    // Build import data: read each CSV file from disk
+    // Build import data: each CSV file is read when the pipeline reaches its table
     GobdImportData import_data;
     import_data.tables = tables;
 
     for (auto &table : tables) {
-        string csv_path = index_dir + "/" + table.url;
-        std::ifstream file(csv_path);
-        if (file.is_open()) {
-            std::stringstream buf;
-            buf << file.rdbuf();
-            import_data.csv_contents[table.url] = buf.str();
-            file.close();
-        }
+        import_data.table_sources[table.url] = MakeGobdFileSource(index_dir + "/" + table.url);
     }
 
     // Execute the shared pipeline
@@ -1070,6 +2015,404 @@ static void GobdReadAllFunction(ClientContext &context, TableFunctionInput &data
     output.SetCardinality(count);
 }
 
+// ============ stps_gobd_to_parquet ============
+
+// Table handed to the export scan function. COPY can only read from a query, so the table
+// is put into the client context state of the connection that runs the COPY, and the scan
+// (an internal function without arguments) takes it from there at bind time.
+class GobdExportState : public ClientContextState {
+public:
+    GobdExportState(GobdTable table_p, shared_ptr<GobdTableSource> source_p, char delimiter_p,
+                    vector<GobdColumnPlan> plans_p)
+        : table(std::move(table_p)), source(std::move(source_p)), delimiter(delimiter_p), plans(std::move(plans_p)) {
+    }
+
+    GobdTable table;
+    shared_ptr<GobdTableSource> source;
+    char delimiter;
+    vector<GobdColumnPlan> plans;
+};
+
+static constexpr const char *GOBD_EXPORT_STATE = "stps_gobd_export";
+
+// __stps_gobd_export_scan(): the table of the running export, typed and with snake_case names
+static unique_ptr<FunctionData> GobdExportScanBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+    auto entry = context.registered_state->Get<GobdExportState>(GOBD_EXPORT_STATE);
+    if (!entry) {
+        throw BinderException("__stps_gobd_export_scan is only used by the *_to_parquet functions");
+    }
+
+    auto result = make_uniq<GobdReaderBindData>("", entry->table.name, entry->delimiter);
+    result->source = entry->source;
+    result->table = entry->table;
+    result->plans = entry->plans;
+    result->column_names = NormalizeGobdColumnNames(entry->table);
+    for (idx_t i = 0; i < result->column_names.size(); i++) {
+        names.push_back(result->column_names[i]);
+        return_types.push_back(result->plans[i].type);
+    }
+    result->column_count = result->column_names.size();
+
+    return std::move(result);
+}
+
+bool ParseGobdParquetOption(const string &name, const Value &value, GobdParquetOptions &options) {
+    if (name == "delimiter") {
+        string delim_str = StringValue::Get(value);
+        if (!delim_str.empty()) {
+            options.delimiter = delim_str[0];
+        }
+    } else if (name == "row_group_size") {
+        auto row_group_size = BigIntValue::Get(value);
+        if (row_group_size <= 0) {
+            throw BinderException("row_group_size must be positive");
+        }
+        options.row_group_size = static_cast<idx_t>(row_group_size);
+    } else if (name == "compression") {
+        options.compression = StringValue::Get(value);
+    } else if (name == "threads") {
+        options.threads = static_cast<idx_t>(MaxValue<int32_t>(IntegerValue::Get(value), 0));
+    } else if (name == "overwrite") {
+        options.overwrite = BooleanValue::Get(value);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void AddGobdParquetParameters(TableFunction &function) {
+    function.named_parameters["delimiter"] = LogicalType::VARCHAR;
+    function.named_parameters["row_group_size"] = LogicalType::BIGINT;
+    function.named_parameters["compression"] = LogicalType::VARCHAR;
+    function.named_parameters["threads"] = LogicalType::INTEGER;
+    function.named_parameters["overwrite"] = LogicalType::BOOLEAN;
+}
+
+// Create path and its missing parents
+static void CreateGobdDirectories(FileSystem &fs, const string &path) {
+    for (size_t pos = path.find_first_of("/\\", 1); ; pos = path.find_first_of("/\\", pos + 1)) {
+        string prefix = path.substr(0, pos);
+        if (!prefix.empty() && prefix.back() != ':' && !fs.DirectoryExists(prefix)) {
+            fs.CreateDirectory(prefix);
+        }
+        if (pos == string::npos) break;
+    }
+}
+
+static void AppendJsonString(string &json, const string &value) {
+    json += '"';
+    for (char c : value) {
+        if (c == '"') json += "\\\"";
+        else if (c == '\\') json += "\\\\";
+        else if (c == '\n') json += "\\n";
+        else if (c == '\r') json += "\\r";
+        else if (c == '\t') json += "\\t";
+        else json += c;
+    }
+    json += '"';
+}
+
+// manifest.json: one entry per table with its file, row count and column schema
+static void WriteGobdParquetManifest(FileSystem &fs, const string &target_dir, const GobdImportData &data,
+                                     const vector<GobdParquetResult> &results, const GobdParquetOptions &options) {
+    string json = "{\n  \"row_group_size\": " + std::to_string(options.row_group_size) + ",\n  \"compression\": ";
+    AppendJsonString(json, options.compression);
+    json += ",\n  \"tables\": [";
+    for (idx_t i = 0; i < results.size(); i++) {
+        auto &table = data.tables[i];
+        auto &result = results[i];
+        json += i > 0 ? ",\n    {" : "\n    {";
+        json += "\"table\": ";
+        AppendJsonString(json, result.table_name);
+        json += ", \"source_table\": ";
+        AppendJsonString(json, table.name);
+        json += ", \"file\": ";
+        AppendJsonString(json, result.table_name + ".parquet");
+        json += ", \"rows\": " + std::to_string(result.rows_written);
+        json += ", \"error\": ";
+        if (result.error.empty()) {
+            json += "null";
+        } else {
+            AppendJsonString(json, result.error);
+        }
+        json += ", \"columns\": [";
+        auto names = NormalizeGobdColumnNames(table);
+        auto plans = PlanGobdColumns(table);
+        for (idx_t c = 0; c < names.size(); c++) {
+            json += c > 0 ? ", {\"name\": " : "{\"name\": ";
+            AppendJsonString(json, names[c]);
+            json += ", \"type\": ";
+            auto &type = c < result.column_types.size() ? result.column_types[c] : plans[c].type;
+            AppendJsonString(json, type.ToString());
+            json += ", \"source_name\": ";
+            AppendJsonString(json, table.columns[c].name);
+            json += "}";
+        }
+        json += "]}";
+    }
+    json += "\n  ]\n}\n";
+
+    auto path = fs.JoinPath(target_dir, "manifest.json");
+    if (fs.FileExists(path)) {
+        // Checked before the export started unless overwrite is set
+        fs.RemoveFile(path);
+    }
+    auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+    handle->Write(const_cast<char *>(json.data()), json.size());
+    handle->Sync();
+}
+
+// Re-plan as VARCHAR every typed column of table with a value that does not convert (one
+// decoding pass over the data); returns false if all values convert
+static bool FallBackGobdColumns(ClientContext &context, const GobdTable &table, GobdTableSource &source,
+                                char delimiter, vector<GobdColumnPlan> &plans) {
+    auto &arena = ::stps::shared::StringArena::ThreadLocal();
+    GobdTableReader reader;
+    if (!reader.Open(context, &source, "")) {
+        return false;
+    }
+    auto sample = reader.Sample();
+    GobdRecordDecoder decoder(table, delimiter, GobdTableCharset(table, &sample));
+    vector<string_t> fields;
+    string scratch;
+    bool changed = false;
+    while (reader.Next(decoder, arena, fields)) {
+        for (idx_t i = 0; i < plans.size() && i < fields.size(); i++) {
+            if (plans[i].type.id() == LogicalTypeId::VARCHAR) continue;
+            scratch.clear();
+            if (!AppendGobdField(scratch, fields[i], plans[i])) {
+                plans[i] = GobdColumnPlan();
+                changed = true;
+            }
+        }
+        arena.Reset();
+    }
+    return changed;
+}
+
+// COPY one table through the export scan into its Parquet file. When a value does not
+// convert to its column's type, the partial file is removed and the table written again
+// with such columns as VARCHAR.
+static void ExportGobdTable(Connection &conn, FileSystem &fs, const GobdTable &table,
+                            const shared_ptr<GobdTableSource> &source, const GobdParquetOptions &options,
+                            GobdParquetResult &result) {
+    if (!source) {
+        result.error = "CSV content not found for table: " + table.name;
+        return;
+    }
+    if (table.columns.empty()) {
+        result.error = "No columns found for table: " + table.name;
+        return;
+    }
+    if (!options.overwrite && fs.FileExists(result.file_path)) {
+        result.error = "File already exists: " + result.file_path + " (use overwrite := true to replace)";
+        return;
+    }
+
+    auto &registered_state = *conn.context->registered_state;
+    ::stps::shared::ScopedTimer timer("gobd.export");
+
+    string copy_sql = "COPY (SELECT * FROM __stps_gobd_export_scan()) TO " +
+                      EscapeStringLiteral(NormalizeSqlPath(result.file_path)) +
+                      " (FORMAT parquet, ROW_GROUP_SIZE " + std::to_string(options.row_group_size) +
+                      ", COMPRESSION " + EscapeStringLiteral(options.compression) + ")";
+    auto plans = PlanGobdColumns(table);
+    for (bool fell_back = false;; fell_back = true) {
+        registered_state.Insert(GOBD_EXPORT_STATE,
+                                make_shared_ptr<GobdExportState>(table, source, options.delimiter, plans));
+        unique_ptr<MaterializedQueryResult> copy_result;
+        try {
+            copy_result = conn.Query(copy_sql);
+        } catch (...) {
+            registered_state.Remove(GOBD_EXPORT_STATE);
+            throw;
+        }
+        registered_state.Remove(GOBD_EXPORT_STATE);
+
+        if (copy_result && !copy_result->HasError()) {
+            if (copy_result->RowCount() > 0) {
+                result.rows_written = copy_result->GetValue(0, 0).GetValue<int64_t>();
+                timer.AddRows(static_cast<uint64_t>(result.rows_written));
+            }
+            break;
+        }
+        // No partial file is left behind
+        if (fs.FileExists(result.file_path)) {
+            fs.RemoveFile(result.file_path);
+        }
+        if (fell_back || !FallBackGobdColumns(*conn.context, table, *source, options.delimiter, plans)) {
+            result.error = copy_result ? copy_result->GetError() : "COPY failed";
+            break;
+        }
+    }
+    for (auto &plan : plans) {
+        result.column_types.push_back(plan.type);
+    }
+}
+
+// Tables of one export, claimed one at a time by the export tasks
+struct GobdExportJob {
+    GobdExportJob(ClientContext &context_p, FileSystem &fs_p, const GobdImportData &data_p,
+                  const GobdParquetOptions &options_p, vector<GobdParquetResult> &results_p)
+        : context(context_p), fs(fs_p), data(data_p), options(options_p), results(results_p) {
+    }
+
+    // Export tables until none is left, each COPY on the task's own pooled connection
+    void Run() {
+        auto session = SessionPool::Acquire(context);
+        auto &conn = session.Conn();
+        for (idx_t i = next_table++; i < data.tables.size(); i = next_table++) {
+            auto &table = data.tables[i];
+            auto source_it = data.table_sources.find(table.url);
+            try {
+                ExportGobdTable(conn, fs, table, source_it == data.table_sources.end() ? nullptr : source_it->second,
+                                options, results[i]);
+            } catch (std::exception &ex) {
+                results[i].error = ex.what();
+            }
+        }
+    }
+
+    ClientContext &context;
+    FileSystem &fs;
+    const GobdImportData &data;
+    const GobdParquetOptions &options;
+    vector<GobdParquetResult> &results;
+    std::atomic<idx_t> next_table {0};
+};
+
+class GobdExportTask : public BaseExecutorTask {
+public:
+    GobdExportTask(TaskExecutor &executor, GobdExportJob &job_p) : BaseExecutorTask(executor), job(job_p) {
+    }
+
+    void ExecuteTask() override {
+        job.Run();
+    }
+
+private:
+    GobdExportJob &job;
+};
+
+vector<GobdParquetResult> ExecuteGobdParquetExport(ClientContext &context, const GobdImportData &data,
+                                                   const string &target_dir, const GobdParquetOptions &options) {
+    auto &fs = FileSystem::GetFileSystem(context);
+    auto manifest_path = fs.JoinPath(target_dir, "manifest.json");
+    if (!options.overwrite && fs.FileExists(manifest_path)) {
+        throw InvalidInputException("File already exists: " + manifest_path + " (use overwrite := true to replace)");
+    }
+    CreateGobdDirectories(fs, target_dir);
+
+    // File names: snake_case table names, unique within the export
+    vector<GobdParquetResult> results(data.tables.size());
+    std::set<string> used_names;
+    for (idx_t i = 0; i < data.tables.size(); i++) {
+        string name = ToSnakeCase(data.tables[i].name);
+        string base_name = name;
+        int suffix = 2;
+        while (used_names.count(name)) {
+            name = base_name + "_" + std::to_string(suffix++);
+        }
+        used_names.insert(name);
+        results[i].table_name = name;
+        results[i].file_path = fs.JoinPath(target_dir, name + ".parquet");
+    }
+
+    // Tables are exported in parallel on the scheduler's threads (this one included), each
+    // COPY on its own connection; their reads share the memory budget, so a large loaded
+    // table holds back the next one
+    idx_t threads = options.threads;
+    if (threads == 0) {
+        threads = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+    }
+    threads = MaxValue<idx_t>(1, MinValue<idx_t>(threads, data.tables.size()));
+
+    GobdExportJob job(context, fs, data, options, results);
+    TaskExecutor executor(context);
+    for (idx_t t = 0; t < threads; t++) {
+        executor.ScheduleTask(make_uniq<GobdExportTask>(executor, job));
+    }
+    executor.WorkOnTasks();
+
+    WriteGobdParquetManifest(fs, target_dir, data, results, options);
+    return results;
+}
+
+struct GobdToParquetBindData : public TableFunctionData {
+    vector<GobdParquetResult> results;
+};
+
+struct GobdToParquetGlobalState : public GlobalTableFunctionState {
+    idx_t offset = 0;
+    idx_t MaxThreads() const override { return 1; }
+};
+
+void GobdParquetResultSchema(vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("table_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("file_path");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("rows_written");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("error");
+    return_types.emplace_back(LogicalType::VARCHAR);
+}
+
+void WriteGobdParquetResults(const vector<GobdParquetResult> &results, idx_t &offset, DataChunk &output) {
+    idx_t count = 0;
+    while (offset < results.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &r = results[offset];
+        output.SetValue(0, count, Value(r.table_name));
+        output.SetValue(1, count, Value(r.file_path));
+        output.SetValue(2, count, Value::BIGINT(r.rows_written));
+        output.SetValue(3, count, r.error.empty() ? Value() : Value(r.error));
+        offset++;
+        count++;
+    }
+    output.SetCardinality(count);
+}
+
+static unique_ptr<FunctionData> GobdToParquetBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<GobdToParquetBindData>();
+
+    string index_path = input.inputs[0].ToString();
+    string target_dir = input.inputs[1].ToString();
+    GobdParquetOptions options;
+    for (auto &kv : input.named_parameters) {
+        ParseGobdParquetOption(kv.first, kv.second, options);
+    }
+
+    auto tables = ParseGobdIndex(index_path);
+    if (tables.empty()) {
+        throw BinderException("No tables found in GoBD index: " + index_path);
+    }
+
+    // Local files are streamed by the export scan, never loaded whole
+    string index_dir = GetDirectory(index_path);
+    GobdImportData export_data;
+    export_data.tables = tables;
+    for (auto &table : tables) {
+        export_data.table_sources[table.url] = MakeGobdFileSource(index_dir + "/" + table.url);
+    }
+
+    result->results = ExecuteGobdParquetExport(context, export_data, target_dir, options);
+    GobdParquetResultSchema(return_types, names);
+
+    return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> GobdToParquetInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<GobdToParquetGlobalState>();
+}
+
+static void GobdToParquetFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<GobdToParquetBindData>();
+    auto &state = data_p.global_state->Cast<GobdToParquetGlobalState>();
+    WriteGobdParquetResults(bind_data.results, state.offset, output);
+}
+
 // ============ Registration ============
 
 void RegisterGobdReaderFunctions(ExtensionLoader &loader) {
@@ -1080,6 +2423,7 @@ void RegisterGobdReaderFunctions(ExtensionLoader &loader) {
 
     read_gobd.cardinality = GobdReaderCardinality;
     read_gobd.named_parameters["delimiter"] = LogicalType::VARCHAR;
+    read_gobd.named_parameters["all_varchar"] = LogicalType::BOOLEAN;
 
     CreateTableFunctionInfo read_gobd_info(read_gobd);
     loader.RegisterFunction(read_gobd_info);
@@ -1110,6 +2454,24 @@ void RegisterGobdReaderFunctions(ExtensionLoader &loader) {
 
     CreateTableFunctionInfo schema_info(table_schema);
     loader.RegisterFunction(schema_info);
+
+    // __stps_gobd_export_scan(): internal source of the Parquet COPY
+    TableFunction export_scan("__stps_gobd_export_scan", {}, GobdReaderFunction, GobdExportScanBind,
+                              GobdReaderInit);
+
+    CreateTableFunctionInfo export_scan_info(export_scan);
+    export_scan_info.internal = true;
+    loader.RegisterFunction(export_scan_info);
+
+    // stps_gobd_to_parquet(index_path, target_dir, delimiter=';', row_group_size, compression, threads, overwrite)
+    TableFunction to_parquet("stps_gobd_to_parquet",
+                            {LogicalType::VARCHAR, LogicalType::VARCHAR},
+                            GobdToParquetFunction, GobdToParquetBind, GobdToParquetInit);
+
+    AddGobdParquetParameters(to_parquet);
+
+    CreateTableFunctionInfo to_parquet_info(to_parquet);
+    loader.RegisterFunction(to_parquet_info);
 }
 
 } // namespace stps
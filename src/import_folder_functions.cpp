@@ -1,6 +1,9 @@
 #include "import_folder_functions.hpp"
 #include "gobd_reader.hpp"
 #include "shared/archive_utils.hpp"
+#include "shared/profiler.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include "case_transform.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
@@ -8,6 +11,7 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
@@ -169,6 +173,14 @@ static ReaderOptions ParseReaderOptions(const named_parameter_map_t &params) {
     return opts;
 }
 
+// Look up a table as seen by the import connection: its DDL is not visible yet in the
+// calling transaction
+static bool LookupImportedTable(Connection &conn, const string &table_name, CatalogTableInfo &info) {
+    bool found = false;
+    InTransaction(conn, [&](ClientContext &context) { found = LookupTable(context, "", table_name, info); });
+    return found;
+}
+
 // ============================================================================
 // Core import logic for a single file
 // ============================================================================
@@ -179,9 +191,11 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
                                           const ReaderOptions &opts = ReaderOptions()) {
     ImportFileResult result;
     result.file_name = file_name;
+    ::stps::shared::ScopedTimer file_timer("import_folder.file");
 
     try {
-        Connection conn(context.db->GetDatabase(context));
+        auto session = SessionPool::Acquire(context);
+        auto &conn = session.Conn();
 
         // 1. Determine file type
         string ext = GetFileExtension(file_name);
@@ -216,9 +230,8 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
 
         // 3. Handle overwrite
         {
-            auto check = conn.Query("SELECT 1 FROM information_schema.tables WHERE table_name = " +
-                                    EscapeStringLiteral(table_name) + " LIMIT 1");
-            if (check && check->RowCount() > 0) {
+            CatalogTableInfo existing;
+            if (LookupImportedTable(conn, table_name, existing)) {
                 if (overwrite) {
                     conn.Query("DROP TABLE IF EXISTS " + escaped_table);
                 } else {
@@ -241,11 +254,14 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
         string actual_file_path = file_path;
         string temp_utf8_path;
         if (ext == "csv" || ext == "tsv") {
+            ::stps::shared::ScopedTimer encoding_timer("import_folder.file.encoding");
             std::ifstream ifs(file_path, std::ios::binary);
             if (ifs) {
                 std::string raw_content((std::istreambuf_iterator<char>(ifs)),
                                          std::istreambuf_iterator<char>());
                 ifs.close();
+                encoding_timer.AddBytes(raw_content.size());
+                file_timer.AddBytes(raw_content.size());
                 if (!IsValidUtf8(raw_content)) {
                     std::string utf8_content = ConvertWindows1252ToUtf8(raw_content);
                     temp_utf8_path = GenerateImportTempPath(file_name);
@@ -301,7 +317,9 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
             return result;
         }
 
+        ::stps::shared::ScopedTimer read_timer("import_folder.file.read");
         auto create_result = conn.Query(create_sql);
+        read_timer.Stop();
 
         // Cleanup temp UTF-8 file if created
         if (!temp_utf8_path.empty()) {
@@ -335,16 +353,11 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
         }
 
         // 9. Rename columns to snake_case
+        ::stps::shared::ScopedTimer cleanup_timer("import_folder.file.cleanup");
         {
-            vector<string> original_cols;
-            auto cols_result = conn.Query(
-                "SELECT column_name FROM information_schema.columns WHERE table_name = " +
-                EscapeStringLiteral(table_name) + " ORDER BY ordinal_position");
-            if (cols_result && !cols_result->HasError()) {
-                for (idx_t i = 0; i < cols_result->RowCount(); i++) {
-                    original_cols.push_back(cols_result->GetValue(0, i).ToString());
-                }
-            }
+            CatalogTableInfo imported;
+            LookupImportedTable(conn, table_name, imported);
+            const auto &original_cols = imported.column_names;
 
             std::set<string> used_col_names;
             for (auto &col : original_cols) {
@@ -365,15 +378,9 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
 
         // 10. Drop empty columns (skip when all_columns=true)
         if (!opts.all_columns) {
-            vector<string> current_cols;
-            auto cols_result = conn.Query(
-                "SELECT column_name FROM information_schema.columns WHERE table_name = " +
-                EscapeStringLiteral(table_name) + " ORDER BY ordinal_position");
-            if (cols_result && !cols_result->HasError()) {
-                for (idx_t i = 0; i < cols_result->RowCount(); i++) {
-                    current_cols.push_back(cols_result->GetValue(0, i).ToString());
-                }
-            }
+            CatalogTableInfo imported;
+            LookupImportedTable(conn, table_name, imported);
+            const auto &current_cols = imported.column_names;
 
             if (!current_cols.empty()) {
                 vector<string> cols_to_drop;
@@ -419,16 +426,17 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
             }
         }
         {
-            auto cols_result = conn.Query(
-                "SELECT COUNT(*) FROM information_schema.columns WHERE table_name = " +
-                EscapeStringLiteral(table_name));
-            if (cols_result && cols_result->RowCount() > 0) {
-                result.columns_created = cols_result->GetValue(0, 0).GetValue<int32_t>();
+            CatalogTableInfo imported;
+            if (LookupImportedTable(conn, table_name, imported)) {
+                result.columns_created = static_cast<int32_t>(imported.column_names.size());
             }
         }
+        cleanup_timer.Stop();
+        file_timer.AddRows(static_cast<uint64_t>(result.rows_imported));
 
         // 11. Smart cast (skip when user explicitly requested all_varchar)
         if (result.rows_imported > 0 && !opts.all_varchar) {
+            ::stps::shared::ScopedTimer smart_cast_timer("import_folder.file.smart_cast");
             string cast_sql = "CREATE OR REPLACE TABLE " + escaped_table +
                               " AS SELECT * FROM stps_smart_cast(" + EscapeStringLiteral(table_name) + ")";
             conn.Query(cast_sql);  // Non-fatal if fails
@@ -448,29 +456,173 @@ static ImportFileResult ImportSingleFile(ClientContext &context, const string &f
 }
 
 // ============================================================================
-// stps_import_folder (local filesystem)
+// Scan-driven folder import (shared by the local and the cloud variant)
 // ============================================================================
 
+// One file to import: a local path, or a URL for the cloud variant
+struct ImportFolderEntry {
+    string location;
+    string file_name;
+    int64_t size = -1;  // -1 if unknown
+};
+
+// Bind only lists the folder; files are imported by the scan, one per call, so each
+// result row arrives as soon as its file is done
 struct ImportFolderBindData : public TableFunctionData {
-    vector<ImportFileResult> results;
+    vector<ImportFolderEntry> files;
+    bool overwrite = false;
+    ReaderOptions opts;
+    bool cloud = false;
+    string username, password;
+    uint64_t total_bytes = 0;  // Sum of the known file sizes
 };
 
+// A LIMIT stops the scan after the files returned so far; the destructor then imports the
+// remaining files and runs stps_clean_database, so the folder is always imported in full.
+// A cancelled query skips the remaining files, but the imported ones are still cleaned up.
 struct ImportFolderGlobalState : public GlobalTableFunctionState {
-    idx_t offset = 0;
+    ImportFolderGlobalState(ClientContext &context_p, const ImportFolderBindData &bind_data_p)
+        : context(context_p), bind_data(bind_data_p) {
+    }
+    ~ImportFolderGlobalState() override;
+
+    ClientContext &context;
+    ImportFolderBindData bind_data;  // Copied: the destructor may outlive the bind data
+    idx_t next_file = 0;
+    std::set<string> used_table_names;
+    bool imported_any = false;
+    // Read by the progress callback while the scan runs
+    std::atomic<idx_t> files_done {0};
+    std::atomic<uint64_t> bytes_done {0};
+    std::atomic<bool> finished {false};
     idx_t MaxThreads() const override { return 1; }
 };
 
+static void ImportFolderResultSchema(vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("table_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("file_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("rows_imported");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("columns_created");
+    return_types.emplace_back(LogicalType::INTEGER);
+    names.emplace_back("error");
+    return_types.emplace_back(LogicalType::VARCHAR);
+}
+
+#ifdef HAVE_CURL
+static ImportFileResult ImportNextcloudFile(ClientContext &context, const ImportFolderBindData &bind_data,
+                                            const ImportFolderEntry &entry, std::set<string> &used_table_names);
+#endif
+
+static unique_ptr<GlobalTableFunctionState> ImportFolderInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<ImportFolderGlobalState>(context, input.bind_data->Cast<ImportFolderBindData>());
+}
+
+// Import the next file into r; returns false once every file has been imported
+static bool ImportNextFolderFile(ImportFolderGlobalState &state, ImportFileResult &r) {
+    auto &bind_data = state.bind_data;
+    if (state.next_file >= bind_data.files.size()) {
+        return false;
+    }
+
+    auto &entry = bind_data.files[state.next_file];
+#ifdef HAVE_CURL
+    r = bind_data.cloud
+        ? ImportNextcloudFile(state.context, bind_data, entry, state.used_table_names)
+        : ImportSingleFile(state.context, entry.location, entry.file_name, bind_data.overwrite,
+                           state.used_table_names, bind_data.opts);
+#else
+    r = ImportSingleFile(state.context, entry.location, entry.file_name, bind_data.overwrite,
+                         state.used_table_names, bind_data.opts);
+#endif
+    state.next_file++;
+    state.files_done = state.next_file;
+    if (entry.size > 0) {
+        state.bytes_done += static_cast<uint64_t>(entry.size);
+    }
+    // 0 rows and no error = empty/header-only file, nothing was imported
+    if (r.rows_imported != 0 || !r.error.empty()) {
+        state.imported_any = true;
+    }
+    return true;
+}
+
+// Run clean_database after all imports
+static void FinishImportFolder(ImportFolderGlobalState &state) {
+    if (state.imported_any) {
+        SessionPool::Acquire(state.context).Query("SELECT * FROM stps_clean_database()");
+    }
+    state.finished = true;
+}
+
+ImportFolderGlobalState::~ImportFolderGlobalState() {
+    if (finished) {
+        return;
+    }
+    try {
+        ImportFileResult r;
+        while (!context.interrupted && ImportNextFolderFile(*this, r)) {
+        }
+        FinishImportFolder(*this);
+    } catch (...) {
+        // A destructor cannot report errors; stps_clean_database can be run by hand
+    }
+}
+
+static void ImportFolderScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &state = data_p.global_state->Cast<ImportFolderGlobalState>();
+
+    output.SetCardinality(0);
+    ImportFileResult r;
+    while (!state.finished) {
+        if (!ImportNextFolderFile(state, r)) {
+            FinishImportFolder(state);
+            break;
+        }
+
+        // Skip empty files silently
+        if (r.rows_imported == 0 && r.error.empty()) continue;
+
+        output.SetValue(0, 0, Value(r.table_name));
+        output.SetValue(1, 0, Value(r.file_name));
+        output.SetValue(2, 0, Value::BIGINT(r.rows_imported));
+        output.SetValue(3, 0, Value::INTEGER(r.columns_created));
+        output.SetValue(4, 0, r.error.empty() ? Value() : Value(r.error));
+        output.SetCardinality(1);
+        break;
+    }
+}
+
+// Share of the bytes imported so far, or of the files when sizes are unknown
+static double ImportFolderProgress(ClientContext &context, const FunctionData *bind_data_p,
+                                   const GlobalTableFunctionState *global_state) {
+    auto &bind_data = bind_data_p->Cast<ImportFolderBindData>();
+    auto &state = global_state->Cast<ImportFolderGlobalState>();
+    if (state.finished || bind_data.files.empty()) {
+        return 100.0;
+    }
+    if (bind_data.total_bytes > 0) {
+        return 100.0 * double(state.bytes_done) / double(bind_data.total_bytes);
+    }
+    return 100.0 * double(state.files_done) / double(bind_data.files.size());
+}
+
+// ============================================================================
+// stps_import_folder (local filesystem)
+// ============================================================================
+
 static unique_ptr<FunctionData> ImportFolderBind(ClientContext &context, TableFunctionBindInput &input,
                                                    vector<LogicalType> &return_types, vector<string> &names) {
     auto result = make_uniq<ImportFolderBindData>();
 
     string folder_path = input.inputs[0].ToString();
-    bool overwrite = false;
-    ReaderOptions opts = ParseReaderOptions(input.named_parameters);
+    result->opts = ParseReaderOptions(input.named_parameters);
 
     for (auto &kv : input.named_parameters) {
         if (kv.first == "overwrite") {
-            overwrite = BooleanValue::Get(kv.second);
+            result->overwrite = BooleanValue::Get(kv.second);
         }
     }
 
@@ -483,9 +635,7 @@ static unique_ptr<FunctionData> ImportFolderBind(ClientContext &context, TableFu
 #endif
     }
 
-    // List and import files
-    std::set<string> used_table_names;
-
+    // List files to import
 #ifdef _WIN32
     WIN32_FIND_DATAA find_data;
     string search_path = folder_path + "*";
@@ -499,11 +649,12 @@ static unique_ptr<FunctionData> ImportFolderBind(ClientContext &context, TableFu
         if (find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) continue;
         if (!IsSupportedImportFile(filename)) continue;
 
-        string file_path_str = folder_path + filename;
-        auto import_result = ImportSingleFile(context, file_path_str, filename, overwrite, used_table_names, opts);
-        // Skip empty files silently (0 rows, no error = empty/header-only file)
-        if (import_result.rows_imported == 0 && import_result.error.empty()) continue;
-        result->results.push_back(import_result);
+        ImportFolderEntry file;
+        file.location = folder_path + filename;
+        file.file_name = filename;
+        file.size = (static_cast<int64_t>(find_data.nFileSizeHigh) << 32) | find_data.nFileSizeLow;
+        result->total_bytes += static_cast<uint64_t>(file.size);
+        result->files.push_back(std::move(file));
     } while (FindNextFileA(hFind, &find_data));
     FindClose(hFind);
 #else
@@ -522,57 +673,20 @@ static unique_ptr<FunctionData> ImportFolderBind(ClientContext &context, TableFu
         if (stat(file_path_str.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) continue;
         if (!IsSupportedImportFile(filename)) continue;
 
-        auto import_result = ImportSingleFile(context, file_path_str, filename, overwrite, used_table_names, opts);
-        // Skip empty files silently (0 rows, no error = empty/header-only file)
-        if (import_result.rows_imported == 0 && import_result.error.empty()) continue;
-        result->results.push_back(import_result);
+        ImportFolderEntry file;
+        file.location = file_path_str;
+        file.file_name = filename;
+        file.size = static_cast<int64_t>(st.st_size);
+        result->total_bytes += static_cast<uint64_t>(file.size);
+        result->files.push_back(std::move(file));
     }
     closedir(dir);
 #endif
 
-    // Run clean_database after all imports
-    if (!result->results.empty()) {
-        Connection conn(context.db->GetDatabase(context));
-        conn.Query("SELECT * FROM stps_clean_database()");
-    }
-
-    // Output schema
-    names.emplace_back("table_name");
-    return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("file_name");
-    return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("rows_imported");
-    return_types.emplace_back(LogicalType::BIGINT);
-    names.emplace_back("columns_created");
-    return_types.emplace_back(LogicalType::INTEGER);
-    names.emplace_back("error");
-    return_types.emplace_back(LogicalType::VARCHAR);
-
+    ImportFolderResultSchema(return_types, names);
     return std::move(result);
 }
 
-static unique_ptr<GlobalTableFunctionState> ImportFolderInit(ClientContext &context, TableFunctionInitInput &input) {
-    return make_uniq<ImportFolderGlobalState>();
-}
-
-static void ImportFolderScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &bind_data = data_p.bind_data->Cast<ImportFolderBindData>();
-    auto &state = data_p.global_state->Cast<ImportFolderGlobalState>();
-
-    idx_t count = 0;
-    while (state.offset < bind_data.results.size() && count < STANDARD_VECTOR_SIZE) {
-        auto &r = bind_data.results[state.offset];
-        output.SetValue(0, count, Value(r.table_name));
-        output.SetValue(1, count, Value(r.file_name));
-        output.SetValue(2, count, Value::BIGINT(r.rows_imported));
-        output.SetValue(3, count, Value::INTEGER(r.columns_created));
-        output.SetValue(4, count, r.error.empty() ? Value() : Value(r.error));
-        state.offset++;
-        count++;
-    }
-    output.SetCardinality(count);
-}
-
 #ifdef HAVE_CURL
 
 // ============================================================================
@@ -631,44 +745,77 @@ static std::vector<PropfindEntry> PropfindFolder(const std::string &url, const s
 
     long http_code = 0;
     std::string request_url = NormalizeRequestUrl(url);
-    std::string response = curl_propfind(request_url, PROPFIND_BODY, headers, &http_code);
+    // Extended body: file sizes drive the progress estimate
+    std::string response = curl_propfind(request_url, PROPFIND_BODY_EXTENDED, headers, &http_code);
 
     if (response.find("ERROR:") == 0 || http_code >= 400) {
         return {};
     }
 
-    return ParsePropfindResponse(response);
+    return ParsePropfindResponseExtended(response);
+}
+
+static ImportFileResult DownloadFailure(const string &filename, const string &error) {
+    ImportFileResult r;
+    r.file_name = filename;
+    string bn = filename;
+    size_t dp = bn.rfind('.');
+    if (dp != string::npos) bn = bn.substr(0, dp);
+    r.table_name = ToSnakeCase(bn);
+    r.error = error + filename;
+    return r;
+}
+
+// Download one folder entry to a temp file (preserving extension for reader detection) and import it
+static ImportFileResult ImportNextcloudFile(ClientContext &context, const ImportFolderBindData &bind_data,
+                                            const ImportFolderEntry &entry, std::set<string> &used_table_names) {
+    ::stps::shared::ScopedTimer download_timer("import_folder.download");
+    string content = DownloadFile(entry.location, bind_data.username, bind_data.password);
+    download_timer.AddBytes(content.size());
+    download_timer.Stop();
+    if (content.empty()) {
+        return DownloadFailure(entry.file_name, "Failed to download file: ");
+    }
+
+    string temp_path = GenerateImportTempPath(entry.file_name);
+    {
+        std::ofstream out(temp_path, std::ios::binary);
+        if (!out) {
+            return DownloadFailure(entry.file_name, "Failed to create temp file for: ");
+        }
+        out.write(content.data(), content.size());
+        out.close();
+    }
+    content.clear();
+    content.shrink_to_fit();
+
+    auto import_result = ImportSingleFile(context, temp_path, entry.file_name, bind_data.overwrite,
+                                          used_table_names, bind_data.opts);
+
+    // Cleanup temp file
+    std::remove(temp_path.c_str());
+    return import_result;
 }
 
 // ============================================================================
 // stps_import_nextcloud_folder (cloud)
 // ============================================================================
 
-struct ImportNextcloudFolderBindData : public TableFunctionData {
-    vector<ImportFileResult> results;
-};
-
-struct ImportNextcloudFolderGlobalState : public GlobalTableFunctionState {
-    idx_t offset = 0;
-    idx_t MaxThreads() const override { return 1; }
-};
-
 static unique_ptr<FunctionData> ImportNextcloudFolderBind(ClientContext &context, TableFunctionBindInput &input,
                                                             vector<LogicalType> &return_types, vector<string> &names) {
-    auto result = make_uniq<ImportNextcloudFolderBindData>();
+    auto result = make_uniq<ImportFolderBindData>();
+    result->cloud = true;
 
     string folder_url = input.inputs[0].ToString();
-    string username, password;
-    bool overwrite = false;
-    ReaderOptions opts = ParseReaderOptions(input.named_parameters);
+    result->opts = ParseReaderOptions(input.named_parameters);
 
     for (auto &kv : input.named_parameters) {
         if (kv.first == "username") {
-            username = kv.second.ToString();
+            result->username = kv.second.ToString();
         } else if (kv.first == "password") {
-            password = kv.second.ToString();
+            result->password = kv.second.ToString();
         } else if (kv.first == "overwrite") {
-            overwrite = BooleanValue::Get(kv.second);
+            result->overwrite = BooleanValue::Get(kv.second);
         }
     }
 
@@ -676,13 +823,11 @@ static unique_ptr<FunctionData> ImportNextcloudFolderBind(ClientContext &context
     string server_base = GetBaseUrl(folder_url);
 
     // PROPFIND the folder
-    auto entries = PropfindFolder(folder_url, username, password);
+    auto entries = PropfindFolder(folder_url, result->username, result->password);
     if (entries.empty()) {
         throw IOException("Could not list folder (PROPFIND failed or empty): " + folder_url);
     }
 
-    std::set<string> used_table_names;
-
     for (auto &entry : entries) {
         // Skip collections and parent entry
         if (entry.is_collection) continue;
@@ -692,94 +837,20 @@ static unique_ptr<FunctionData> ImportNextcloudFolderBind(ClientContext &context
         string filename = GetLastPathSegment(decoded_href);
         if (filename.empty() || !IsSupportedImportFile(filename)) continue;
 
-        // Download the file
-        string file_url = server_base + entry.href;
-        string content = DownloadFile(file_url, username, password);
-        if (content.empty()) {
-            ImportFileResult r;
-            r.file_name = filename;
-            string bn = filename;
-            size_t dp = bn.rfind('.');
-            if (dp != string::npos) bn = bn.substr(0, dp);
-            r.table_name = ToSnakeCase(bn);
-            r.error = "Failed to download file: " + filename;
-            result->results.push_back(r);
-            continue;
-        }
-
-        // Write to temp file (preserving extension for reader detection)
-        string temp_path = GenerateImportTempPath(filename);
-        {
-            std::ofstream out(temp_path, std::ios::binary);
-            if (!out) {
-                ImportFileResult r;
-                r.file_name = filename;
-                string bn = filename;
-                size_t dp = bn.rfind('.');
-                if (dp != string::npos) bn = bn.substr(0, dp);
-                r.table_name = ToSnakeCase(bn);
-                r.error = "Failed to create temp file for: " + filename;
-                result->results.push_back(r);
-                continue;
-            }
-            out.write(content.data(), content.size());
-            out.close();
+        ImportFolderEntry file;
+        file.location = server_base + entry.href;
+        file.file_name = filename;
+        file.size = entry.content_length;
+        if (file.size > 0) {
+            result->total_bytes += static_cast<uint64_t>(file.size);
         }
-
-        // Import the file
-        auto import_result = ImportSingleFile(context, temp_path, filename, overwrite, used_table_names, opts);
-
-        // Cleanup temp file
-        std::remove(temp_path.c_str());
-
-        // Skip empty files silently (0 rows, no error = empty/header-only file)
-        if (import_result.rows_imported == 0 && import_result.error.empty()) continue;
-        result->results.push_back(import_result);
+        result->files.push_back(std::move(file));
     }
 
-    // Run clean_database after all imports
-    if (!result->results.empty()) {
-        Connection conn(context.db->GetDatabase(context));
-        conn.Query("SELECT * FROM stps_clean_database()");
-    }
-
-    // Output schema
-    names.emplace_back("table_name");
-    return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("file_name");
-    return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("rows_imported");
-    return_types.emplace_back(LogicalType::BIGINT);
-    names.emplace_back("columns_created");
-    return_types.emplace_back(LogicalType::INTEGER);
-    names.emplace_back("error");
-    return_types.emplace_back(LogicalType::VARCHAR);
-
+    ImportFolderResultSchema(return_types, names);
     return std::move(result);
 }
 
-static unique_ptr<GlobalTableFunctionState> ImportNextcloudFolderInit(ClientContext &context, TableFunctionInitInput &input) {
-    return make_uniq<ImportNextcloudFolderGlobalState>();
-}
-
-static void ImportNextcloudFolderScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &bind_data = data_p.bind_data->Cast<ImportNextcloudFolderBindData>();
-    auto &state = data_p.global_state->Cast<ImportNextcloudFolderGlobalState>();
-
-    idx_t count = 0;
-    while (state.offset < bind_data.results.size() && count < STANDARD_VECTOR_SIZE) {
-        auto &r = bind_data.results[state.offset];
-        output.SetValue(0, count, Value(r.table_name));
-        output.SetValue(1, count, Value(r.file_name));
-        output.SetValue(2, count, Value::BIGINT(r.rows_imported));
-        output.SetValue(3, count, Value::INTEGER(r.columns_created));
-        output.SetValue(4, count, r.error.empty() ? Value() : Value(r.error));
-        state.offset++;
-        count++;
-    }
-    output.SetCardinality(count);
-}
-
 #endif // HAVE_CURL
 
 // ============================================================================
@@ -815,6 +886,7 @@ void RegisterImportFolderFunctions(ExtensionLoader &loader) {
                           {LogicalType::VARCHAR},
                           ImportFolderScan, ImportFolderBind, ImportFolderInit);
         func.named_parameters["overwrite"] = LogicalType::BOOLEAN;
+        func.table_scan_progress = ImportFolderProgress;
         RegisterReaderNamedParameters(func);
 
         CreateTableFunctionInfo info(func);
@@ -826,7 +898,8 @@ void RegisterImportFolderFunctions(ExtensionLoader &loader) {
     {
         TableFunction func("stps_import_nextcloud_folder",
                           {LogicalType::VARCHAR},
-                          ImportNextcloudFolderScan, ImportNextcloudFolderBind, ImportNextcloudFolderInit);
+                          ImportFolderScan, ImportNextcloudFolderBind, ImportFolderInit);
+        func.table_scan_progress = ImportFolderProgress;
         func.named_parameters["username"] = LogicalType::VARCHAR;
         func.named_parameters["password"] = LogicalType::VARCHAR;
         func.named_parameters["overwrite"] = LogicalType::BOOLEAN;
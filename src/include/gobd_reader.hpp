@@ -2,9 +2,16 @@
 
 #include "duckdb.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "shared/session_pool.hpp"
+#include "smart_cast_utils.hpp"
+#include "shared/string_arena.hpp"
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 
 namespace duckdb {
 namespace stps {
@@ -14,20 +21,144 @@ struct GobdColumn {
     string name;
     string data_type;  // Numeric, AlphaNumeric, Date
     int accuracy = -1;
+    string date_format;  // <Format> of Date columns, e.g. DD.MM.YYYY
     int order = 0;
+    bool primary_key = false;  // VariablePrimaryKey / FixedPrimaryKey
+    // <FixedRange> of FixedLength tables: 1-based first byte and width within the record
+    idx_t fixed_from = 0;
+    idx_t fixed_length = 0;
+};
+
+// <ForeignKey>: columns of this table referencing another table
+struct GobdForeignKey {
+    vector<string> columns;
+    string references;           // Referenced table name
+    vector<string> aliases;      // Referenced column names when they differ (<Alias>)
 };
 
 struct GobdTable {
     string name;
     string url;
     string description;
+    char decimal_symbol = ',';         // <DecimalSymbol>
+    char digit_grouping_symbol = '.';  // <DigitGroupingSymbol>
     vector<GobdColumn> columns;
+
+    // Record layout
+    bool fixed_length = false;   // <FixedLength> instead of <VariableLength>
+    idx_t record_length = 0;     // <FixedLength><Length>, 0 = end of the widest column
+    char column_delimiter = '\0';  // <ColumnDelimiter>, '\0' = reader default
+    string record_delimiter;     // <RecordDelimiter>, empty = line breaks
+    char text_encapsulator = '"';   // <TextEncapsulator>, '\0' = none
+    string charset;              // UTF8, ANSI, Macintosh or OEM; empty if not declared
+    idx_t skip_bytes = 0;        // <SkipNumBytes>
+    idx_t range_from = 1;        // <Range><From>: first record to read (1-based)
+    idx_t range_to = 0;          // <Range><To>/<Length>: last record, 0 = to the end
+    vector<GobdForeignKey> foreign_keys;
+};
+
+// How the fields of one GoBD column are converted while reading, from its index.xml
+// declaration: Numeric with Accuracy -> DECIMAL(18, accuracy), Numeric -> DOUBLE,
+// Date -> DATE, everything else VARCHAR
+struct GobdColumnPlan {
+    LogicalType type = LogicalType::VARCHAR;
+    uint8_t scale = 0;
+    NumberLocale locale = NumberLocale::GERMAN;  // From the table's DecimalSymbol
+    // The table's DigitGroupingSymbol when it is not the locale's own ('.' / ','), e.g. ' '
+    // or '\''; mapped onto the locale's separator before a field is scanned
+    char grouping_symbol = '\0';
+    DateFormat date_format = DateFormat::DMY;
+    DateKernel date_kernel = DateKernel::GENERIC;
+};
+
+// One plan per table column (all VARCHAR if all_varchar)
+vector<GobdColumnPlan> PlanGobdColumns(const GobdTable &table, bool all_varchar = false);
+
+// Where the data of one GoBD table comes from (local file, archive member, download).
+// Nothing is read up front: the import pipeline reads a table when it reaches it and
+// drops the content before the next one, so an import holds one table at a time. A
+// local file is streamed in blocks; other sources are loaded whole.
+class GobdTableSource {
+public:
+    virtual ~GobdTableSource() = default;
+
+    // Expected content size in bytes (0 if unknown before loading)
+    virtual idx_t SizeHint() const = 0;
+    // Read the table's whole CSV data into memory; empty if it is missing or unreadable
+    virtual std::string Load() = 0;
+    // Path of a local file holding the data (streamed instead of loaded); empty otherwise
+    virtual string LocalPath() const {
+        return "";
+    }
+    // The source already holds budget for its data (e.g. a member of a downloaded archive
+    // that is charged as a whole): loads are added to the budget without waiting, which
+    // would never end while the source itself holds the budget
+    virtual bool HoldsBudget() const {
+        return false;
+    }
+};
+
+// Source reading a local file. keep_alive is held until the source is destroyed (e.g. the
+// temporary directory of an extracted archive).
+shared_ptr<GobdTableSource> MakeGobdFileSource(string path, std::shared_ptr<void> keep_alive = nullptr);
+
+// Cap on the CSV bytes held by the running imports and scans of one database (shared by
+// its connections through the object cache): the read buffer of a streamed file, a whole
+// loaded table or a downloaded archive. Reads wait until their size fits; a read larger
+// than the whole budget still runs once nothing else is held. The limit is half of the
+// database's memory_limit.
+class GobdLoadBudget : public ObjectCacheEntry {
+public:
+    // The budget of context's database, its limit refreshed from the current memory_limit
+    static shared_ptr<GobdLoadBudget> Get(ClientContext &context);
+
+    static string ObjectType() {
+        return "stps_gobd_load_budget";
+    }
+    string GetObjectType() override {
+        return ObjectType();
+    }
+
+    void SetLimit(idx_t bytes);
+    // Block until bytes fit; throws InterruptException when the query is interrupted
+    void Acquire(ClientContext &context, idx_t bytes);
+    // Account for bytes without waiting (size only known after loading)
+    void Add(idx_t bytes);
+    void Release(idx_t bytes);
+
+private:
+    std::mutex lock;
+    std::condition_variable released;
+    idx_t limit = 0;
+    idx_t in_use = 0;
+};
+
+// Bytes of one read held against the budget until destroyed
+class GobdLoadReservation {
+public:
+    // Waits for bytes to fit unless wait is false (the caller already holds budget)
+    GobdLoadReservation(ClientContext &context, shared_ptr<GobdLoadBudget> budget, idx_t bytes, bool wait = true);
+    ~GobdLoadReservation();
+
+    GobdLoadReservation(const GobdLoadReservation &) = delete;
+    GobdLoadReservation &operator=(const GobdLoadReservation &) = delete;
+
+    // Adjust to the actual size once it is known (without waiting)
+    void Resize(idx_t bytes);
+    void Release();
+    idx_t Reserved() const {
+        return reserved;
+    }
+
+private:
+    shared_ptr<GobdLoadBudget> budget;
+    idx_t reserved;
 };
 
 // Import pipeline data: populated by each source, consumed by shared pipeline
 struct GobdImportData {
-    vector<GobdTable> tables;                   // parsed from index.xml
-    std::map<string, string> csv_contents;      // table URL -> CSV content string
+    vector<GobdTable> tables;                                     // parsed from index.xml
+    std::map<string, shared_ptr<GobdTableSource>> table_sources;  // table URL -> data source
 };
 
 // Result of importing a single table
@@ -41,17 +172,102 @@ struct GobdImportResult {
 };
 
 // Shared import pipeline: creates tables, normalizes columns, drops empty cols, smart-casts
-// When schema_name is non-empty, creates tables in that schema
+// When schema_name is non-empty, creates tables in that schema. delimiter applies to
+// tables whose index declares no ColumnDelimiter.
+//
+// With enrich_mandantendaten, the mandantendaten table (GoBD client master data) is imported
+// first and, if it has exactly one row, its columns are added in front of every other table
+// that lacks them: as constants in the statement that loads the table, so no table is
+// written a second time.
 vector<GobdImportResult> ExecuteGobdImportPipeline(ClientContext &context,
                                                     const GobdImportData &data,
                                                     char delimiter,
                                                     bool overwrite,
-                                                    const string &schema_name = "");
+                                                    const string &schema_name = "",
+                                                    bool enrich_mandantendaten = false);
+
+// The same pipeline one table at a time, for callers that report each table as soon as it
+// is imported (ExecuteGobdImportPipeline runs it to the end)
+class GobdImportPipeline {
+public:
+    GobdImportPipeline(ClientContext &context, GobdImportData data, char delimiter, bool overwrite,
+                       string schema_name = "", bool enrich_mandantendaten = false);
+
+    // Import the next table into result; false once every table was handled
+    bool Next(GobdImportResult &result);
+
+    idx_t TablesDone() const {
+        return next_table;
+    }
+    idx_t TableCount() const {
+        return data.tables.size();
+    }
+
+private:
+    GobdImportResult ImportTable(const GobdTable &table);
+    // Keep the single row of the imported mandantendaten table as constant columns
+    void LoadMandantendaten(const string &escaped_table);
+
+    ClientContext &context;
+    GobdImportData data;
+    char delimiter;
+    bool overwrite;
+    string schema_name;
+    string escaped_schema;
+    SessionLease session;
+    Connection &conn;  // session's connection
+    vector<string_t> fields;  // Field views reused across all records
+    idx_t next_table = 0;
+    bool enrich_mandantendaten;
+    // Mandantendaten columns added to the other tables
+    vector<string> constant_names;
+    vector<Value> constant_values;
+};
+
+// Options of the Parquet export
+struct GobdParquetOptions {
+    char delimiter = ';';          // For tables without a ColumnDelimiter
+    idx_t row_group_size = 122880;
+    string compression = "snappy";
+    idx_t threads = 0;             // Tables exported at once; 0 = the threads setting
+    bool overwrite = false;        // Replace existing files instead of reporting an error
+};
+
+// Result of exporting a single table
+struct GobdParquetResult {
+    string table_name;  // snake_case table name (also the file name)
+    string file_path;
+    int64_t rows_written = 0;
+    string error;       // empty if success
+    vector<LogicalType> column_types;  // Types written
+};
+
+// Stream every table of data straight into <target_dir>/<table>.parquet (decoded and typed
+// as in stps_read_gobd, snake_case column names; as in the import, a column with a value
+// that does not convert is written as VARCHAR), several tables at a time, then write
+// <target_dir>/manifest.json with the row count and schema of each file
+vector<GobdParquetResult> ExecuteGobdParquetExport(ClientContext &context, const GobdImportData &data,
+                                                   const string &target_dir, const GobdParquetOptions &options);
+
+// Parse the named parameters shared by the *_to_parquet functions; false if name is not one
+bool ParseGobdParquetOption(const string &name, const Value &value, GobdParquetOptions &options);
+
+// Register those named parameters on a *_to_parquet table function
+void AddGobdParquetParameters(TableFunction &function);
+
+// Result columns of the *_to_parquet functions (table_name, file_path, rows_written, error)
+void GobdParquetResultSchema(vector<LogicalType> &return_types, vector<string> &names);
+void WriteGobdParquetResults(const vector<GobdParquetResult> &results, idx_t &offset, DataChunk &output);
 
 // Convert a string to snake_case (exposed for schema name normalization)
 string ToSnakeCase(const string &input);
 
+// snake_case column names of a table, made unique with _2, _3, ... suffixes
+vector<string> NormalizeGobdColumnNames(const GobdTable &table);
+
 // Encoding helpers
+// Strict UTF-8 check (no overlong forms, surrogates or code points above U+10FFFF)
+bool IsValidUtf8(const char *data, size_t len);
 bool IsValidUtf8(const std::string &str);
 std::string ConvertWindows1252ToUtf8(const std::string &input);
 std::string EnsureUtf8(const std::string &input);
@@ -63,9 +279,73 @@ vector<GobdTable> ParseGobdIndexFromString(const string &xml_content);
 // Convert GoBD data type to DuckDB LogicalType
 LogicalType GobdTypeToDuckDbType(const string &gobd_type, int accuracy = -1);
 
+// "Table.Column" a column references through a declared ForeignKey; empty if none
+string GobdColumnReference(const GobdTable &table, const GobdColumn &col);
+
 // Parse a single CSV line respecting quotes
 vector<string> ParseCsvLine(const string &line, char delimiter);
 
+// Write split CSV fields into the VARCHAR columns of output starting at first_column;
+// columns without a field are NULL
+void WriteCsvFields(DataChunk &output, idx_t row, const vector<string_t> &fields, idx_t first_column = 0);
+
+// Write split CSV fields converted per plan (one plan per output column from first_column).
+// Missing and empty (for typed columns) fields are NULL; a field that does not convert to
+// its column type throws an InvalidInputException (read with all_varchar to keep it).
+void WriteGobdFields(DataChunk &output, idx_t row, const vector<string_t> &fields,
+                     const vector<GobdColumnPlan> &plans, idx_t first_column = 0);
+
+// Character set of a table's data file
+enum class GobdCharset : uint8_t { UTF8, ANSI, OEM, MACINTOSH };
+
+// Declared charset of table; undeclared tables are UTF8 when content (if given) is valid
+// UTF-8 and ANSI (Windows-1252) otherwise. Decoding a UTF8 table still reads any field that
+// is not valid UTF-8 as ANSI.
+GobdCharset GobdTableCharset(const GobdTable &table, const std::string *content = nullptr);
+
+// Splits the records of one GoBD table into field views following its index.xml layout:
+// delimited (VariableLength) or fixed-width (FixedLength, sliced by byte offsets), with the
+// declared delimiters, text encapsulator, SkipNumBytes and Range. Fields are converted to
+// UTF-8 from the charset. Views point into the data or into arena.
+class GobdRecordDecoder {
+public:
+    GobdRecordDecoder(const GobdTable &table, char default_delimiter, GobdCharset charset);
+
+    // Decode the next record of data[position, size) and advance position. Returns false
+    // when no complete record is left: with final = false the caller may append more
+    // data after data[position..] and call again, with final = true the data is done.
+    bool Next(const char *data, size_t size, size_t &position, bool final, ::stps::shared::StringArena &arena,
+              vector<string_t> &fields);
+
+    // All records of the declared Range were returned
+    bool Finished() const {
+        return range_to > 0 && records >= range_to;
+    }
+
+private:
+    bool NextRecord(const char *data, size_t size, size_t &position, bool final, const char *&record,
+                    size_t &length);
+    void Split(const char *record, size_t length, ::stps::shared::StringArena &arena, vector<string_t> &fields);
+
+    struct FixedSlice {
+        idx_t offset;  // 0-based
+        idx_t length;
+    };
+
+    bool fixed;
+    idx_t record_length;
+    vector<FixedSlice> slices;
+    char delimiter;
+    char quote;
+    string record_delimiter;
+    bool line_records;  // Records end at '\n' (optional '\r' dropped)
+    GobdCharset charset;
+    idx_t skip_remaining;
+    idx_t range_from;
+    idx_t range_to;
+    idx_t records = 0;
+};
+
 // Simple XML text extraction between tags
 string ExtractTagValue(const string &xml, const string &tag_name, size_t start_pos = 0);
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace duckdb {
+namespace stps {
+
+// An entry from rl.inso_kontenrahmen
+struct InsoKontoEntry {
+    string kontoart;       // "Einnahmekonten" or "Ausgabekonten"
+    string decEAKontoNr;   // e.g. "4970", "8200"
+    string kontobezeichnung;
+};
+
+// Per-thread scratch buffers reused across match calls (avoids per-lookup allocations)
+struct InsoMatchScratch {
+    vector<uint32_t> hits;     // token hits per inso entry
+    vector<idx_t> touched;     // entries with hits > 0
+    vector<int32_t> tokens;    // token ids of the current query (-1 = unknown token)
+};
+
+// Precomputed matching engine over the inso_kontenrahmen.
+//
+// Built once per Kontenrahmen: every kontobezeichnung is tokenized into integer
+// token ids and indexed token -> entries, so a name lookup only touches entries
+// that share at least one token. Tier 1 ranges use binary search, Tier 2 keywords
+// run through a single Aho-Corasick pass. Results are identical to the original
+// linear-scan matcher (same scores, same tie-breaking on Kontenrahmen order).
+//
+// All Match* methods are const and thread-safe as long as each thread uses its own scratch.
+class InsoAccountMatcher {
+public:
+    explicit InsoAccountMatcher(vector<InsoKontoEntry> entries);
+
+    // Best Ausgabekonten entry for an Aufwand account: (1) range, (2) keyword, (3) name similarity
+    std::pair<string, string> MatchAusgabe(int64_t aufwand_konto, const string &aufwand_bezeichnung,
+                                           InsoMatchScratch &scratch) const;
+
+    // Best entry for a Sachkonto (Vorsteuer -> 1780, otherwise name similarity > 0.2)
+    std::pair<string, string> MatchSachkonto(int64_t sachkonto, const string &sachkonto_bezeichnung,
+                                             InsoMatchScratch &scratch) const;
+
+    const vector<InsoKontoEntry> &Entries() const {
+        return entries;
+    }
+
+private:
+    // Tokenize a query name into known token ids; returns total token count (incl. unknown tokens)
+    idx_t TokenizeQuery(const string &name, vector<int32_t> &out_tokens) const;
+    // Count token hits per entry for the query tokens in scratch.tokens
+    void CollectHits(InsoMatchScratch &scratch) const;
+    // Lowest KEYWORD_MAPPINGS index contained in the umlaut-normalized name, or -1
+    int FindKeyword(const string &name) const;
+
+    vector<InsoKontoEntry> entries;
+    vector<bool> is_ausgabe;
+    vector<uint32_t> entry_token_count;
+    vector<string> entry_ea_numeric;
+
+    // Token dictionary and inverted index (token id -> entry indices, ascending)
+    std::unordered_map<string, int32_t> token_ids;
+    vector<vector<idx_t>> postings;
+
+    // Earliest Ausgabekonten entry per EA number prefix of length 1..4
+    std::unordered_map<string, idx_t> prefix_first[4];
+
+    // Aho-Corasick automaton over the keyword table (alphabet a-z + "other")
+    static constexpr idx_t AC_ALPHABET = 27;
+    vector<int32_t> ac_goto;   // state * AC_ALPHABET + symbol -> next state
+    vector<int32_t> ac_best;   // lowest keyword index emitted at state (incl. fail chain), -1 if none
+};
+
+// Run fn(begin, end) over [0, count) in slices on DuckDB's task scheduler, one slice per
+// scheduler thread; returns once all slices are done
+void InsoParallelFor(ClientContext &context, idx_t count, const std::function<void(idx_t, idx_t)> &fn);
+
+} // namespace stps
+} // namespace duckdb
@@ -4,6 +4,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "shared/filesystem_utils.hpp"
+#include "shared/directory_walker.hpp"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,13 +22,13 @@ struct PathOptions {
 
 class PathScanner {
 public:
-    static std::vector<stps::shared::FileInfo> ScanPath(duckdb::FileSystem& fs, const PathOptions& options);
+    // Validate the base path and start a streaming walk (need_stat: size or modified_time projected)
+    static std::unique_ptr<shared::DirectoryWalker> StartScan(duckdb::ClientContext& context, duckdb::FileSystem& fs,
+                                                              const PathOptions& options, bool need_stat,
+                                                              size_t threads);
 
 private:
-    static void ScanRecursive(duckdb::FileSystem& fs, const std::string& path, const PathOptions& options,
-                              std::vector<stps::shared::FileInfo>& results, int current_depth);
-    static bool PassesFilters(duckdb::FileSystem& fs, const std::string& path, bool is_directory,
-                              const PathOptions& options);
+    static bool PassesFilters(duckdb::FileSystem& fs, const shared::WalkEntry& entry, const PathOptions& options);
 };
 
 } // namespace stps
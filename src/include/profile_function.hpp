@@ -0,0 +1,11 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+namespace stps {
+
+void RegisterProfileFunctions(ExtensionLoader& loader);
+
+} // namespace stps
+} // namespace duckdb
@@ -4,6 +4,9 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "shared/filesystem_utils.hpp"
+#include "shared/directory_walker.hpp"
+#include "shared/content_searcher.hpp"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,20 +26,26 @@ struct ScanFunctionOptions {
     int64_t max_size = -1;
     int64_t min_date = -1;
     int64_t max_date = -1;
-    std::string content_search;
+    // content_search: a file matches if any pattern occurs (VARCHAR or LIST of VARCHAR)
+    std::vector<std::string> content_search;
+    bool content_ignore_case = false;
 };
 
 class ScanScanner {
 public:
-    static std::vector<stps::shared::FileInfo> ScanPath(duckdb::FileSystem& fs, const ScanFunctionOptions& options);
+    // Validate the base path and start a streaming walk. need_stat is set when size or
+    // modified_time are projected; size/date filters force it on.
+    static std::unique_ptr<shared::DirectoryWalker> StartScan(duckdb::ClientContext& context,
+                                                              duckdb::FileSystem& fs,
+                                                              const ScanFunctionOptions& options,
+                                                              bool need_stat, size_t threads);
 
 private:
-    static void ScanRecursive(duckdb::FileSystem& fs, const std::string& path, const ScanFunctionOptions& options,
-                              std::vector<stps::shared::FileInfo>& results, int current_depth);
-    static bool PassesBasicFilters(duckdb::FileSystem& fs, const std::string& path, bool is_directory,
+    static bool PassesBasicFilters(duckdb::FileSystem& fs, const shared::WalkEntry& entry,
                                     const ScanFunctionOptions& options);
-    static bool PassesAdvancedFilters(duckdb::FileSystem& fs, const std::string& path,
-                                       const ScanFunctionOptions& options);
+    static bool PassesAdvancedFilters(duckdb::FileSystem& fs, shared::WalkEntry& entry,
+                                       const ScanFunctionOptions& options,
+                                       const shared::ContentSearcher* searcher);
 };
 
 } // namespace stps
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include <functional>
+
+namespace duckdb {
+namespace stps {
+
+// A table (or other relation) as seen by schema discovery
+struct CatalogTableInfo {
+    string catalog;
+    string schema;
+    string name;
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    // Rows in committed storage, including deleted rows not yet vacuumed; -1 when unknown
+    // (views, files, tables of other catalog types)
+    int64_t estimated_rows = -1;
+    // Found in the catalog (false: described by planning a query)
+    bool from_catalog = false;
+
+    // "catalog"."schema"."name", for use in SQL
+    string SqlName() const;
+};
+
+// Schema discovery straight from the catalog, instead of round-trips through
+// information_schema, PRAGMA table_info or "SELECT * ... LIMIT 0".
+//
+// Lookups need an open transaction on context: binds, scans, scalar functions and
+// optimizer hooks always have one. To see DDL done on a pooled connection, run the lookup
+// on that connection with InTransaction().
+
+// Table by exact schema and name; an empty schema searches the search path
+bool LookupTable(ClientContext &context, const string &schema, const string &name, CatalogTableInfo &result);
+
+// Relation as written in a FROM clause (quoted and/or schema-qualified). Tables come from
+// the catalog; anything else (views, file paths, table functions) is described by planning
+// "SELECT * FROM reference LIMIT 0" on a pooled connection. Returns false with error set
+// if the reference cannot be resolved.
+bool DescribeRelation(ClientContext &context, const string &reference, CatalogTableInfo &result, string &error);
+
+// User tables of all attached databases (no views, temporary or internal tables), sorted
+// by catalog, schema and name; schema_filter restricts the list to one schema name
+vector<CatalogTableInfo> ListTables(ClientContext &context, const string &schema_filter = "");
+
+// Storage statistics of one column (index into column_names); nullptr if not available
+unique_ptr<BaseStatistics> GetColumnStatistics(ClientContext &context, const CatalogTableInfo &table, idx_t column);
+
+// Run fun in a transaction of conn's own context
+void InTransaction(Connection &conn, const std::function<void(ClientContext &)> &fun);
+
+} // namespace stps
+} // namespace duckdb
@@ -1,30 +1,50 @@
 #pragma once
 
 #include "duckdb/common/file_system.hpp"
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace stps {
 namespace shared {
 
+// Position of the first match found in a file
+struct ContentMatch {
+    int64_t line = 0;         // 1-based line number
+    int64_t offset = 0;       // Byte offset from the start of the file
+    size_t pattern_index = 0; // Which pattern matched
+};
+
+// Content search over one or more patterns (a file matches if any pattern occurs).
+//
+// Files are streamed in fixed 1MB blocks through a reused per-thread buffer, carrying the
+// last (longest pattern - 1) bytes over so matches spanning a block boundary are found.
+// Candidates are located by comparing the first and last pattern byte 16 positions at a
+// time (SSE2 where available), and only those are verified with memcmp. Binary detection
+// runs on the first block of the same read. The search stops at the first match.
+//
+// A searcher is immutable after construction and can be shared by walker threads.
 class ContentSearcher {
 public:
-    // Maximum file size for content search (100MB)
-    static constexpr int64_t MAX_SEARCH_SIZE = 100 * 1024 * 1024;
+    ContentSearcher(std::vector<std::string> patterns, bool case_insensitive);
 
-    // Check if a file is likely binary (not text)
-    static bool IsBinaryFile(duckdb::FileSystem& fs, const std::string& file_path);
+    // Search a file; fills match and returns true on the first occurrence of any pattern.
+    // Binary and unreadable files never match.
+    bool SearchFile(duckdb::FileSystem& fs, const std::string& file_path, ContentMatch& match) const;
 
-    // Search for text within a file
-    // Returns true if the text is found
-    // Automatically skips binary files and files > MAX_SEARCH_SIZE
-    static bool FileContainsText(duckdb::FileSystem& fs, const std::string& file_path, const std::string& search_text);
+    // Search an in-memory buffer (case folding is applied to a copy)
+    bool SearchBuffer(const char* data, size_t size, ContentMatch& match) const;
 
 private:
     // Check if file extension suggests text content
     static bool IsTextExtension(const std::string& extension);
+    static bool IsBinaryExtension(const std::string& extension);
+    // Earliest match of any pattern in text; returns false if none
+    bool FindFirst(const char* text, size_t text_len, size_t& position, size_t& pattern_index) const;
 
-    // Boyer-Moore-Horspool algorithm for fast text search
-    static bool BoyerMooreSearch(const char* text, size_t text_len, const std::string& pattern);
+    std::vector<std::string> patterns;
+    bool case_insensitive;
+    size_t max_pattern_length = 0;
 };
 
 } // namespace shared
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace stps {
+namespace shared {
+
+// One directory entry found by DirectoryWalker
+struct WalkEntry {
+    std::string path;
+    std::string name;
+    bool is_directory = false;
+    int depth = 0;           // Depth of the containing directory (base path = 0)
+    bool has_stat = false;   // size / modified_time are filled
+    bool stat_failed = false;  // The stat was attempted but failed: size / modified_time unknown
+    int64_t size = 0;        // 0 for directories
+    int64_t modified_time = 0;  // Unix timestamp (seconds)
+    // First content match, filled by content-search filters (-1 = not searched)
+    int64_t match_line = -1;
+    int64_t match_offset = -1;
+};
+
+struct WalkOptions {
+    bool recursive = false;
+    int max_depth = -1;
+    // Stat every entry while its directory is open (size / modified_time needed)
+    bool need_stat = false;
+    // Workers, the consumer included
+    size_t threads = 1;
+    // Rows buffered ahead of the consumer before workers pause
+    size_t queue_capacity = 16384;
+};
+
+// Parallel, work-stealing directory walker on DuckDB's task scheduler.
+//
+// Each worker owns a deque of pending directories: it lists from the back (depth-first,
+// good locality) and idle workers steal from the front of other deques. Worker 0 is the
+// consumer, which lists a directory itself whenever Next() has no rows to return, so the
+// walk also moves on when the scheduler has no thread to spare; the other workers run as
+// TaskExecutor tasks. Local paths on Linux are listed with getdents64 into a 64KB buffer,
+// using d_type to avoid a stat per entry; everything else goes through
+// FileSystem::ListFiles. Accepted entries are queued and drained by the consumer while the
+// walk continues, so rows stream out of large trees.
+class DirectoryWalker {
+public:
+    // Decides whether an entry is emitted. Directories are descended into regardless.
+    using EntryFilter = std::function<bool(WalkEntry& entry)>;
+
+    DirectoryWalker(duckdb::ClientContext& context, duckdb::FileSystem& fs, std::string base_path,
+                    WalkOptions options, EntryFilter filter);
+    ~DirectoryWalker();
+
+    // Move up to max_rows entries into out (appending). Blocks until rows are available;
+    // returns false once the walk has finished and every row was drained. Throws if the
+    // base directory could not be listed (unreadable subdirectories are skipped) and
+    // rethrows the first exception of a worker (e.g. from the filter), which stops the walk.
+    bool Next(std::vector<WalkEntry>& out, size_t max_rows);
+
+    // Fill size / modified_time for an entry that was not stat'ed during the walk; sets
+    // stat_failed instead if the entry cannot be stat'ed
+    static void Stat(duckdb::FileSystem& fs, WalkEntry& entry);
+
+private:
+    friend class DirectoryWalkerTask;
+
+    // Worker id of the consumer (the thread calling Next)
+    static constexpr size_t CONSUMER = 0;
+
+    struct PendingDirectory {
+        std::string path;
+        int depth;
+    };
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<PendingDirectory> directories;
+    };
+
+    void Start(duckdb::ClientContext& context);
+    void WorkerLoop(size_t worker_id);
+    bool TakeDirectory(size_t worker_id, PendingDirectory& out);
+    void PushDirectory(size_t worker_id, PendingDirectory directory);
+    void FinishDirectory();
+    void ListDirectory(size_t worker_id, const PendingDirectory& directory);
+    // Returns false if the walk was stopped. Only the other workers wait for space: the
+    // consumer is the one draining the rows.
+    bool Emit(WalkEntry&& entry, bool wait);
+    void HandleEntry(size_t worker_id, const PendingDirectory& directory, WalkEntry&& entry);
+    // Record a listing failure; only the base directory's is reported to the consumer
+    void ListingFailed(const PendingDirectory& directory, const std::string& message);
+    // Stop the walk after a worker threw (the executor keeps the exception of a task)
+    void WorkerFailed();
+    // Wait for the worker tasks and rethrow the first exception of one of them
+    void JoinWorkers();
+
+    duckdb::FileSystem& fs;
+    std::string base_path;
+    WalkOptions options;
+    EntryFilter filter;
+    bool local_listing;
+    duckdb::unique_ptr<duckdb::TaskExecutor> executor;
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    // Directories pushed but not fully listed yet; the walk is done when this reaches 0
+    std::atomic<int64_t> pending {0};
+    // Directories waiting in a queue (changed under the queue's lock)
+    std::atomic<int64_t> queued {0};
+    std::atomic<bool> stopped {false};
+
+    // Guards output / error / failed; pending and queued are changed before taking it to
+    // notify, so waiters cannot miss a change
+    std::mutex lock;
+    std::condition_variable work_available;  // Workers: a directory was queued or the walk ended
+    std::condition_variable output_ready;    // Consumer: rows, a queued directory, the end or an error
+    std::condition_variable output_space;    // Workers: the consumer drained rows
+    std::deque<WalkEntry> output;
+    std::string error;
+    bool failed = false;
+};
+
+} // namespace shared
+} // namespace stps
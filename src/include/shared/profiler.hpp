@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace stps {
+namespace shared {
+
+// Measurements of one stage, summed over all threads
+struct StageProfile {
+    std::string stage;
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t bytes = 0;
+    uint64_t rows = 0;
+    // Calls per duration bucket: bucket b counts durations below 2^b microseconds (and at
+    // least 2^(b-1)); the last bucket takes everything longer
+    std::vector<uint64_t> histogram;
+};
+
+// Low-overhead instrumentation of the multi-step pipelines (GoBD import, folder import,
+// cloud downloads, time travel capture).
+//
+// Every thread records into its own buffer, so recording only takes that buffer's
+// (uncontended) lock; Snapshot() merges the buffers. Stages are named "area.step" and
+// nested by name: "gobd.import.smart_cast" is a part of "gobd.import". While tracing is
+// on, each timed call is also kept as an event for a Chrome trace (chrome://tracing,
+// Perfetto), up to MAX_TRACE_EVENTS per thread.
+class Profiler {
+public:
+    static constexpr size_t HISTOGRAM_BUCKETS = 32;
+    static constexpr size_t MAX_TRACE_EVENTS = 1 << 20;
+
+    static Profiler& Instance();
+
+    // Record one timed call of stage (a string literal: trace events keep the pointer)
+    void Record(const char* stage, uint64_t start_ns, uint64_t duration_ns, uint64_t bytes, uint64_t rows);
+
+    // Stages with their totals, sorted by name
+    std::vector<StageProfile> Snapshot();
+
+    // Drop all measurements and trace events
+    void Reset();
+
+    bool Enabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    void SetEnabled(bool value) {
+        enabled.store(value, std::memory_order_relaxed);
+    }
+    bool Tracing() const {
+        return tracing.load(std::memory_order_relaxed);
+    }
+    void SetTracing(bool value) {
+        tracing.store(value, std::memory_order_relaxed);
+    }
+
+    // Write the trace events as Chrome trace JSON; returns false if the file cannot be written
+    bool WriteChromeTrace(const std::string& path);
+
+    // Monotonic clock in nanoseconds since the profiler was created
+    uint64_t NowNs() const;
+
+private:
+    struct ThreadBuffer;
+
+    Profiler();
+    ThreadBuffer& Local();
+
+    std::mutex lock;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::atomic<bool> enabled {false};
+    std::atomic<bool> tracing {false};
+    uint32_t next_thread_id = 0;
+};
+
+// Times the enclosing scope as one call of stage. Bytes and rows processed by the step
+// can be added while it runs; Stop() records early (the destructor then does nothing).
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* stage);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    void AddBytes(uint64_t count) {
+        bytes += count;
+    }
+    void AddRows(uint64_t count) {
+        rows += count;
+    }
+    void Stop();
+
+private:
+    const char* stage;
+    uint64_t start_ns;
+    uint64_t bytes = 0;
+    uint64_t rows = 0;
+    bool active;
+};
+
+} // namespace shared
+} // namespace stps
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+
+namespace duckdb {
+namespace stps {
+
+// Union schema of several sources by column name, planned from their headers before any
+// data is read. Columns come in order of first appearance, like UNION ALL BY NAME; a column
+// present with different types gets the wider one (LogicalType::ForceMaxLogicalType).
+// Names match case-insensitively, as in SQL.
+//
+// Each source is then read on its own into the union columns: its columns are mapped by
+// name, cast where the union type differs, and the columns it lacks are NULL.
+class SchemaUnionPlan {
+public:
+    // Add a source's columns; returns the source index
+    idx_t AddSource(const vector<string> &names, const vector<LogicalType> &types);
+
+    idx_t ColumnCount() const {
+        return names.size();
+    }
+    const vector<string> &Names() const {
+        return names;
+    }
+    const vector<LogicalType> &Types() const {
+        return types;
+    }
+
+    // Override a union column's type, e.g. to read every column as VARCHAR
+    void SetType(idx_t column, LogicalType type) {
+        types[column] = std::move(type);
+    }
+
+    // Source column of each union column; DConstants::INVALID_INDEX where the source lacks it
+    vector<idx_t> Mapping(idx_t source) const;
+
+    // Column definitions for CREATE TABLE: "name" TYPE, ...
+    string ColumnDefinitions() const;
+    // SELECT list reading a source in union order. source_columns are the source's column
+    // names as written in SQL (they may differ from the names given to AddSource, e.g. before
+    // normalization); try_cast turns values that do not fit the union type into NULL.
+    string SelectList(idx_t source, const vector<string> &source_columns, bool try_cast = false) const;
+
+private:
+    struct Source {
+        vector<LogicalType> types;
+        // Union column -> source column
+        unordered_map<idx_t, idx_t> columns;
+    };
+
+    vector<string> names;
+    vector<LogicalType> types;
+    case_insensitive_map_t<idx_t> name_index;
+    vector<Source> sources;
+};
+
+} // namespace stps
+} // namespace duckdb
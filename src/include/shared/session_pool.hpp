@@ -0,0 +1,87 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/prepared_statement.hpp"
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+namespace stps {
+
+// An internal connection together with the statements prepared on it
+struct InternalSession {
+    explicit InternalSession(DatabaseInstance &db) : conn(db) {
+    }
+
+    Connection conn;
+    std::unordered_map<string, unique_ptr<PreparedStatement>> statements;
+};
+
+class SessionPool;
+
+// Exclusive use of one pooled connection, handed back to the pool on destruction.
+//
+// Query() runs ad-hoc SQL. Execute() is for the fixed internal queries (catalog lookups,
+// counts, history inserts): the statement is prepared on first use and then reused from
+// this connection's cache, keyed by its SQL text, so only the parameters change per call.
+class SessionLease {
+public:
+    SessionLease(shared_ptr<SessionPool> pool, unique_ptr<InternalSession> session);
+    ~SessionLease();
+
+    SessionLease(SessionLease &&other) noexcept = default;
+    SessionLease(const SessionLease &) = delete;
+    SessionLease &operator=(const SessionLease &) = delete;
+    SessionLease &operator=(SessionLease &&) = delete;
+
+    Connection &Conn() {
+        return session->conn;
+    }
+
+    unique_ptr<MaterializedQueryResult> Query(const string &sql) {
+        return session->conn.Query(sql);
+    }
+
+    // Run a cached prepared statement; sql uses ? placeholders for params. Errors are
+    // returned in the result like Query(), and drop the statement from the cache.
+    unique_ptr<MaterializedQueryResult> Execute(const string &sql, vector<Value> params = {});
+
+private:
+    shared_ptr<SessionPool> pool;
+    unique_ptr<InternalSession> session;
+};
+
+// Reusable connections for the extension's internal SQL, so a function call does not pay
+// for a new client context and re-planning its fixed queries every time.
+//
+// The pool lives in the calling client context (registered state) and is dropped with it.
+// It is not attached to the database itself: its connections hold a reference to the
+// database, which would then never be closed. Leases are thread-safe to acquire; each
+// lease is used by one thread at a time.
+class SessionPool : public ClientContextState {
+public:
+    static constexpr idx_t MAX_IDLE_SESSIONS = 8;
+    static constexpr idx_t MAX_CACHED_STATEMENTS = 128;
+
+    explicit SessionPool(DatabaseInstance &db);
+
+    static shared_ptr<SessionPool> Get(ClientContext &context);
+
+    // Lease a connection of context's pool (a new one if all are in use)
+    static SessionLease Acquire(ClientContext &context);
+
+private:
+    friend class SessionLease;
+
+    void Release(unique_ptr<InternalSession> session);
+
+    DatabaseInstance &db;
+    std::mutex lock;
+    vector<unique_ptr<InternalSession>> idle;
+};
+
+} // namespace stps
+} // namespace duckdb
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "duckdb/common/types/string_type.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace stps {
+namespace shared {
+
+// Bump allocator for short-lived strings (parsed fields, escaped values).
+//
+// Memory is handed out from 64KB blocks; Reset() rewinds to the first block without
+// freeing, so a parser that resets once per chunk stops allocating after warm-up.
+// Requests larger than a block get a dedicated block that is kept for reuse as well.
+// Each block allocation is counted in the profiler as stage "arena.block" (bytes = block
+// size), so stps_profile() shows how often row building still reaches the heap; after
+// ReleaseAll() the count starts from cold arenas again.
+// Not thread-safe: use one arena per thread (see ThreadLocal()).
+class StringArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit StringArena(size_t block_size = DEFAULT_BLOCK_SIZE);
+
+    // Uninitialized memory valid until the next Reset()
+    char* Allocate(size_t size);
+
+    // Copy bytes into the arena and return a view of the copy
+    duckdb::string_t Copy(const char* data, size_t size);
+
+    // Rewind; previously returned memory becomes invalid. Frees the kept blocks instead
+    // if ReleaseAll() was called since the last Reset().
+    void Reset();
+
+    // Make every arena free its kept blocks at its next Reset() (each on its own thread),
+    // so the blocks allocated afterwards can be counted from a cold start
+    static void ReleaseAll();
+
+    // Number of blocks obtained from the system allocator so far
+    size_t BlockAllocations() const {
+        return block_allocations;
+    }
+
+    // Arena owned by the calling thread
+    static StringArena& ThreadLocal();
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    size_t block_size;
+    std::vector<Block> blocks;
+    size_t current = 0;  // Index of the block being filled
+    size_t used = 0;     // Bytes used in blocks[current]
+    size_t block_allocations = 0;
+    uint64_t generation = 0;  // Value of the ReleaseAll() counter at the last Reset()
+};
+
+// Iterates the lines of an in-memory buffer without copying. A trailing '\r' is dropped
+// and empty lines are skipped.
+class LineCursor {
+public:
+    LineCursor(const char* data, size_t size, size_t position = 0);
+
+    // Next non-empty line; returns false at the end of the buffer
+    bool Next(const char*& line, size_t& length);
+
+    // Byte offset of the first unread line
+    size_t Position() const {
+        return position;
+    }
+
+private:
+    const char* data;
+    size_t size;
+    size_t position;
+};
+
+// Split one CSV line into field views. Quotes (quote, '"' by default) group delimiters into
+// one field and are dropped; inside quotes a doubled quote ("") is a literal quote. A quote
+// of '\0' disables quoting. Fields without quotes point into line (zero copy, so line must
+// outlive them); quoted fields are unescaped into arena. fields is cleared first and always
+// receives at least one field.
+void SplitCsvLine(const char* line, size_t length, char delimiter, StringArena& arena,
+                  std::vector<duckdb::string_t>& fields, char quote = '"');
+
+} // namespace shared
+} // namespace stps
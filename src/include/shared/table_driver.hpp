@@ -0,0 +1,91 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "shared/catalog_helper.hpp"
+#include "shared/session_pool.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace duckdb {
+namespace stps {
+
+// Options of a database-wide table function, from its named parameters
+struct TableDriverOptions {
+    // Worker threads; 0 = DuckDB thread count
+    idx_t threads = 0;
+    // true: tables in list order, each table's rows together. false: largest tables first,
+    // which keeps all threads busy until the end.
+    bool preserve_order = true;
+};
+
+// Per-thread state of a driven scan. Functions derive from it to keep their cursor
+// through the current table; every thread has its own pooled connection.
+class TableDriverLocalState : public LocalTableFunctionState {
+public:
+    explicit TableDriverLocalState(ClientContext &context);
+
+    // Start on a table
+    virtual void BeginTable(ClientContext &context, const CatalogTableInfo &table) = 0;
+    // Write the table's next rows to output (at most STANDARD_VECTOR_SIZE, possibly none);
+    // false once the table is done
+    virtual bool NextRows(ClientContext &context, DataChunk &output) = 0;
+
+    SessionLease session;
+
+private:
+    friend class ParallelTableDriver;
+
+    bool active = false;
+    idx_t work_index = 0;
+};
+
+// "For each table" driver for database-wide table functions. Used as the function's global
+// state: DuckDB's own worker threads call Scan() and each claims whole tables, so no extra
+// threads are started.
+//
+// Each table's rows carry the table's position in the work list as batch index. With
+// insertion order preserved (DuckDB's default) the rows therefore come out grouped per
+// table in work-list order, however the threads interleave; without it they come out as
+// produced. Tables are streamed by the functions, so claims are not limited by memory. Rows
+// are produced while the scan runs: a LIMIT or a cancelled query stops before the remaining
+// tables.
+class ParallelTableDriver : public GlobalTableFunctionState {
+public:
+    ParallelTableDriver(ClientContext &context, const vector<CatalogTableInfo> &tables, TableDriverOptions options);
+
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
+
+    void Scan(ClientContext &context, TableDriverLocalState &local, DataChunk &output);
+    // Completed share of the estimated work, in percent
+    double Progress() const;
+
+    // Named parameters threads and preserve_order
+    static void AddNamedParameters(TableFunction &function);
+    static TableDriverOptions ParseOptions(const named_parameter_map_t &parameters, const string &function_name);
+
+    // Callbacks for the TableFunction
+    static OperatorPartitionData GetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input);
+    static double ScanProgress(ClientContext &context, const FunctionData *bind_data,
+                               const GlobalTableFunctionState *global_state);
+
+private:
+    bool Claim(TableDriverLocalState &local);
+    void Finish(TableDriverLocalState &local);
+
+    const vector<CatalogTableInfo> &tables;
+    // Table indexes in processing order
+    vector<idx_t> work;
+    idx_t max_threads;
+
+    std::mutex lock;
+    idx_t next_work = 0;
+    std::atomic<idx_t> finished_weight {0};
+    idx_t total_weight = 0;
+};
+
+} // namespace stps
+} // namespace duckdb
@@ -23,12 +23,43 @@ enum class DateFormat {
     YMD   // Year-Month-Day (ISO)
 };
 
+// Fixed-layout date kernel, selected once per column after type detection.
+// Values that do not match the kernel's layout fall back to the generic parser.
+enum class DateKernel {
+    GENERIC,         // No fixed layout, always use ParseDate/ParseTimestamp
+    ISO,             // YYYY-MM-DD
+    DAY_MONTH_YEAR,  // DD.MM.YYYY (also / and -; MM/DD/YYYY when the column format is MDY)
+    COMPACT_YMD,     // YYYYMMDD
+    COMPACT_DMY      // DDMMYYYY
+};
+
+// Result of SmartCastUtils::ScanNumber. The value is
+// (negative ? -1 : 1) * mantissa * 10^exponent, divided by 100 for percentages.
+struct ScannedNumber {
+    bool negative = false;
+    bool explicit_plus = false;
+    bool percentage = false;
+    bool has_decimal_separator = false;
+    bool has_grouping = false;
+    bool has_exponent = false;
+    idx_t integer_digits = 0;
+    idx_t fraction_digits = 0;
+    idx_t first_group_digits = 0;   // Integer digits before the first thousands separator
+    uint64_t mantissa = 0;          // Up to 19 significant digits
+    idx_t significant_digits = 0;
+    int32_t exponent = 0;
+    bool truncated = false;         // More than 19 significant digits
+    const char* body = nullptr;     // Sign through last digit, for the strtod fallback
+    idx_t body_len = 0;
+};
+
 // Detected type for a value
 enum class DetectedType {
     UNKNOWN,
     BOOLEAN,
     INTEGER,
     DOUBLE,
+    DECIMAL,  // DECIMAL(18,2); only as an explicit target, never auto-detected
     DATE,
     TIMESTAMP,
     UUID,
@@ -47,6 +78,7 @@ struct ColumnAnalysis {
     int64_t cast_failure_count;
     NumberLocale detected_locale;
     DateFormat detected_date_format;
+    DateKernel date_kernel = DateKernel::GENERIC;
 };
 
 // Smart cast utilities - Windows-safe implementation without static regex objects
@@ -70,10 +102,32 @@ public:
     static bool ParseBoolean(const std::string& value, bool& out_result);
     static bool ParseInteger(const std::string& value, NumberLocale locale, int64_t& out_result);
     static bool ParseDouble(const std::string& value, NumberLocale locale, double& out_result);
+    // Exact fixed-point parse into an unscaled DECIMAL(18, scale) value (rounds half away from zero)
+    static bool ParseDecimal(const std::string& value, NumberLocale locale, uint8_t scale, int64_t& out_result);
     static bool ParseDate(const std::string& value, DateFormat format, date_t& out_result);
     static bool ParseTimestamp(const std::string& value, DateFormat format, timestamp_t& out_result);
     static bool ParseUUID(const std::string& value, std::string& out_result);
 
+    // Single-pass, allocation-free number scan over a byte span: surrounding whitespace,
+    // a leading or trailing currency symbol, sign, locale grouping, decimal separator,
+    // exponent and a trailing percent sign. Returns false if the span is not one number.
+    static bool ScanNumber(const char* data, idx_t len, NumberLocale locale, ScannedNumber& out);
+    static bool ScannedToDouble(const ScannedNumber& number, NumberLocale locale, double& out_result);
+    static bool ScannedToDecimal(const ScannedNumber& number, uint8_t scale, int64_t& out_result);
+
+    // Pick the fixed-layout date kernel matching most of the sample values (never
+    // COMPACT_DMY: like ParseDate, undeclared 8-digit dates are YYYYMMDD).
+    // Timestamp columns use the kernel for their date part, followed by [ T]HH:MM[:SS].
+    static DateKernel SelectDateKernel(const std::vector<std::string>& values, DetectedType type);
+
+    // Allocation-free parse of a raw (untrimmed) value with a column's kernel. Matches
+    // ParseDate/ParseTimestamp on every layout they accept; they remain the fallback
+    // for any value the kernel does not read as a valid date.
+    static bool ParseDateFast(DateKernel kernel, const char* data, idx_t len, DateFormat format,
+                              date_t& out_result);
+    static bool ParseTimestampFast(DateKernel kernel, const char* data, idx_t len, DateFormat format,
+                                   timestamp_t& out_result);
+
     // Convert DetectedType to LogicalType
     static LogicalType ToLogicalType(DetectedType type);
 
@@ -86,11 +140,8 @@ public:
 private:
     // Helper functions for manual parsing (Windows-safe, no static regex)
     static bool IsValidUUID(const std::string& value);
-    static bool MatchesGermanNumberFormat(const std::string& value);
-    static bool MatchesUSNumberFormat(const std::string& value);
-    static bool RemoveCurrencySymbol(std::string& value);
-    static bool RemovePercentage(std::string& value, bool& was_percentage);
-    static bool IsValidThousandsSeparatorFormat(const std::string& value, char thousands_sep);
+    // Unambiguous locale layout: -?\d{1,3}(<thousands>\d{3})*<decimal>\d+ (affixes allowed)
+    static bool MatchesNumberLayout(const std::string& value, NumberLocale locale);
 };
 
 } // namespace stps
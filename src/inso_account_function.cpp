@@ -3,73 +3,65 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "inso_account_matcher.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <sstream>
 
 namespace duckdb {
 namespace stps {
 
-// Helper: lowercase a string
-static string ToLowerInso(const string &s) {
-    string result;
-    result.reserve(s.size());
-    for (char c : s) {
-        result += std::tolower(static_cast<unsigned char>(c));
-    }
-    return result;
-}
-
-// Helper: extract leading digits from account number as prefix
-static string AccountPrefix(int64_t konto, int len) {
-    string s = std::to_string(konto);
-    if ((int)s.size() <= len) return s;
-    return s.substr(0, len);
-}
+// A resolved EA mapping for one counter-account
+struct InsoMapping {
+    string ea_konto;
+    string ea_bezeichnung;
+    string mapping_source;
+};
 
-// Helper: compute simple word overlap score between two strings (case-insensitive)
-static double NameSimilarity(const string &a, const string &b) {
-    auto tokenize = [](const string &s) -> vector<string> {
-        vector<string> tokens;
-        string current;
-        for (char c : s) {
-            if (std::isalnum(static_cast<unsigned char>(c))) {
-                current += std::tolower(static_cast<unsigned char>(c));
-            } else {
-                if (!current.empty()) {
-                    tokens.push_back(current);
-                    current.clear();
-                }
-            }
-        }
-        if (!current.empty()) tokens.push_back(current);
-        return tokens;
+// All mapping structures derived from one client's konto / inso_kontenrahmen / journal
+struct InsoAccountMappings {
+    // Kreditor konto -> dominant Aufwand's EA mapping
+    std::unordered_map<int64_t, InsoMapping> kreditor_map;
+    // Aufwand konto -> EA mapping
+    std::unordered_map<int64_t, InsoMapping> aufwand_ea_map;
+    // Sachkonto -> EA mapping
+    std::unordered_map<int64_t, InsoMapping> sachkonto_ea_map;
+    // Indexed matcher over the inso kontenrahmen entries
+    unique_ptr<InsoAccountMatcher> matcher;
+    // All konto entries (kontoart, konto number, bezeichnung)
+    struct KontoEntry {
+        string kontoart;
+        int64_t konto;
+        string kontobezeichnung;
     };
+    vector<KontoEntry> konto_entries;
+};
 
-    auto tokens_a = tokenize(a);
-    auto tokens_b = tokenize(b);
-    if (tokens_a.empty() || tokens_b.empty()) return 0.0;
-
-    int matches = 0;
-    for (const auto &ta : tokens_a) {
-        for (const auto &tb : tokens_b) {
-            if (ta == tb) {
-                matches++;
-                break;
-            }
-        }
-    }
-    // Jaccard-like: matches / max(size_a, size_b)
-    return (double)matches / (double)std::max(tokens_a.size(), tokens_b.size());
-}
-
-// An entry from rl.inso_kontenrahmen
-struct InsoKontoEntry {
-    string kontoart;       // "Einnahmekonten" or "Ausgabekonten"
-    string decEAKontoNr;   // e.g. "4970", "8200"
-    string kontobezeichnung;
+// Number of mapping columns appended after the original columns
+static constexpr idx_t INSO_MAPPING_COLUMNS = 6;
+
+// Key columns fetched (cast to BIGINT/VARCHAR) after the projected columns when mapping is needed
+enum InsoKeyColumn : idx_t {
+    KEY_KONTO = 0,
+    KEY_KONTOBEZEICHNUNG = 1,
+    KEY_KONTOART = 2,
+    KEY_GEGENKONTO = 3,
+    KEY_GEGENKONTOBEZEICHNUNG = 4,
+    KEY_GEGENKONTOART = 5,
+    KEY_COUNT = 6
 };
 
 // Bind data
@@ -79,40 +71,44 @@ struct InsoAccountBindData : public TableFunctionData {
     // Original columns from source table
     vector<string> original_column_names;
     vector<LogicalType> original_column_types;
+    // Simple comparison filters pushed into the journal query (DuckDB re-checks them)
+    vector<string> pushed_filters;
+};
+
+// Output marker for columns that are computed rather than fetched
+static constexpr idx_t INSO_MAPPING_SOURCE = DConstants::INVALID_INDEX - 1;  // one of the mapping columns
+static constexpr idx_t INSO_CLIENT_SOURCE = DConstants::INVALID_INDEX - 2;   // batch: client_schema
+static constexpr idx_t INSO_BANK_SOURCE = DConstants::INVALID_INDEX - 3;     // batch: bank_account
+
+// Projection plan shared by stps_inso_account and stps_inso_account_batch
+struct InsoProjection {
+    // Select list for the journal query
+    string select_list;
+    // For each output column: index into the result chunk (original columns), one of the
+    // INSO_*_SOURCE markers, or DConstants::INVALID_INDEX (row id -> NULL)
+    vector<idx_t> output_source;
+    // For each mapping column: its output position, or DConstants::INVALID_INDEX if not projected
+    idx_t mapping_output[INSO_MAPPING_COLUMNS];
+    bool need_mapping = false;
+    bool need_keys = false;
+    // Position of the first key column in the result chunk
+    idx_t key_offset = 0;
 };
 
 // Global state
 struct InsoAccountGlobalState : public GlobalTableFunctionState {
-    // Mapping tables built at init time
-    // Kreditor konto -> (ea_konto, ea_bezeichnung, mapping_source)
-    std::unordered_map<int64_t, std::tuple<string, string, string>> kreditor_map;
-    // Aufwand konto -> (ea_konto, ea_bezeichnung)
-    std::unordered_map<int64_t, std::pair<string, string>> aufwand_ea_map;
-    // Sachkonto -> (ea_konto, ea_bezeichnung)
-    std::unordered_map<int64_t, std::pair<string, string>> sachkonto_ea_map;
-    // All inso kontenrahmen entries (for matching)
-    vector<InsoKontoEntry> inso_entries;
-    // All konto entries (kontoart, konto number, bezeichnung)
-    struct KontoEntry {
-        string kontoart;
-        int64_t konto;
-        string kontobezeichnung;
-    };
-    vector<KontoEntry> konto_entries;
+    InsoAccountMappings mappings;
+    InsoProjection projection;
 
-    // Query result for bank transactions
+    // Query result for bank transactions (shared by all scan threads)
+    std::mutex lock;
     unique_ptr<QueryResult> result;
-    unique_ptr<DataChunk> current_chunk;
-    idx_t chunk_offset = 0;
     bool finished = false;
+    idx_t max_threads = 1;
 
-    // Column indices in the source result
-    idx_t col_decKontoNr = 0;
-    idx_t col_kontobezeichnung = 0;
-    idx_t col_kontoart = 0;
-    idx_t col_decGegenkontoNr = 0;
-    idx_t col_gegenkontobezeichnung = 0;
-    idx_t col_gegenkontoart = 0;
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
 };
 
 // Helper: find the schema prefix for a table name (e.g. "rl.buchungen" -> "rl")
@@ -140,305 +136,63 @@ static string EscapeTableRef(const string &table_name) {
     return EscapeId(table_name);
 }
 
-// ============================================================================
-// Tier 1: SKR03/04 account range -> EA account candidates
-// Maps the first 3 digits of commercial Aufwand accounts to EA-Konto(s)
-// ============================================================================
-struct RangeMapping {
-    int range_start;  // first 3 digits * 1000 (e.g. 530 -> 530000)
-    int range_end;    // exclusive upper bound
-    const char *ea_konto;
-    const char *ea_bezeichnung;
-};
-
-static const RangeMapping RANGE_MAPPINGS[] = {
-    // Wareneinkauf
-    {530000, 540000, "3220", "Wareneingang - 7% Ust"},
-    {540000, 550000, "3200", "Wareneingang - 19% Ust"},
-    // Personal
-    {600000, 610000, "4100", "Loehne und Gehaelter"},
-    {610000, 613000, "4130", "Gesetzliche Sozialaufwendungen"},
-    {613000, 620000, "4100", "Loehne und Gehaelter"},
-    // Abschreibungen (no direct EA equivalent -> 4900)
-    {620000, 630000, "4900", "Sonstige betriebliche Aufwendungen"},
-    // Raumkosten / Betriebskosten
-    {630000, 633000, "4200", "Raumkosten"},
-    {633000, 640000, "4903", "Fremdleistungen und Fremdarbeiten"},
-    // Steuern, Versicherungen, Beitraege
-    {640000, 650000, "4360", "Versicherungen - allgemein"},
-    // Vertrieb, Bewirtung, Reisekosten
-    {650000, 660000, "4980", "Sonstiger Betriebsbedarf"},
-    {660000, 670000, "4600", "Werbekosten"},
-    // Provisionen, Gebuehren -> Nebenkosten Geldverkehr
-    {670000, 680000, "4970", "Nebenkosten des Geldverkehr"},
-    // Verschiedene betriebliche Aufwendungen
-    {680000, 682000, "4920", "Telekommunikationskosten"},
-    {682000, 685000, "4900", "Sonstige betriebliche Aufwendungen"},
-    {685000, 686000, "4980", "Sonstiger Betriebsbedarf"},
-    {686000, 690000, "4900", "Sonstige betriebliche Aufwendungen"},
-    // Zinsen
-    {700000, 710000, "2100", "Zinsen und aehnliche Aufwendungen"},
-};
-static const int NUM_RANGE_MAPPINGS = sizeof(RANGE_MAPPINGS) / sizeof(RANGE_MAPPINGS[0]);
-
-// ============================================================================
-// Tier 2: Keyword/synonym table
-// Maps German accounting keywords to specific EA accounts
-// ============================================================================
-struct KeywordMapping {
-    const char *keyword;       // keyword to search for in the account name (lowercase)
-    const char *ea_konto;
-    const char *ea_bezeichnung;
-};
-
-static const KeywordMapping KEYWORD_MAPPINGS[] = {
-    // Provisionen / Geldverkehr
-    {"provisionen", "4970", "Nebenkosten des Geldverkehr"},
-    {"kreditkartenprovision", "4970", "Nebenkosten des Geldverkehr"},
-    {"bankgebuehr", "4970", "Nebenkosten des Geldverkehr"},
-    {"geldverkehr", "4970", "Nebenkosten des Geldverkehr"},
-    // Reinigung
-    {"waeschereinigung", "4250", "Reinigung"},
-    {"reinigung", "4250", "Reinigung"},
-    // Telekommunikation / Internet
-    {"internet", "4920", "Telekommunikationskosten"},
-    {"telekommunikation", "4920", "Telekommunikationskosten"},
-    {"telefon", "4920", "Telekommunikationskosten"},
-    // Buerobedarf / Drucksachen
-    {"drucksachen", "4930", "Buerobedarf"},
-    {"buerobedarf", "4930", "Buerobedarf"},
-    {"buero", "4930", "Buerobedarf"},
-    // Fremdleistungen
-    {"fachkraefte", "4903", "Fremdleistungen und Fremdarbeiten"},
-    {"fremdleistung", "4903", "Fremdleistungen und Fremdarbeiten"},
-    {"externe", "4903", "Fremdleistungen und Fremdarbeiten"},
-    // Mahnkosten / Rechtsverfolgung
-    {"mahnkosten", "4951", "Nebenkosten der Rechtsverfolgung"},
-    {"mahngebuehr", "4951", "Nebenkosten der Rechtsverfolgung"},
-    {"inkasso", "4951", "Nebenkosten der Rechtsverfolgung"},
-    // Gaestebedarf / Betriebsbedarf
-    {"gaestebedarf", "4980", "Sonstiger Betriebsbedarf"},
-    {"werkzeug", "4980", "Sonstiger Betriebsbedarf"},
-    {"kleinmaterial", "4980", "Sonstiger Betriebsbedarf"},
-    {"ersatzbeschaffung", "4980", "Sonstiger Betriebsbedarf"},
-    // Geldabholung / Geldtransport
-    {"geldabholung", "4970", "Nebenkosten des Geldverkehr"},
-    {"wechselgeld", "4970", "Nebenkosten des Geldverkehr"},
-    // Miete / Pacht
-    {"miete", "4210", "Miete und Pacht"},
-    {"pacht", "4210", "Miete und Pacht"},
-    // Gas, Strom, Wasser
-    {"strom", "4240", "Gas, Strom, Wasser"},
-    {"gas", "4240", "Gas, Strom, Wasser"},
-    {"wasser", "4240", "Gas, Strom, Wasser"},
-    {"fernwaerme", "4240", "Gas, Strom, Wasser"},
-    {"heizung", "4240", "Gas, Strom, Wasser"},
-    // Versicherungen
-    {"versicherung", "4360", "Versicherungen - allgemein"},
-    // Berufsgenossenschaft
-    {"berufsgenossenschaft", "4138", "Beitraege zur Berufsgenossenschaft"},
-    // Abfallbeseitigung
-    {"abfall", "4969", "Aufwand Abraum-/Abfallbeseitigung"},
-    {"entsorgung", "4969", "Aufwand Abraum-/Abfallbeseitigung"},
-    // Reparatur / Instandhaltung
-    {"reparatur", "4800", "Reparatur/Instandh. Anlagen u. Maschinen"},
-    {"instandhaltung", "4800", "Reparatur/Instandh. Anlagen u. Maschinen"},
-    {"wartung", "4806", "Wartungskosten fuer Hard- und Software"},
-    // Leasing
-    {"leasing", "4810", "Mietleasing"},
-    // Rechts- und Beratungskosten
-    {"rechtsberatung", "4950", "Rechts- und Beratungskosten (Sonderaufgaben)"},
-    {"beratung", "4950", "Rechts- und Beratungskosten (Sonderaufgaben)"},
-    {"steuerberatung", "4955", "Buchfuehrungskosten"},
-    {"buchfuehrung", "4955", "Buchfuehrungskosten"},
-    // Reisekosten
-    {"reisekosten", "4660", "Reisekosten"},
-    // Fahrzeug
-    {"fahrzeug", "4500", "Fahrzeugkosten"},
-    {"kfz", "4500", "Fahrzeugkosten"},
-    // Porto
-    {"porto", "4910", "Porto"},
-    // Kundenbindung / Werbung
-    {"kundenbindung", "4600", "Werbekosten"},
-    {"werbung", "4600", "Werbekosten"},
-};
-static const int NUM_KEYWORD_MAPPINGS = sizeof(KEYWORD_MAPPINGS) / sizeof(KEYWORD_MAPPINGS[0]);
-
-// Helper: normalize German umlauts for keyword matching
-static string NormalizeUmlauts(const string &s) {
-    string result;
-    result.reserve(s.size());
-    for (size_t i = 0; i < s.size(); i++) {
-        unsigned char c = static_cast<unsigned char>(s[i]);
-        // UTF-8 two-byte sequences for German umlauts
-        if (c == 0xC3 && i + 1 < s.size()) {
-            unsigned char next = static_cast<unsigned char>(s[i + 1]);
-            if (next == 0xA4 || next == 0x84) { result += "ae"; i++; continue; } // ae/Ae
-            if (next == 0xB6 || next == 0x96) { result += "oe"; i++; continue; } // oe/Oe
-            if (next == 0xBC || next == 0x9C) { result += "ue"; i++; continue; } // ue/Ue
-            if (next == 0x9F)                 { result += "ss"; i++; continue; } // ss
-        }
-        result += std::tolower(c);
-    }
-    return result;
+// Helper: key column select list (order matches InsoKeyColumn)
+static string InsoKeyColumnsSql() {
+    return "CAST(\"decKontoNr\" AS BIGINT), CAST(\"kontobezeichnung\" AS VARCHAR), "
+           "CAST(\"kontoart\" AS VARCHAR), CAST(\"decGegenkontoNr\" AS BIGINT), "
+           "CAST(\"gegenkontobezeichnung\" AS VARCHAR), CAST(\"gegenkontoart\" AS VARCHAR)";
 }
 
-// Find best matching Ausgabekonten entry for an Aufwand account
-// Uses 3-tier matching: (1) account range, (2) keyword/synonym, (3) name similarity
-static std::pair<string, string> FindBestAusgabeMatch(
-    int64_t aufwand_konto, const string &aufwand_bezeichnung,
-    const vector<InsoKontoEntry> &inso_entries) {
-
-    // ---- Tier 1: Account range mapping ----
-    // Use the raw account number (e.g. 677013) to find the range
-    for (int i = 0; i < NUM_RANGE_MAPPINGS; i++) {
-        if ((int)aufwand_konto >= RANGE_MAPPINGS[i].range_start &&
-            (int)aufwand_konto < RANGE_MAPPINGS[i].range_end) {
-            // Found a range match - but check if Tier 2 can refine it
-            string range_ea = RANGE_MAPPINGS[i].ea_konto;
-            string range_bez = RANGE_MAPPINGS[i].ea_bezeichnung;
-
-            // ---- Tier 2: Keyword refinement within the range ----
-            string normalized_name = NormalizeUmlauts(ToLowerInso(aufwand_bezeichnung));
-            for (int k = 0; k < NUM_KEYWORD_MAPPINGS; k++) {
-                if (normalized_name.find(KEYWORD_MAPPINGS[k].keyword) != string::npos) {
-                    // Keyword match overrides the range default
-                    return {KEYWORD_MAPPINGS[k].ea_konto, KEYWORD_MAPPINGS[k].ea_bezeichnung};
-                }
-            }
-
-            // No keyword refinement, use range default
-            return {range_ea, range_bez};
-        }
-    }
-
-    // ---- Tier 2 standalone: keyword matching (for accounts outside known ranges) ----
-    {
-        string normalized_name = NormalizeUmlauts(ToLowerInso(aufwand_bezeichnung));
-        for (int k = 0; k < NUM_KEYWORD_MAPPINGS; k++) {
-            if (normalized_name.find(KEYWORD_MAPPINGS[k].keyword) != string::npos) {
-                return {KEYWORD_MAPPINGS[k].ea_konto, KEYWORD_MAPPINGS[k].ea_bezeichnung};
-            }
-        }
+// Resolve projection pushdown. Output columns are laid out as
+// [prefix columns (batch only)] [original columns] [mapping columns]; only projected
+// original columns are fetched. If cast_types is set, originals are cast to the bound
+// types (batch: journals of different clients may differ slightly).
+static InsoProjection PlanInsoProjection(const vector<column_t> &column_ids, const vector<string> &original_names,
+                                         const vector<LogicalType> &original_types, idx_t prefix_columns,
+                                         bool always_keys, bool cast_types) {
+    InsoProjection plan;
+    idx_t num_original = original_names.size();
+    idx_t fetched = 0;
+    for (idx_t i = 0; i < INSO_MAPPING_COLUMNS; i++) {
+        plan.mapping_output[i] = DConstants::INVALID_INDEX;
     }
-
-    // ---- Tier 3: Name similarity (original algorithm) ----
-    string best_ea;
-    string best_bezeichnung;
-    double best_score = -1.0;
-
-    string aufwand_str = std::to_string(aufwand_konto);
-
-    for (const auto &entry : inso_entries) {
-        if (entry.kontoart != "Ausgabekonten") continue;
-
-        double score = 0.0;
-
-        string ea_nr = entry.decEAKontoNr;
-        string ea_numeric;
-        for (char c : ea_nr) {
-            if (std::isdigit(static_cast<unsigned char>(c))) {
-                ea_numeric += c;
+    for (idx_t out_idx = 0; out_idx < column_ids.size(); out_idx++) {
+        auto column_id = column_ids[out_idx];
+        if (column_id < prefix_columns) {
+            plan.output_source.push_back(column_id == 0 ? INSO_CLIENT_SOURCE : INSO_BANK_SOURCE);
+        } else if (column_id < prefix_columns + num_original) {
+            idx_t original = column_id - prefix_columns;
+            if (!plan.select_list.empty()) plan.select_list += ", ";
+            if (cast_types) {
+                plan.select_list += "CAST(" + EscapeId(original_names[original]) + " AS " +
+                                    original_types[original].ToString() + ")";
             } else {
-                break;
+                plan.select_list += EscapeId(original_names[original]);
             }
-        }
-
-        int prefix_match = 0;
-        int max_check = std::min({(int)aufwand_str.size(), (int)ea_numeric.size(), 4});
-        for (int i = 0; i < max_check; i++) {
-            if (aufwand_str[i] == ea_numeric[i]) {
-                prefix_match++;
-            } else {
-                break;
-            }
-        }
-        score += prefix_match * 2.0;
-
-        double name_score = NameSimilarity(aufwand_bezeichnung, entry.kontobezeichnung);
-        score += name_score * 10.0;
-
-        if (score > best_score) {
-            best_score = score;
-            best_ea = entry.decEAKontoNr;
-            best_bezeichnung = entry.kontobezeichnung;
+            plan.output_source.push_back(fetched++);
+        } else if (column_id < prefix_columns + num_original + INSO_MAPPING_COLUMNS) {
+            plan.mapping_output[column_id - prefix_columns - num_original] = out_idx;
+            plan.need_mapping = true;
+            plan.output_source.push_back(INSO_MAPPING_SOURCE);
+        } else {
+            plan.output_source.push_back(DConstants::INVALID_INDEX);
         }
     }
-
-    if (best_score < 2.0) {
-        return {"4900", "Sonstige betriebliche Aufwendungen"};
+    plan.need_keys = plan.need_mapping || always_keys;
+    if (plan.need_keys) {
+        if (!plan.select_list.empty()) plan.select_list += ", ";
+        plan.select_list += InsoKeyColumnsSql();
+        plan.key_offset = fetched;
     }
-
-    return {best_ea, best_bezeichnung};
-}
-
-// Find best matching entry for a Sachkonto
-static std::pair<string, string> FindBestSachkontoMatch(
-    int64_t sachkonto, const string &sachkonto_bezeichnung,
-    const vector<InsoKontoEntry> &inso_entries) {
-
-    // Check if it's a Vorsteuer account (14xxxx range)
-    string konto_str = std::to_string(sachkonto);
-    if (konto_str.size() >= 2 && konto_str.substr(0, 2) == "14") {
-        // Vorsteuer -> 1780 (Umsatzsteuerzahlungen)
-        return {"1780", "Umsatzsteuerzahlungen"};
+    if (plan.select_list.empty()) {
+        // e.g. COUNT(*): only the row count is needed
+        plan.select_list = "NULL";
     }
-
-    // For other Sachkonten, try name matching across all inso entries
-    string best_ea;
-    string best_bezeichnung;
-    double best_score = -1.0;
-
-    for (const auto &entry : inso_entries) {
-        double name_score = NameSimilarity(sachkonto_bezeichnung, entry.kontobezeichnung);
-        if (name_score > best_score && name_score > 0.2) {
-            best_score = name_score;
-            best_ea = entry.decEAKontoNr;
-            best_bezeichnung = entry.kontobezeichnung;
-        }
-    }
-
-    // Return empty if no match found (will show as NULL)
-    return {best_ea, best_bezeichnung};
+    return plan;
 }
 
-// Bind function
-static unique_ptr<FunctionData> InsoAccountBind(ClientContext &context, TableFunctionBindInput &input,
-                                                 vector<LogicalType> &return_types, vector<string> &names) {
-    auto result = make_uniq<InsoAccountBindData>();
-
-    if (input.inputs.size() < 1) {
-        throw BinderException("stps_inso_account requires at least 1 argument: source table name");
-    }
-    result->source_table = input.inputs[0].GetValue<string>();
-
-    // Get bank_account named parameter
-    auto it = input.named_parameters.find("bank_account");
-    if (it != input.named_parameters.end()) {
-        result->bank_account = it->second.GetValue<int64_t>();
-    } else {
-        throw BinderException("stps_inso_account requires named parameter bank_account");
-    }
-
-    // Query source table schema
-    Connection conn(context.db->GetDatabase(context));
-    string escaped_table = EscapeTableRef(result->source_table);
-    auto schema_result = conn.Query("SELECT * FROM " + escaped_table + " LIMIT 0");
-    if (schema_result->HasError()) {
-        throw BinderException("stps_inso_account: cannot query table '%s': %s",
-                              result->source_table, schema_result->GetError());
-    }
-
-    result->original_column_names = schema_result->names;
-    result->original_column_types = schema_result->types;
-
-    // Set return types: all original columns + extra columns
-    for (idx_t i = 0; i < schema_result->names.size(); i++) {
-        names.push_back(schema_result->names[i]);
-        return_types.push_back(schema_result->types[i]);
-    }
-
-    // Additional columns
+// Add the six mapping column names/types (shared by single and batch bind)
+static void AddInsoMappingColumns(vector<LogicalType> &return_types, vector<string> &names) {
     names.push_back("counter_konto");
     return_types.push_back(LogicalType::BIGINT);
 
@@ -456,25 +210,22 @@ static unique_ptr<FunctionData> InsoAccountBind(ClientContext &context, TableFun
 
     names.push_back("mapping_source");
     return_types.push_back(LogicalType::VARCHAR);
-
-    return std::move(result);
 }
 
-// Init function: build lookup maps and execute filtered query
-static unique_ptr<GlobalTableFunctionState> InsoAccountInit(ClientContext &context, TableFunctionInitInput &input) {
-    auto &bind_data = input.bind_data->Cast<InsoAccountBindData>();
-    auto state = make_uniq<InsoAccountGlobalState>();
-
-    Connection conn(context.db->GetDatabase(context));
-    string schema_prefix = GetSchemaPrefix(bind_data.source_table);
+// Build all mapping structures for the schema of source_table
+// (inso_kontenrahmen index, konto entries, Kreditor/Aufwand/Sachkonto -> EA maps)
+static void BuildInsoMappings(ClientContext &context, SessionLease &session, const string &source_table,
+                              InsoAccountMappings &mappings) {
+    string schema_prefix = GetSchemaPrefix(source_table);
 
     // Determine table names for konto and inso_kontenrahmen
     string konto_table = schema_prefix.empty() ? "konto" : (EscapeId(schema_prefix) + ".\"konto\"");
     string inso_table = schema_prefix.empty() ? "inso_kontenrahmen" : (EscapeId(schema_prefix) + ".\"inso_kontenrahmen\"");
 
-    // Step 1: Load inso_kontenrahmen
+    // Step 1: Load inso_kontenrahmen and build the matching index
     {
-        auto res = conn.Query("SELECT kontoart, \"decEAKontoNr\", kontobezeichnung FROM " + inso_table);
+        vector<InsoKontoEntry> inso_entries;
+        auto res = session.Execute("SELECT kontoart, \"decEAKontoNr\", kontobezeichnung FROM " + inso_table);
         if (res->HasError()) {
             throw InternalException("stps_inso_account: failed to load inso_kontenrahmen: %s", res->GetError());
         }
@@ -486,14 +237,15 @@ static unique_ptr<GlobalTableFunctionState> InsoAccountInit(ClientContext &conte
                 entry.kontoart = chunk->data[0].GetValue(row).ToString();
                 entry.decEAKontoNr = chunk->data[1].GetValue(row).ToString();
                 entry.kontobezeichnung = chunk->data[2].GetValue(row).ToString();
-                state->inso_entries.push_back(entry);
+                inso_entries.push_back(entry);
             }
         }
+        mappings.matcher = make_uniq<InsoAccountMatcher>(std::move(inso_entries));
     }
 
     // Step 2: Load rl.konto
     {
-        auto res = conn.Query("SELECT kontoart, konto, kontobezeichnung FROM " + konto_table);
+        auto res = session.Execute("SELECT kontoart, konto, kontobezeichnung FROM " + konto_table);
         if (res->HasError()) {
             throw InternalException("stps_inso_account: failed to load konto table: %s", res->GetError());
         }
@@ -501,25 +253,34 @@ static unique_ptr<GlobalTableFunctionState> InsoAccountInit(ClientContext &conte
             auto chunk = res->Fetch();
             if (!chunk || chunk->size() == 0) break;
             for (idx_t row = 0; row < chunk->size(); row++) {
-                InsoAccountGlobalState::KontoEntry entry;
+                InsoAccountMappings::KontoEntry entry;
                 entry.kontoart = chunk->data[0].GetValue(row).ToString();
                 entry.konto = chunk->data[1].GetValue(row).GetValue<int64_t>();
                 entry.kontobezeichnung = chunk->data[2].GetValue(row).ToString();
-                state->konto_entries.push_back(entry);
+                mappings.konto_entries.push_back(entry);
             }
         }
     }
 
+    // Accounts to match against the inso kontenrahmen (matched in parallel below)
+    struct KreditorWork {
+        int64_t kreditor;
+        int64_t aufwand_konto;
+        string aufwand_bez;
+    };
+    vector<KreditorWork> kreditor_work;
+    vector<const InsoAccountMappings::KontoEntry *> konto_work;
+
     // Step 3: Build Kreditor -> dominant Aufwand mapping
     // For each Kreditor, find which Aufwand gegenkonto has the highest total amount
     {
-        string escaped_table = EscapeTableRef(bind_data.source_table);
+        string escaped_table = EscapeTableRef(source_table);
         string sql = "SELECT \"decKontoNr\", \"decGegenkontoNr\", \"gegenkontobezeichnung\", SUM(umsatz) as total "
                      "FROM " + escaped_table + " "
                      "WHERE kontoart = 'K' AND gegenkontoart = 'Aufwand' "
                      "GROUP BY \"decKontoNr\", \"decGegenkontoNr\", \"gegenkontobezeichnung\" "
                      "ORDER BY \"decKontoNr\", total DESC";
-        auto res = conn.Query(sql);
+        auto res = session.Query(sql);
         if (!res->HasError()) {
             // For each Kreditor, keep only the first (highest total) Aufwand
             std::unordered_map<int64_t, std::pair<int64_t, string>> kreditor_best_aufwand;
@@ -538,210 +299,779 @@ static unique_ptr<GlobalTableFunctionState> InsoAccountInit(ClientContext &conte
                 }
             }
 
-            // Now map each Kreditor's dominant Aufwand to an EA account
             for (auto &kv : kreditor_best_aufwand) {
-                int64_t kreditor = kv.first;
-                int64_t aufwand_konto = kv.second.first;
-                string aufwand_bez = kv.second.second;
-
-                auto ea_match = FindBestAusgabeMatch(aufwand_konto, aufwand_bez, state->inso_entries);
-                if (!ea_match.first.empty()) {
-                    string source = "Kreditor via Aufwand " + std::to_string(aufwand_konto) +
-                                    " (" + aufwand_bez + ")";
-                    state->kreditor_map[kreditor] = std::make_tuple(ea_match.first, ea_match.second, source);
+                kreditor_work.push_back({kv.first, kv.second.first, kv.second.second});
+            }
+        }
+    }
+
+    // Steps 4 + 5: collect Aufwand and Sachkonto accounts from konto
+    for (const auto &entry : mappings.konto_entries) {
+        if (entry.kontoart == "Aufwand" || entry.kontoart == "Sachkonto") {
+            konto_work.push_back(&entry);
+        }
+    }
+
+    // Match all collected accounts in parallel; each worker keeps its own scratch buffers
+    idx_t kreditor_count = kreditor_work.size();
+    idx_t total = kreditor_count + konto_work.size();
+    vector<std::pair<string, string>> matches(total);
+    auto &matcher = *mappings.matcher;
+
+    InsoParallelFor(context, total, [&](idx_t begin, idx_t end) {
+        InsoMatchScratch scratch;
+        for (idx_t i = begin; i < end; i++) {
+            if (i < kreditor_count) {
+                auto &work = kreditor_work[i];
+                matches[i] = matcher.MatchAusgabe(work.aufwand_konto, work.aufwand_bez, scratch);
+            } else {
+                auto &entry = *konto_work[i - kreditor_count];
+                if (entry.kontoart == "Aufwand") {
+                    matches[i] = matcher.MatchAusgabe(entry.konto, entry.kontobezeichnung, scratch);
+                } else {
+                    matches[i] = matcher.MatchSachkonto(entry.konto, entry.kontobezeichnung, scratch);
                 }
             }
         }
+    });
+
+    // Step 3 result: map each Kreditor's dominant Aufwand to an EA account
+    for (idx_t i = 0; i < kreditor_count; i++) {
+        auto &work = kreditor_work[i];
+        auto &ea_match = matches[i];
+        if (!ea_match.first.empty()) {
+            string source = "Kreditor via Aufwand " + std::to_string(work.aufwand_konto) +
+                            " (" + work.aufwand_bez + ")";
+            mappings.kreditor_map[work.kreditor] = {ea_match.first, ea_match.second, source};
+        }
     }
 
-    // Step 4: Build Aufwand -> EA mapping for all Aufwand accounts in konto
-    for (const auto &entry : state->konto_entries) {
+    // Step 4 + 5 results: Aufwand -> EA and Sachkonto -> EA mappings (mapping_source precomputed)
+    for (idx_t i = kreditor_count; i < total; i++) {
+        auto &entry = *konto_work[i - kreditor_count];
+        auto &match = matches[i];
+        if (match.first.empty()) continue;
+        string konto_str = std::to_string(entry.konto);
         if (entry.kontoart == "Aufwand") {
-            auto match = FindBestAusgabeMatch(entry.konto, entry.kontobezeichnung, state->inso_entries);
-            if (!match.first.empty()) {
-                state->aufwand_ea_map[entry.konto] = match;
-            }
+            mappings.aufwand_ea_map[entry.konto] = {match.first, match.second,
+                                                    "Aufwand " + konto_str + " -> " + match.first};
+        } else if (konto_str.size() >= 2 && konto_str.substr(0, 2) == "14") {
+            mappings.sachkonto_ea_map[entry.konto] = {match.first, match.second, "Vorsteuer -> 1780"};
+        } else {
+            mappings.sachkonto_ea_map[entry.konto] = {match.first, match.second,
+                                                      "Sachkonto " + konto_str + " -> " + match.first + " (name match)"};
         }
     }
+}
+
+// Helper: compare a string_t against a literal without materializing it
+static inline bool StringEquals(const string_t &str, const char *literal) {
+    idx_t len = strlen(literal);
+    return str.GetSize() == len && memcmp(str.GetData(), literal, len) == 0;
+}
+
+// Fixed mappings for counter-account types that do not need a lookup
+static const InsoMapping DEBITOR_MAPPING = {"8200", "Forderungseinzug aus L.u.L. - 19% Ust", "Debitor -> 8200"};
+static const InsoMapping ERLOES_MAPPING = {"8200", "Forderungseinzug aus L.u.L. - 19% Ust", "Erloes -> 8200"};
+static const InsoMapping GELDKONTO_MAPPING = {"1360", "", "Geldkonto -> 1360"};
+
+// Compute the mapping columns for count rows of a result chunk.
+// keys points at the KEY_COUNT key vectors, bank_accounts holds the bank account of each row,
+// out[i] is the output vector of mapping column i (nullptr if not projected).
+// Strings from the source are referenced, not copied.
+static void InsoMapRows(const InsoAccountMappings &mappings, const int64_t *bank_accounts, Vector *keys, idx_t count,
+                        Vector *out[INSO_MAPPING_COLUMNS]) {
+    UnifiedVectorFormat key_data[KEY_COUNT];
+    for (idx_t k = 0; k < KEY_COUNT; k++) {
+        keys[k].ToUnifiedFormat(count, key_data[k]);
+    }
+    auto konto = UnifiedVectorFormat::GetData<int64_t>(key_data[KEY_KONTO]);
+    auto gegen = UnifiedVectorFormat::GetData<int64_t>(key_data[KEY_GEGENKONTO]);
+    auto konto_bez = UnifiedVectorFormat::GetData<string_t>(key_data[KEY_KONTOBEZEICHNUNG]);
+    auto konto_art = UnifiedVectorFormat::GetData<string_t>(key_data[KEY_KONTOART]);
+    auto gegen_bez = UnifiedVectorFormat::GetData<string_t>(key_data[KEY_GEGENKONTOBEZEICHNUNG]);
+    auto gegen_art = UnifiedVectorFormat::GetData<string_t>(key_data[KEY_GEGENKONTOART]);
+
+    // Counter name/art strings point into the source vectors' heaps
+    if (out[1]) {
+        StringVector::AddHeapReference(*out[1], keys[KEY_KONTOBEZEICHNUNG]);
+        StringVector::AddHeapReference(*out[1], keys[KEY_GEGENKONTOBEZEICHNUNG]);
+    }
+    if (out[2]) {
+        StringVector::AddHeapReference(*out[2], keys[KEY_KONTOART]);
+        StringVector::AddHeapReference(*out[2], keys[KEY_GEGENKONTOART]);
+    }
 
-    // Step 5: Build Sachkonto -> EA mapping
-    for (const auto &entry : state->konto_entries) {
-        if (entry.kontoart == "Sachkonto") {
-            auto match = FindBestSachkontoMatch(entry.konto, entry.kontobezeichnung, state->inso_entries);
-            if (!match.first.empty()) {
-                state->sachkonto_ea_map[entry.konto] = match;
+    for (idx_t row = 0; row < count; row++) {
+        auto konto_idx = key_data[KEY_KONTO].sel->get_index(row);
+        bool konto_valid = key_data[KEY_KONTO].validity.RowIsValid(konto_idx);
+
+        // The counter-account is the side that is NOT the bank account
+        bool bank_is_konto = konto_valid && konto[konto_idx] == bank_accounts[row];
+        const UnifiedVectorFormat &nr_fmt = bank_is_konto ? key_data[KEY_GEGENKONTO] : key_data[KEY_KONTO];
+        const UnifiedVectorFormat &bez_fmt =
+            bank_is_konto ? key_data[KEY_GEGENKONTOBEZEICHNUNG] : key_data[KEY_KONTOBEZEICHNUNG];
+        const UnifiedVectorFormat &art_fmt = bank_is_konto ? key_data[KEY_GEGENKONTOART] : key_data[KEY_KONTOART];
+        auto nr_data = bank_is_konto ? gegen : konto;
+        auto bez_data = bank_is_konto ? gegen_bez : konto_bez;
+        auto art_data = bank_is_konto ? gegen_art : konto_art;
+
+        auto nr_idx = nr_fmt.sel->get_index(row);
+        auto bez_idx = bez_fmt.sel->get_index(row);
+        auto art_idx = art_fmt.sel->get_index(row);
+        bool nr_valid = nr_fmt.validity.RowIsValid(nr_idx);
+        bool art_valid = art_fmt.validity.RowIsValid(art_idx);
+        int64_t counter_konto = nr_valid ? nr_data[nr_idx] : 0;
+        string_t counter_art = art_valid ? art_data[art_idx] : string_t("");
+
+        // Set counter columns
+        if (out[0]) {
+            if (nr_valid) {
+                FlatVector::GetData<int64_t>(*out[0])[row] = counter_konto;
+            } else {
+                FlatVector::SetNull(*out[0], row, true);
+            }
+        }
+        if (out[1]) {
+            if (bez_fmt.validity.RowIsValid(bez_idx)) {
+                FlatVector::GetData<string_t>(*out[1])[row] = bez_data[bez_idx];
+            } else {
+                FlatVector::SetNull(*out[1], row, true);
+            }
+        }
+        if (out[2]) {
+            if (art_valid) {
+                FlatVector::GetData<string_t>(*out[2])[row] = counter_art;
+            } else {
+                FlatVector::SetNull(*out[2], row, true);
+            }
+        }
+
+        // Apply mapping rules based on counter_art (hash lookups into the prebuilt maps)
+        const InsoMapping *mapping = nullptr;
+        const char *missing_source = nullptr;
+        if (StringEquals(counter_art, "D")) {
+            mapping = &DEBITOR_MAPPING;
+        } else if (StringEquals(counter_art, "Erloes") || StringEquals(counter_art, u8"Erlös")) {
+            mapping = &ERLOES_MAPPING;
+        } else if (StringEquals(counter_art, "K")) {
+            auto it = mappings.kreditor_map.find(counter_konto);
+            if (it != mappings.kreditor_map.end()) {
+                mapping = &it->second;
+            } else {
+                missing_source = "Kreditor: no Aufwand mapping found";
+            }
+        } else if (StringEquals(counter_art, "Aufwand")) {
+            auto it = mappings.aufwand_ea_map.find(counter_konto);
+            if (it != mappings.aufwand_ea_map.end()) {
+                mapping = &it->second;
+            } else {
+                missing_source = "Aufwand: no match found";
+            }
+        } else if (StringEquals(counter_art, "Sachkonto")) {
+            auto it = mappings.sachkonto_ea_map.find(counter_konto);
+            if (it != mappings.sachkonto_ea_map.end()) {
+                mapping = &it->second;
+            } else {
+                missing_source = "Sachkonto: no match found";
+            }
+        } else if (StringEquals(counter_art, "Geldkonto")) {
+            mapping = &GELDKONTO_MAPPING;
+        }
+
+        // Set EA columns
+        if (out[3] || out[4]) {
+            if (mapping && !mapping->ea_konto.empty()) {
+                if (out[3]) {
+                    FlatVector::GetData<string_t>(*out[3])[row] = StringVector::AddString(*out[3], mapping->ea_konto);
+                }
+                if (out[4]) {
+                    FlatVector::GetData<string_t>(*out[4])[row] =
+                        StringVector::AddString(*out[4], mapping->ea_bezeichnung);
+                }
+            } else {
+                if (out[3]) FlatVector::SetNull(*out[3], row, true);
+                if (out[4]) FlatVector::SetNull(*out[4], row, true);
+            }
+        }
+        if (out[5]) {
+            auto &source_vec = *out[5];
+            if (mapping) {
+                FlatVector::GetData<string_t>(source_vec)[row] = StringVector::AddString(source_vec, mapping->mapping_source);
+            } else if (missing_source) {
+                FlatVector::GetData<string_t>(source_vec)[row] = StringVector::AddString(source_vec, missing_source);
+            } else {
+                FlatVector::GetData<string_t>(source_vec)[row] =
+                    StringVector::AddString(source_vec, "Unknown kontoart: " + counter_art.GetString());
             }
         }
     }
+}
 
-    // Step 6: Find column indices in source
-    for (idx_t i = 0; i < bind_data.original_column_names.size(); i++) {
-        const string &name = bind_data.original_column_names[i];
-        if (name == "decKontoNr") state->col_decKontoNr = i;
-        else if (name == "kontobezeichnung") state->col_kontobezeichnung = i;
-        else if (name == "kontoart") state->col_kontoart = i;
-        else if (name == "decGegenkontoNr") state->col_decGegenkontoNr = i;
-        else if (name == "gegenkontobezeichnung") state->col_gegenkontobezeichnung = i;
-        else if (name == "gegenkontoart") state->col_gegenkontoart = i;
+// Bind function
+static unique_ptr<FunctionData> InsoAccountBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<InsoAccountBindData>();
+
+    if (input.inputs.size() < 1) {
+        throw BinderException("stps_inso_account requires at least 1 argument: source table name");
+    }
+    result->source_table = input.inputs[0].GetValue<string>();
+
+    // Get bank_account named parameter
+    auto it = input.named_parameters.find("bank_account");
+    if (it != input.named_parameters.end()) {
+        result->bank_account = it->second.GetValue<int64_t>();
+    } else {
+        throw BinderException("stps_inso_account requires named parameter bank_account");
+    }
+
+    // Query source table schema
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, EscapeTableRef(result->source_table), table, error)) {
+        throw BinderException("stps_inso_account: cannot query table '%s': %s",
+                              result->source_table, error);
+    }
+
+    result->original_column_names = table.column_names;
+    result->original_column_types = table.column_types;
+
+    // Set return types: all original columns + extra columns
+    for (idx_t i = 0; i < table.column_names.size(); i++) {
+        names.push_back(table.column_names[i]);
+        return_types.push_back(table.column_types[i]);
+    }
+
+    // Additional columns
+    AddInsoMappingColumns(return_types, names);
+
+    return std::move(result);
+}
+
+// Filter pushdown: copy simple "original_column <op> constant" comparisons into the
+// journal query. The filters stay in the plan, so DuckDB still re-checks them.
+static void InsoAccountPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                             vector<unique_ptr<Expression>> &filters) {
+    auto &bind_data = bind_data_p->Cast<InsoAccountBindData>();
+    auto &column_ids = get.GetColumnIds();
+
+    for (auto &filter : filters) {
+        if (filter->GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) continue;
+        auto &comparison = filter->Cast<BoundComparisonExpression>();
+
+        auto type = comparison.GetExpressionType();
+        switch (type) {
+        case ExpressionType::COMPARE_EQUAL:
+        case ExpressionType::COMPARE_NOTEQUAL:
+        case ExpressionType::COMPARE_LESSTHAN:
+        case ExpressionType::COMPARE_GREATERTHAN:
+        case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+        case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+            break;
+        default:
+            continue;
+        }
+
+        Expression *column_expr = comparison.left.get();
+        Expression *constant_expr = comparison.right.get();
+        if (column_expr->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+            std::swap(column_expr, constant_expr);
+            type = FlipComparisonExpression(type);
+        }
+        if (column_expr->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF ||
+            constant_expr->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+            continue;
+        }
+
+        auto &colref = column_expr->Cast<BoundColumnRefExpression>();
+        if (colref.depth != 0 || colref.binding.table_index != get.table_index ||
+            colref.binding.column_index >= column_ids.size()) {
+            continue;
+        }
+        idx_t column = column_ids[colref.binding.column_index].GetPrimaryIndex();
+        if (column >= bind_data.original_column_names.size()) continue;  // mapping / row-id column
+
+        auto &constant = constant_expr->Cast<BoundConstantExpression>().value;
+        if (constant.IsNull()) continue;
+
+        string sql = EscapeId(bind_data.original_column_names[column]) + " " + ExpressionTypeToOperator(type) + " " +
+                     constant.ToSQLString();
+        if (std::find(bind_data.pushed_filters.begin(), bind_data.pushed_filters.end(), sql) ==
+            bind_data.pushed_filters.end()) {
+            bind_data.pushed_filters.push_back(sql);
+        }
     }
+}
 
-    // Step 7: Execute the filtered query for bank transactions
+// Init function: build lookup maps and execute filtered, projected query
+static unique_ptr<GlobalTableFunctionState> InsoAccountInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<InsoAccountBindData>();
+    auto state = make_uniq<InsoAccountGlobalState>();
+
+    auto session = SessionPool::Acquire(context);
+    state->projection = PlanInsoProjection(input.column_ids, bind_data.original_column_names,
+                                           bind_data.original_column_types, 0, false, false);
+
+    // Build the mapping structures only if a mapping column is requested
+    if (state->projection.need_mapping) {
+        BuildInsoMappings(context, session, bind_data.source_table, state->mappings);
+    }
+
+    // Execute the filtered query for bank transactions
     {
         string escaped_table = EscapeTableRef(bind_data.source_table);
-        string sql = "SELECT * FROM " + escaped_table +
-                     " WHERE \"decKontoNr\" = " + std::to_string(bind_data.bank_account) +
-                     " OR \"decGegenkontoNr\" = " + std::to_string(bind_data.bank_account);
-        state->result = conn.Query(sql);
+        string sql = "SELECT " + state->projection.select_list + " FROM " + escaped_table +
+                     " WHERE (\"decKontoNr\" = $1 OR \"decGegenkontoNr\" = $1)";
+        for (auto &filter : bind_data.pushed_filters) {
+            sql += " AND " + filter;
+        }
+        // The account is a parameter: the same report for another account reuses the plan
+        state->result = session.Execute(sql, {Value::BIGINT(bind_data.bank_account)});
         if (state->result->HasError()) {
             throw InternalException("stps_inso_account: failed to query bank transactions: %s",
                                     state->result->GetError());
         }
     }
 
+    state->max_threads = (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads();
     state->finished = false;
     return std::move(state);
 }
 
-// Scan function: process rows and add mapping columns
+// Scan function: each call (on any thread) takes one journal chunk, references the
+// projected original columns and computes the mapping columns vectorized
 static void InsoAccountScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
     auto &bind_data = data_p.bind_data->Cast<InsoAccountBindData>();
     auto &state = data_p.global_state->Cast<InsoAccountGlobalState>();
+    auto &plan = state.projection;
 
-    if (state.finished) {
-        output.SetCardinality(0);
-        return;
+    unique_ptr<DataChunk> chunk;
+    {
+        std::lock_guard<std::mutex> guard(state.lock);
+        if (state.finished) {
+            output.SetCardinality(0);
+            return;
+        }
+        chunk = state.result->Fetch();
+        if (!chunk || chunk->size() == 0) {
+            state.finished = true;
+            output.SetCardinality(0);
+            return;
+        }
     }
 
-    idx_t output_idx = 0;
-    idx_t num_original = bind_data.original_column_names.size();
+    idx_t count = chunk->size();
+    for (idx_t col = 0; col < plan.output_source.size(); col++) {
+        auto source = plan.output_source[col];
+        if (source == INSO_MAPPING_SOURCE) {
+            continue;  // filled by InsoMapRows below
+        }
+        if (source != DConstants::INVALID_INDEX) {
+            output.data[col].Reference(chunk->data[source]);
+        } else {
+            output.data[col].SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(output.data[col], true);
+        }
+    }
 
-    while (output_idx < STANDARD_VECTOR_SIZE && !state.finished) {
-        // Fetch new chunk if needed
-        if (!state.current_chunk || state.chunk_offset >= state.current_chunk->size()) {
-            state.current_chunk = state.result->Fetch();
-            state.chunk_offset = 0;
-            if (!state.current_chunk || state.current_chunk->size() == 0) {
-                state.finished = true;
-                break;
-            }
+    if (plan.need_mapping) {
+        Vector *out[INSO_MAPPING_COLUMNS];
+        for (idx_t i = 0; i < INSO_MAPPING_COLUMNS; i++) {
+            auto pos = plan.mapping_output[i];
+            out[i] = pos == DConstants::INVALID_INDEX ? nullptr : &output.data[pos];
         }
+        int64_t bank_accounts[STANDARD_VECTOR_SIZE];
+        std::fill(bank_accounts, bank_accounts + count, bind_data.bank_account);
+        InsoMapRows(state.mappings, bank_accounts, &chunk->data[plan.key_offset], count, out);
+    }
 
-        while (state.chunk_offset < state.current_chunk->size() && output_idx < STANDARD_VECTOR_SIZE) {
-            idx_t row = state.chunk_offset;
+    output.SetCardinality(count);
+}
 
-            // Copy all original columns
-            for (idx_t col = 0; col < num_original; col++) {
-                Value val = state.current_chunk->data[col].GetValue(row);
-                output.data[col].SetValue(output_idx, val);
-            }
+// ============================================================================
+// stps_inso_account_batch: many bank accounts (and clients) in one pass
+// ============================================================================
 
-            // Determine counter-account (the non-bank side)
-            int64_t konto_nr = state.current_chunk->data[state.col_decKontoNr].GetValue(row).GetValue<int64_t>();
-            string konto_bez = state.current_chunk->data[state.col_kontobezeichnung].GetValue(row).ToString();
-            string konto_art = state.current_chunk->data[state.col_kontoart].GetValue(row).IsNull() ?
-                               "" : state.current_chunk->data[state.col_kontoart].GetValue(row).ToString();
-            int64_t gegen_nr = state.current_chunk->data[state.col_decGegenkontoNr].GetValue(row).GetValue<int64_t>();
-            string gegen_bez = state.current_chunk->data[state.col_gegenkontobezeichnung].GetValue(row).IsNull() ?
-                               "" : state.current_chunk->data[state.col_gegenkontobezeichnung].GetValue(row).ToString();
-            string gegen_art = state.current_chunk->data[state.col_gegenkontoart].GetValue(row).IsNull() ?
-                               "" : state.current_chunk->data[state.col_gegenkontoart].GetValue(row).ToString();
-
-            // The counter-account is the side that is NOT the bank account
-            int64_t counter_konto;
-            string counter_bez;
-            string counter_art;
-            if (konto_nr == bind_data.bank_account) {
-                counter_konto = gegen_nr;
-                counter_bez = gegen_bez;
-                counter_art = gegen_art;
-            } else {
-                counter_konto = konto_nr;
-                counter_bez = konto_bez;
-                counter_art = konto_art;
+// One client (schema) of a batch run
+struct InsoBatchClient {
+    string schema;          // client schema ("" = default schema)
+    string journal_table;   // schema-qualified journal table
+    vector<int64_t> bank_accounts;
+};
+
+// Bind data
+struct InsoAccountBatchBindData : public TableFunctionData {
+    vector<InsoBatchClient> clients;
+    // Original columns of the journal (taken from the first client)
+    vector<string> original_column_names;
+    vector<LogicalType> original_column_types;
+};
+
+// Mapping structures of the client currently being scanned, shared by all of its accounts
+struct InsoBatchClientState {
+    const InsoBatchClient *client = nullptr;
+    InsoAccountMappings mappings;
+    std::unordered_set<int64_t> accounts;
+};
+
+// Global state
+struct InsoAccountBatchGlobalState : public GlobalTableFunctionState {
+    InsoProjection projection;
+
+    // Clients are processed one after another; each journal is read once for all its accounts.
+    // The next client is opened outside the lock while starting is set; the other threads
+    // wait on client_ready meanwhile. Only the opening thread uses the session then.
+    std::mutex lock;
+    std::condition_variable client_ready;
+    unique_ptr<SessionLease> session;
+    idx_t next_client = 0;
+    bool starting = false;
+    shared_ptr<InsoBatchClientState> current;
+    unique_ptr<QueryResult> result;
+    bool finished = false;
+    idx_t max_threads = 1;
+
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
+};
+
+// Local state: one journal chunk emitted in two passes
+// (pass 0: bank account on the konto side, pass 1: bank account on the gegenkonto side)
+struct InsoAccountBatchLocalState : public LocalTableFunctionState {
+    unique_ptr<DataChunk> chunk;
+    shared_ptr<InsoBatchClientState> client;
+    SelectionVector sel[2];
+    int64_t bank_accounts[2][STANDARD_VECTOR_SIZE];
+    idx_t sel_count[2] = {0, 0};
+    idx_t pass = 2;
+};
+
+// Helper: read the non-NULL BIGINT values of a LIST parameter
+static vector<int64_t> ParseBankAccountList(const Value &value) {
+    vector<int64_t> result;
+    if (value.IsNull()) return result;
+    for (auto &child : ListValue::GetChildren(value)) {
+        if (!child.IsNull()) {
+            result.push_back(child.GetValue<int64_t>());
+        }
+    }
+    return result;
+}
+
+// Bind function
+static unique_ptr<FunctionData> InsoAccountBatchBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<InsoAccountBatchBindData>();
+
+    if (input.inputs.size() < 1) {
+        throw BinderException("stps_inso_account_batch requires at least 1 argument: journal table name");
+    }
+    string table_name = input.inputs[0].GetValue<string>();
+    string default_schema = GetSchemaPrefix(table_name);
+    string base_table = default_schema.empty() ? table_name : table_name.substr(default_schema.size() + 1);
+
+    // Bank accounts that apply to every client
+    vector<int64_t> shared_accounts;
+    // Bank accounts per client schema (from bank_account_table), in first-seen order
+    vector<string> table_schemas;
+    std::unordered_map<string, vector<int64_t>> client_accounts;
+    vector<string> schemas;
+    string bank_account_table;
+
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "bank_accounts") {
+            shared_accounts = ParseBankAccountList(kv.second);
+        } else if (kv.first == "schemas") {
+            if (!kv.second.IsNull()) {
+                for (auto &child : ListValue::GetChildren(kv.second)) {
+                    if (!child.IsNull()) schemas.push_back(child.ToString());
+                }
             }
+        } else if (kv.first == "bank_account_table") {
+            bank_account_table = kv.second.GetValue<string>();
+        }
+    }
 
-            // Set counter columns
-            output.data[num_original + 0].SetValue(output_idx, Value::BIGINT(counter_konto));
-            output.data[num_original + 1].SetValue(output_idx, Value(counter_bez));
-            output.data[num_original + 2].SetValue(output_idx, Value(counter_art));
-
-            // Apply mapping rules based on counter_art
-            string ea_konto;
-            string ea_bezeichnung;
-            string mapping_source;
-
-            if (counter_art == "D") {
-                // Debitor -> 8200
-                ea_konto = "8200";
-                ea_bezeichnung = "Forderungseinzug aus L.u.L. - 19% Ust";
-                mapping_source = "Debitor -> 8200";
-            } else if (counter_art == "Erlös" || counter_art == "Erloes" || counter_art == u8"Erlös") {
-                // Erloes -> 8200
-                ea_konto = "8200";
-                ea_bezeichnung = "Forderungseinzug aus L.u.L. - 19% Ust";
-                mapping_source = "Erloes -> 8200";
-            } else if (counter_art == "K") {
-                // Kreditor -> look up dominant Aufwand mapping
-                auto it = state.kreditor_map.find(counter_konto);
-                if (it != state.kreditor_map.end()) {
-                    ea_konto = std::get<0>(it->second);
-                    ea_bezeichnung = std::get<1>(it->second);
-                    mapping_source = std::get<2>(it->second);
-                } else {
-                    mapping_source = "Kreditor: no Aufwand mapping found";
+    auto session = SessionPool::Acquire(context);
+
+    // Optional table of bank accounts: column bank_account, optional column client_schema
+    if (!bank_account_table.empty()) {
+        auto res = session.Query("SELECT * FROM " + EscapeTableRef(bank_account_table));
+        if (res->HasError()) {
+            throw BinderException("stps_inso_account_batch: cannot query bank_account_table '%s': %s",
+                                  bank_account_table, res->GetError());
+        }
+        idx_t account_col = DConstants::INVALID_INDEX;
+        idx_t schema_col = DConstants::INVALID_INDEX;
+        for (idx_t i = 0; i < res->names.size(); i++) {
+            if (res->names[i] == "bank_account") account_col = i;
+            else if (res->names[i] == "client_schema") schema_col = i;
+        }
+        if (account_col == DConstants::INVALID_INDEX) {
+            throw BinderException("stps_inso_account_batch: bank_account_table '%s' needs a bank_account column",
+                                  bank_account_table);
+        }
+        while (true) {
+            auto chunk = res->Fetch();
+            if (!chunk || chunk->size() == 0) break;
+            for (idx_t row = 0; row < chunk->size(); row++) {
+                Value account = chunk->data[account_col].GetValue(row);
+                if (account.IsNull()) continue;
+                int64_t bank_account = account.GetValue<int64_t>();
+                if (schema_col == DConstants::INVALID_INDEX) {
+                    shared_accounts.push_back(bank_account);
+                    continue;
                 }
-            } else if (counter_art == "Aufwand") {
-                // Aufwand -> match to Ausgabekonten
-                auto it = state.aufwand_ea_map.find(counter_konto);
-                if (it != state.aufwand_ea_map.end()) {
-                    ea_konto = it->second.first;
-                    ea_bezeichnung = it->second.second;
-                    mapping_source = "Aufwand " + std::to_string(counter_konto) +
-                                     " -> " + ea_konto;
-                } else {
-                    mapping_source = "Aufwand: no match found";
+                Value schema = chunk->data[schema_col].GetValue(row);
+                string schema_name = schema.IsNull() ? default_schema : schema.ToString();
+                if (client_accounts.find(schema_name) == client_accounts.end()) {
+                    table_schemas.push_back(schema_name);
                 }
-            } else if (counter_art == "Sachkonto") {
-                // Sachkonto -> check Vorsteuer or best match
-                auto it = state.sachkonto_ea_map.find(counter_konto);
-                if (it != state.sachkonto_ea_map.end()) {
-                    ea_konto = it->second.first;
-                    ea_bezeichnung = it->second.second;
-                    string konto_str = std::to_string(counter_konto);
-                    if (konto_str.size() >= 2 && konto_str.substr(0, 2) == "14") {
-                        mapping_source = "Vorsteuer -> 1780";
-                    } else {
-                        mapping_source = "Sachkonto " + std::to_string(counter_konto) +
-                                         " -> " + ea_konto + " (name match)";
+                client_accounts[schema_name].push_back(bank_account);
+            }
+        }
+    }
+
+    // Clients: explicit schemas, else the schemas named in the bank account table, else the table's own schema
+    if (schemas.empty()) {
+        schemas = table_schemas.empty() ? vector<string> {default_schema} : table_schemas;
+    }
+    for (auto &schema : schemas) {
+        InsoBatchClient client;
+        client.schema = schema;
+        client.journal_table = schema.empty() ? base_table : schema + "." + base_table;
+        client.bank_accounts = shared_accounts;
+        auto it = client_accounts.find(schema);
+        if (it != client_accounts.end()) {
+            client.bank_accounts.insert(client.bank_accounts.end(), it->second.begin(), it->second.end());
+        }
+        std::sort(client.bank_accounts.begin(), client.bank_accounts.end());
+        client.bank_accounts.erase(std::unique(client.bank_accounts.begin(), client.bank_accounts.end()),
+                                   client.bank_accounts.end());
+        if (!client.bank_accounts.empty()) {
+            result->clients.push_back(std::move(client));
+        }
+    }
+    if (result->clients.empty()) {
+        throw BinderException("stps_inso_account_batch requires bank_accounts or bank_account_table "
+                              "with at least one bank account");
+    }
+
+    // Query journal schema (from the first client; other clients are cast to it)
+    auto &first = result->clients[0];
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, EscapeTableRef(first.journal_table), table, error)) {
+        throw BinderException("stps_inso_account_batch: cannot query table '%s': %s",
+                              first.journal_table, error);
+    }
+    result->original_column_names = table.column_names;
+    result->original_column_types = table.column_types;
+
+    names.push_back("client_schema");
+    return_types.push_back(LogicalType::VARCHAR);
+    names.push_back("bank_account");
+    return_types.push_back(LogicalType::BIGINT);
+    for (idx_t i = 0; i < table.column_names.size(); i++) {
+        names.push_back(table.column_names[i]);
+        return_types.push_back(table.column_types[i]);
+    }
+    AddInsoMappingColumns(return_types, names);
+
+    return std::move(result);
+}
+
+// Init function: only plans the projection; clients are opened lazily during the scan
+static unique_ptr<GlobalTableFunctionState> InsoAccountBatchInit(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<InsoAccountBatchBindData>();
+    auto state = make_uniq<InsoAccountBatchGlobalState>();
+
+    // Key columns are always needed to decide which bank account(s) a row belongs to
+    state->projection = PlanInsoProjection(input.column_ids, bind_data.original_column_names,
+                                           bind_data.original_column_types, 2, true, true);
+    state->session = make_uniq<SessionLease>(SessionPool::Acquire(context));
+    state->max_threads = (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads();
+    return std::move(state);
+}
+
+static unique_ptr<LocalTableFunctionState> InsoAccountBatchInitLocal(ExecutionContext &context,
+                                                                     TableFunctionInitInput &input,
+                                                                     GlobalTableFunctionState *global_state) {
+    return make_uniq<InsoAccountBatchLocalState>();
+}
+
+// Open a client: build its mappings once and query its journal once for all its bank
+// accounts. Called without the global lock, by the thread that claimed the client.
+static shared_ptr<InsoBatchClientState> InsoBatchStartClient(ClientContext &context, const InsoBatchClient &client,
+                                                             InsoAccountBatchGlobalState &state,
+                                                             unique_ptr<QueryResult> &result) {
+    auto client_state = make_shared_ptr<InsoBatchClientState>();
+    client_state->client = &client;
+    client_state->accounts.insert(client.bank_accounts.begin(), client.bank_accounts.end());
+
+    if (state.projection.need_mapping) {
+        BuildInsoMappings(context, *state.session, client.journal_table, client_state->mappings);
+    }
+
+    string account_list;
+    for (auto account : client.bank_accounts) {
+        if (!account_list.empty()) account_list += ", ";
+        account_list += std::to_string(account);
+    }
+    string sql = "SELECT " + state.projection.select_list + " FROM " + EscapeTableRef(client.journal_table) +
+                 " WHERE \"decKontoNr\" IN (" + account_list + ") OR \"decGegenkontoNr\" IN (" + account_list + ")";
+    result = state.session->Query(sql);
+    if (result->HasError()) {
+        throw InternalException("stps_inso_account_batch: failed to query bank transactions of '%s': %s",
+                                client.journal_table, result->GetError());
+    }
+    return client_state;
+}
+
+// Split a journal chunk into the two emission passes. A row is emitted once per bank account
+// it touches, exactly as separate stps_inso_account calls per account would return it.
+static void InsoBatchSplitChunk(InsoAccountBatchLocalState &local, const InsoProjection &plan) {
+    auto &chunk = *local.chunk;
+    idx_t count = chunk.size();
+    UnifiedVectorFormat konto_fmt, gegen_fmt;
+    chunk.data[plan.key_offset + KEY_KONTO].ToUnifiedFormat(count, konto_fmt);
+    chunk.data[plan.key_offset + KEY_GEGENKONTO].ToUnifiedFormat(count, gegen_fmt);
+    auto konto = UnifiedVectorFormat::GetData<int64_t>(konto_fmt);
+    auto gegen = UnifiedVectorFormat::GetData<int64_t>(gegen_fmt);
+    auto &accounts = local.client->accounts;
+
+    // Fresh selection buffers per chunk: sliced output vectors keep referencing the previous ones
+    local.sel[0].Initialize(STANDARD_VECTOR_SIZE);
+    local.sel[1].Initialize(STANDARD_VECTOR_SIZE);
+    local.sel_count[0] = 0;
+    local.sel_count[1] = 0;
+    for (idx_t row = 0; row < count; row++) {
+        auto konto_idx = konto_fmt.sel->get_index(row);
+        auto gegen_idx = gegen_fmt.sel->get_index(row);
+        bool konto_valid = konto_fmt.validity.RowIsValid(konto_idx);
+        bool gegen_valid = gegen_fmt.validity.RowIsValid(gegen_idx);
+
+        if (konto_valid && accounts.count(konto[konto_idx])) {
+            idx_t n = local.sel_count[0]++;
+            local.sel[0].set_index(n, row);
+            local.bank_accounts[0][n] = konto[konto_idx];
+        }
+        if (gegen_valid && accounts.count(gegen[gegen_idx]) &&
+            !(konto_valid && konto[konto_idx] == gegen[gegen_idx])) {
+            idx_t n = local.sel_count[1]++;
+            local.sel[1].set_index(n, row);
+            local.bank_accounts[1][n] = gegen[gegen_idx];
+        }
+    }
+}
+
+// Scan function: parallel over journal chunks; mapping structures are shared per client
+static void InsoAccountBatchScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<InsoAccountBatchBindData>();
+    auto &state = data_p.global_state->Cast<InsoAccountBatchGlobalState>();
+    auto &local = data_p.local_state->Cast<InsoAccountBatchLocalState>();
+    auto &plan = state.projection;
+
+    while (true) {
+        if (local.pass >= 2) {
+            // Take the next journal chunk, moving on to the next client when the current one is exhausted
+            local.chunk.reset();
+            {
+                std::unique_lock<std::mutex> guard(state.lock);
+                while (!state.finished) {
+                    if (state.result) {
+                        local.chunk = state.result->Fetch();
+                        if (local.chunk && local.chunk->size() > 0) {
+                            local.client = state.current;
+                            break;
+                        }
+                        local.chunk.reset();
+                        state.result.reset();
+                        state.current.reset();
                     }
-                } else {
-                    mapping_source = "Sachkonto: no match found";
+                    if (state.starting) {
+                        // Another thread is opening the next client
+                        state.client_ready.wait(guard);
+                        continue;
+                    }
+                    if (state.next_client >= bind_data.clients.size()) {
+                        state.finished = true;
+                        break;
+                    }
+                    auto &client = bind_data.clients[state.next_client++];
+                    state.starting = true;
+                    guard.unlock();
+                    shared_ptr<InsoBatchClientState> client_state;
+                    unique_ptr<QueryResult> result;
+                    try {
+                        client_state = InsoBatchStartClient(context, client, state, result);
+                    } catch (...) {
+                        guard.lock();
+                        state.starting = false;
+                        state.finished = true;
+                        state.client_ready.notify_all();
+                        throw;
+                    }
+                    guard.lock();
+                    state.current = std::move(client_state);
+                    state.result = std::move(result);
+                    state.starting = false;
+                    state.client_ready.notify_all();
                 }
-            } else if (counter_art == "Geldkonto") {
-                // Geldkonto -> 1360
-                ea_konto = "1360";
-                ea_bezeichnung = "";
-                mapping_source = "Geldkonto -> 1360";
-            } else {
-                mapping_source = "Unknown kontoart: " + counter_art;
             }
+            if (!local.chunk) {
+                output.SetCardinality(0);
+                return;
+            }
+            InsoBatchSplitChunk(local, plan);
+            local.pass = 0;
+        }
+
+        idx_t pass = local.pass++;
+        idx_t count = local.sel_count[pass];
+        if (count == 0) {
+            continue;
+        }
 
-            // Set EA columns
-            if (!ea_konto.empty()) {
-                output.data[num_original + 3].SetValue(output_idx, Value(ea_konto));
-                output.data[num_original + 4].SetValue(output_idx, Value(ea_bezeichnung));
+        auto &sel = local.sel[pass];
+        for (idx_t col = 0; col < plan.output_source.size(); col++) {
+            auto source = plan.output_source[col];
+            auto &vec = output.data[col];
+            if (source == INSO_MAPPING_SOURCE) {
+                continue;  // filled by InsoMapRows below
+            } else if (source == INSO_CLIENT_SOURCE) {
+                auto &schema = local.client->client->schema;
+                vec.Reference(schema.empty() ? Value(LogicalType::VARCHAR) : Value(schema));
+            } else if (source == INSO_BANK_SOURCE) {
+                memcpy(FlatVector::GetData<int64_t>(vec), local.bank_accounts[pass], count * sizeof(int64_t));
+            } else if (source != DConstants::INVALID_INDEX) {
+                vec.Slice(local.chunk->data[source], sel, count);
             } else {
-                output.data[num_original + 3].SetValue(output_idx, Value());
-                output.data[num_original + 4].SetValue(output_idx, Value());
+                vec.SetVectorType(VectorType::CONSTANT_VECTOR);
+                ConstantVector::SetNull(vec, true);
             }
-            output.data[num_original + 5].SetValue(output_idx, Value(mapping_source));
+        }
 
-            output_idx++;
-            state.chunk_offset++;
+        if (plan.need_mapping) {
+            Vector *out[INSO_MAPPING_COLUMNS];
+            for (idx_t i = 0; i < INSO_MAPPING_COLUMNS; i++) {
+                auto pos = plan.mapping_output[i];
+                out[i] = pos == DConstants::INVALID_INDEX ? nullptr : &output.data[pos];
+            }
+            vector<Vector> keys;
+            keys.reserve(KEY_COUNT);
+            for (idx_t k = 0; k < KEY_COUNT; k++) {
+                keys.emplace_back(local.chunk->data[plan.key_offset + k], sel, count);
+            }
+            InsoMapRows(local.client->mappings, local.bank_accounts[pass], keys.data(), count, out);
         }
-    }
 
-    output.SetCardinality(output_idx);
+        output.SetCardinality(count);
+        return;
+    }
 }
 
 void RegisterInsoAccountFunction(ExtensionLoader &loader) {
@@ -754,8 +1084,27 @@ void RegisterInsoAccountFunction(ExtensionLoader &loader) {
     );
 
     func.named_parameters["bank_account"] = LogicalType::BIGINT;
+    func.projection_pushdown = true;
+    func.pushdown_complex_filter = InsoAccountPushdownComplexFilter;
 
     loader.RegisterFunction(func);
+
+    // Batch variant: many bank accounts (and optionally many client schemas) in one pass
+    TableFunction batch_func(
+        "stps_inso_account_batch",
+        {LogicalType::VARCHAR},
+        InsoAccountBatchScan,
+        InsoAccountBatchBind,
+        InsoAccountBatchInit,
+        InsoAccountBatchInitLocal
+    );
+
+    batch_func.named_parameters["bank_accounts"] = LogicalType::LIST(LogicalType::BIGINT);
+    batch_func.named_parameters["bank_account_table"] = LogicalType::VARCHAR;
+    batch_func.named_parameters["schemas"] = LogicalType::LIST(LogicalType::VARCHAR);
+    batch_func.projection_pushdown = true;
+
+    loader.RegisterFunction(batch_func);
 }
 
 } // namespace stps
@@ -0,0 +1,482 @@
+#include "inso_account_matcher.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include <algorithm>
+#include <cctype>
+#include <queue>
+
+namespace duckdb {
+namespace stps {
+
+// ============================================================================
+// Tier 1: SKR03/04 account range -> EA account candidates
+// Maps the first 3 digits of commercial Aufwand accounts to EA-Konto(s)
+// Sorted by range_start and non-overlapping (required for binary search)
+// ============================================================================
+struct RangeMapping {
+    int64_t range_start;  // first 3 digits * 1000 (e.g. 530 -> 530000)
+    int64_t range_end;    // exclusive upper bound
+    const char *ea_konto;
+    const char *ea_bezeichnung;
+};
+
+static const RangeMapping RANGE_MAPPINGS[] = {
+    // Wareneinkauf
+    {530000, 540000, "3220", "Wareneingang - 7% Ust"},
+    {540000, 550000, "3200", "Wareneingang - 19% Ust"},
+    // Personal
+    {600000, 610000, "4100", "Loehne und Gehaelter"},
+    {610000, 613000, "4130", "Gesetzliche Sozialaufwendungen"},
+    {613000, 620000, "4100", "Loehne und Gehaelter"},
+    // Abschreibungen (no direct EA equivalent -> 4900)
+    {620000, 630000, "4900", "Sonstige betriebliche Aufwendungen"},
+    // Raumkosten / Betriebskosten
+    {630000, 633000, "4200", "Raumkosten"},
+    {633000, 640000, "4903", "Fremdleistungen und Fremdarbeiten"},
+    // Steuern, Versicherungen, Beitraege
+    {640000, 650000, "4360", "Versicherungen - allgemein"},
+    // Vertrieb, Bewirtung, Reisekosten
+    {650000, 660000, "4980", "Sonstiger Betriebsbedarf"},
+    {660000, 670000, "4600", "Werbekosten"},
+    // Provisionen, Gebuehren -> Nebenkosten Geldverkehr
+    {670000, 680000, "4970", "Nebenkosten des Geldverkehr"},
+    // Verschiedene betriebliche Aufwendungen
+    {680000, 682000, "4920", "Telekommunikationskosten"},
+    {682000, 685000, "4900", "Sonstige betriebliche Aufwendungen"},
+    {685000, 686000, "4980", "Sonstiger Betriebsbedarf"},
+    {686000, 690000, "4900", "Sonstige betriebliche Aufwendungen"},
+    // Zinsen
+    {700000, 710000, "2100", "Zinsen und aehnliche Aufwendungen"},
+};
+static const int NUM_RANGE_MAPPINGS = sizeof(RANGE_MAPPINGS) / sizeof(RANGE_MAPPINGS[0]);
+
+// ============================================================================
+// Tier 2: Keyword/synonym table
+// Maps German accounting keywords to specific EA accounts
+// Order matters: the first keyword (in table order) contained in the name wins
+// ============================================================================
+struct KeywordMapping {
+    const char *keyword;       // keyword to search for in the account name (lowercase a-z only)
+    const char *ea_konto;
+    const char *ea_bezeichnung;
+};
+
+static const KeywordMapping KEYWORD_MAPPINGS[] = {
+    // Provisionen / Geldverkehr
+    {"provisionen", "4970", "Nebenkosten des Geldverkehr"},
+    {"kreditkartenprovision", "4970", "Nebenkosten des Geldverkehr"},
+    {"bankgebuehr", "4970", "Nebenkosten des Geldverkehr"},
+    {"geldverkehr", "4970", "Nebenkosten des Geldverkehr"},
+    // Reinigung
+    {"waeschereinigung", "4250", "Reinigung"},
+    {"reinigung", "4250", "Reinigung"},
+    // Telekommunikation / Internet
+    {"internet", "4920", "Telekommunikationskosten"},
+    {"telekommunikation", "4920", "Telekommunikationskosten"},
+    {"telefon", "4920", "Telekommunikationskosten"},
+    // Buerobedarf / Drucksachen
+    {"drucksachen", "4930", "Buerobedarf"},
+    {"buerobedarf", "4930", "Buerobedarf"},
+    {"buero", "4930", "Buerobedarf"},
+    // Fremdleistungen
+    {"fachkraefte", "4903", "Fremdleistungen und Fremdarbeiten"},
+    {"fremdleistung", "4903", "Fremdleistungen und Fremdarbeiten"},
+    {"externe", "4903", "Fremdleistungen und Fremdarbeiten"},
+    // Mahnkosten / Rechtsverfolgung
+    {"mahnkosten", "4951", "Nebenkosten der Rechtsverfolgung"},
+    {"mahngebuehr", "4951", "Nebenkosten der Rechtsverfolgung"},
+    {"inkasso", "4951", "Nebenkosten der Rechtsverfolgung"},
+    // Gaestebedarf / Betriebsbedarf
+    {"gaestebedarf", "4980", "Sonstiger Betriebsbedarf"},
+    {"werkzeug", "4980", "Sonstiger Betriebsbedarf"},
+    {"kleinmaterial", "4980", "Sonstiger Betriebsbedarf"},
+    {"ersatzbeschaffung", "4980", "Sonstiger Betriebsbedarf"},
+    // Geldabholung / Geldtransport
+    {"geldabholung", "4970", "Nebenkosten des Geldverkehr"},
+    {"wechselgeld", "4970", "Nebenkosten des Geldverkehr"},
+    // Miete / Pacht
+    {"miete", "4210", "Miete und Pacht"},
+    {"pacht", "4210", "Miete und Pacht"},
+    // Gas, Strom, Wasser
+    {"strom", "4240", "Gas, Strom, Wasser"},
+    {"gas", "4240", "Gas, Strom, Wasser"},
+    {"wasser", "4240", "Gas, Strom, Wasser"},
+    {"fernwaerme", "4240", "Gas, Strom, Wasser"},
+    {"heizung", "4240", "Gas, Strom, Wasser"},
+    // Versicherungen
+    {"versicherung", "4360", "Versicherungen - allgemein"},
+    // Berufsgenossenschaft
+    {"berufsgenossenschaft", "4138", "Beitraege zur Berufsgenossenschaft"},
+    // Abfallbeseitigung
+    {"abfall", "4969", "Aufwand Abraum-/Abfallbeseitigung"},
+    {"entsorgung", "4969", "Aufwand Abraum-/Abfallbeseitigung"},
+    // Reparatur / Instandhaltung
+    {"reparatur", "4800", "Reparatur/Instandh. Anlagen u. Maschinen"},
+    {"instandhaltung", "4800", "Reparatur/Instandh. Anlagen u. Maschinen"},
+    {"wartung", "4806", "Wartungskosten fuer Hard- und Software"},
+    // Leasing
+    {"leasing", "4810", "Mietleasing"},
+    // Rechts- und Beratungskosten
+    {"rechtsberatung", "4950", "Rechts- und Beratungskosten (Sonderaufgaben)"},
+    {"beratung", "4950", "Rechts- und Beratungskosten (Sonderaufgaben)"},
+    {"steuerberatung", "4955", "Buchfuehrungskosten"},
+    {"buchfuehrung", "4955", "Buchfuehrungskosten"},
+    // Reisekosten
+    {"reisekosten", "4660", "Reisekosten"},
+    // Fahrzeug
+    {"fahrzeug", "4500", "Fahrzeugkosten"},
+    {"kfz", "4500", "Fahrzeugkosten"},
+    // Porto
+    {"porto", "4910", "Porto"},
+    // Kundenbindung / Werbung
+    {"kundenbindung", "4600", "Werbekosten"},
+    {"werbung", "4600", "Werbekosten"},
+};
+static const int NUM_KEYWORD_MAPPINGS = sizeof(KEYWORD_MAPPINGS) / sizeof(KEYWORD_MAPPINGS[0]);
+
+// Map a (lowercased) byte to an Aho-Corasick symbol: a-z -> 0..25, everything else -> 26
+static inline idx_t AcSymbol(unsigned char c) {
+    return (c >= 'a' && c <= 'z') ? (idx_t)(c - 'a') : 26;
+}
+
+// Walk the name in its lowercased, umlaut-normalized form (ae/oe/ue/ss) without
+// materializing it, calling emit(byte) for every normalized byte
+template <class EMIT>
+static void ForEachNormalizedByte(const string &s, EMIT &&emit) {
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        // UTF-8 two-byte sequences for German umlauts
+        if (c == 0xC3 && i + 1 < s.size()) {
+            unsigned char next = static_cast<unsigned char>(s[i + 1]);
+            const char *repl = nullptr;
+            if (next == 0xA4 || next == 0x84) repl = "ae";       // ae/Ae
+            else if (next == 0xB6 || next == 0x96) repl = "oe";  // oe/Oe
+            else if (next == 0xBC || next == 0x9C) repl = "ue";  // ue/Ue
+            else if (next == 0x9F) repl = "ss";                  // ss
+            if (repl) {
+                emit(static_cast<unsigned char>(repl[0]));
+                emit(static_cast<unsigned char>(repl[1]));
+                i++;
+                continue;
+            }
+        }
+        emit(static_cast<unsigned char>(std::tolower(c)));
+    }
+}
+
+// Split a name into lowercase alphanumeric tokens, calling emit(token) for each
+template <class EMIT>
+static void ForEachToken(const string &s, string &current, EMIT &&emit) {
+    current.clear();
+    for (char c : s) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            current += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        } else if (!current.empty()) {
+            emit(current);
+            current.clear();
+        }
+    }
+    if (!current.empty()) {
+        emit(current);
+    }
+}
+
+// Leading digits of an EA account number (e.g. "4970a" -> "4970")
+static string LeadingDigits(const string &s) {
+    string result;
+    for (char c : s) {
+        if (!std::isdigit(static_cast<unsigned char>(c))) break;
+        result += c;
+    }
+    return result;
+}
+
+InsoAccountMatcher::InsoAccountMatcher(vector<InsoKontoEntry> entries_p) : entries(std::move(entries_p)) {
+    idx_t n = entries.size();
+    is_ausgabe.resize(n);
+    entry_token_count.resize(n);
+    entry_ea_numeric.resize(n);
+
+    // Token dictionary + inverted index
+    string current;
+    for (idx_t e = 0; e < n; e++) {
+        is_ausgabe[e] = entries[e].kontoart == "Ausgabekonten";
+        entry_ea_numeric[e] = LeadingDigits(entries[e].decEAKontoNr);
+
+        uint32_t count = 0;
+        ForEachToken(entries[e].kontobezeichnung, current, [&](const string &token) {
+            count++;
+            auto it = token_ids.find(token);
+            int32_t id;
+            if (it == token_ids.end()) {
+                id = (int32_t)postings.size();
+                token_ids.emplace(token, id);
+                postings.emplace_back();
+            } else {
+                id = it->second;
+            }
+            // Entries are visited in order, so a duplicate token is always at the back
+            auto &list = postings[id];
+            if (list.empty() || list.back() != e) {
+                list.push_back(e);
+            }
+        });
+        entry_token_count[e] = count;
+
+        // Earliest Ausgabekonten entry per numeric prefix
+        if (is_ausgabe[e]) {
+            const string &digits = entry_ea_numeric[e];
+            for (idx_t k = 1; k <= 4 && k <= digits.size(); k++) {
+                prefix_first[k - 1].emplace(digits.substr(0, k), e);
+            }
+        }
+    }
+
+    // Aho-Corasick trie over the keyword table
+    vector<int32_t> fail;
+    ac_goto.assign(AC_ALPHABET, -1);
+    ac_best.assign(1, -1);
+    fail.assign(1, 0);
+    for (int k = 0; k < NUM_KEYWORD_MAPPINGS; k++) {
+        int32_t state = 0;
+        for (const char *p = KEYWORD_MAPPINGS[k].keyword; *p; p++) {
+            idx_t sym = AcSymbol(static_cast<unsigned char>(*p));
+            int32_t &next = ac_goto[state * AC_ALPHABET + sym];
+            if (next == -1) {
+                next = (int32_t)ac_best.size();
+                ac_goto.resize(ac_goto.size() + AC_ALPHABET, -1);
+                ac_best.push_back(-1);
+                fail.push_back(0);
+            }
+            state = ac_goto[state * AC_ALPHABET + sym];
+        }
+        if (ac_best[state] == -1) {
+            ac_best[state] = k;
+        }
+    }
+
+    // BFS: complete the goto function into a DFA and fold outputs along fail links
+    std::queue<int32_t> queue;
+    for (idx_t sym = 0; sym < AC_ALPHABET; sym++) {
+        int32_t &next = ac_goto[sym];
+        if (next == -1) {
+            next = 0;
+        } else {
+            fail[next] = 0;
+            queue.push(next);
+        }
+    }
+    while (!queue.empty()) {
+        int32_t state = queue.front();
+        queue.pop();
+        int32_t inherited = ac_best[fail[state]];
+        if (inherited != -1 && (ac_best[state] == -1 || inherited < ac_best[state])) {
+            ac_best[state] = inherited;
+        }
+        for (idx_t sym = 0; sym < AC_ALPHABET; sym++) {
+            int32_t &next = ac_goto[state * AC_ALPHABET + sym];
+            int32_t fallback = ac_goto[fail[state] * AC_ALPHABET + sym];
+            if (next == -1) {
+                next = fallback;
+            } else {
+                fail[next] = fallback;
+                queue.push(next);
+            }
+        }
+    }
+}
+
+idx_t InsoAccountMatcher::TokenizeQuery(const string &name, vector<int32_t> &out_tokens) const {
+    out_tokens.clear();
+    string current;
+    idx_t total = 0;
+    ForEachToken(name, current, [&](const string &token) {
+        total++;
+        auto it = token_ids.find(token);
+        if (it != token_ids.end()) {
+            out_tokens.push_back(it->second);
+        }
+    });
+    return total;
+}
+
+void InsoAccountMatcher::CollectHits(InsoMatchScratch &scratch) const {
+    if (scratch.hits.size() != entries.size()) {
+        scratch.hits.assign(entries.size(), 0);
+    }
+    scratch.touched.clear();
+    for (auto token : scratch.tokens) {
+        for (auto e : postings[token]) {
+            if (scratch.hits[e]++ == 0) {
+                scratch.touched.push_back(e);
+            }
+        }
+    }
+    std::sort(scratch.touched.begin(), scratch.touched.end());
+}
+
+int InsoAccountMatcher::FindKeyword(const string &name) const {
+    int32_t state = 0;
+    int32_t best = -1;
+    ForEachNormalizedByte(name, [&](unsigned char c) {
+        state = ac_goto[state * AC_ALPHABET + AcSymbol(c)];
+        int32_t found = ac_best[state];
+        if (found != -1 && (best == -1 || found < best)) {
+            best = found;
+        }
+    });
+    return best;
+}
+
+std::pair<string, string> InsoAccountMatcher::MatchAusgabe(int64_t aufwand_konto, const string &aufwand_bezeichnung,
+                                                           InsoMatchScratch &scratch) const {
+    // ---- Tier 1: Account range mapping (binary search over sorted ranges) ----
+    auto range_end = RANGE_MAPPINGS + NUM_RANGE_MAPPINGS;
+    auto range = std::upper_bound(RANGE_MAPPINGS, range_end, aufwand_konto,
+                                  [](int64_t konto, const RangeMapping &m) { return konto < m.range_start; });
+    const RangeMapping *range_match = nullptr;
+    if (range != RANGE_MAPPINGS) {
+        --range;
+        if (aufwand_konto < range->range_end) {
+            range_match = range;
+        }
+    }
+
+    // ---- Tier 2: Keyword refinement (within a range) or standalone ----
+    int keyword = FindKeyword(aufwand_bezeichnung);
+    if (keyword >= 0) {
+        return {KEYWORD_MAPPINGS[keyword].ea_konto, KEYWORD_MAPPINGS[keyword].ea_bezeichnung};
+    }
+    if (range_match) {
+        return {range_match->ea_konto, range_match->ea_bezeichnung};
+    }
+
+    // ---- Tier 3: Name similarity + account prefix ----
+    // Only entries sharing a token, plus the earliest entry per matching prefix length,
+    // can win; every other entry scores no better than one of those and comes later.
+    idx_t query_size = TokenizeQuery(aufwand_bezeichnung, scratch.tokens);
+    CollectHits(scratch);
+
+    string aufwand_str = std::to_string(aufwand_konto);
+    vector<idx_t> candidates;
+    candidates.reserve(scratch.touched.size() + 4);
+    for (auto e : scratch.touched) {
+        if (is_ausgabe[e]) candidates.push_back(e);
+    }
+    for (idx_t k = 1; k <= 4 && k <= aufwand_str.size(); k++) {
+        auto it = prefix_first[k - 1].find(aufwand_str.substr(0, k));
+        if (it == prefix_first[k - 1].end()) break;
+        candidates.push_back(it->second);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    double best_score = -1.0;
+    idx_t best_entry = 0;
+    for (auto e : candidates) {
+        double score = 0.0;
+
+        const string &ea_numeric = entry_ea_numeric[e];
+        int prefix_match = 0;
+        int max_check = std::min({(int)aufwand_str.size(), (int)ea_numeric.size(), 4});
+        for (int i = 0; i < max_check; i++) {
+            if (aufwand_str[i] == ea_numeric[i]) {
+                prefix_match++;
+            } else {
+                break;
+            }
+        }
+        score += prefix_match * 2.0;
+
+        double name_score = 0.0;
+        if (query_size > 0 && entry_token_count[e] > 0) {
+            name_score = (double)scratch.hits[e] / (double)std::max<idx_t>(query_size, entry_token_count[e]);
+        }
+        score += name_score * 10.0;
+
+        if (score > best_score) {
+            best_score = score;
+            best_entry = e;
+        }
+    }
+
+    for (auto e : scratch.touched) {
+        scratch.hits[e] = 0;
+    }
+
+    if (best_score < 2.0) {
+        return {"4900", "Sonstige betriebliche Aufwendungen"};
+    }
+    return {entries[best_entry].decEAKontoNr, entries[best_entry].kontobezeichnung};
+}
+
+std::pair<string, string> InsoAccountMatcher::MatchSachkonto(int64_t sachkonto, const string &sachkonto_bezeichnung,
+                                                             InsoMatchScratch &scratch) const {
+    // Check if it's a Vorsteuer account (14xxxx range)
+    string konto_str = std::to_string(sachkonto);
+    if (konto_str.size() >= 2 && konto_str[0] == '1' && konto_str[1] == '4') {
+        // Vorsteuer -> 1780 (Umsatzsteuerzahlungen)
+        return {"1780", "Umsatzsteuerzahlungen"};
+    }
+
+    // For other Sachkonten, try name matching; only entries sharing a token can exceed 0.2
+    idx_t query_size = TokenizeQuery(sachkonto_bezeichnung, scratch.tokens);
+    CollectHits(scratch);
+
+    double best_score = -1.0;
+    const InsoKontoEntry *best = nullptr;
+    for (auto e : scratch.touched) {
+        double name_score = (double)scratch.hits[e] / (double)std::max<idx_t>(query_size, entry_token_count[e]);
+        if (name_score > best_score && name_score > 0.2) {
+            best_score = name_score;
+            best = &entries[e];
+        }
+        scratch.hits[e] = 0;
+    }
+
+    // Return empty if no match found (will show as NULL)
+    if (!best) {
+        return {"", ""};
+    }
+    return {best->decEAKontoNr, best->kontobezeichnung};
+}
+
+// One contiguous slice of an InsoParallelFor range
+class InsoRangeTask : public BaseExecutorTask {
+public:
+    InsoRangeTask(TaskExecutor &executor, const std::function<void(idx_t, idx_t)> &fn_p, idx_t begin_p, idx_t end_p)
+        : BaseExecutorTask(executor), fn(fn_p), begin(begin_p), end(end_p) {
+    }
+
+    void ExecuteTask() override {
+        fn(begin, end);
+    }
+
+private:
+    const std::function<void(idx_t, idx_t)> &fn;
+    idx_t begin;
+    idx_t end;
+};
+
+void InsoParallelFor(ClientContext &context, idx_t count, const std::function<void(idx_t, idx_t)> &fn) {
+    // Small workloads are not worth scheduling
+    static constexpr idx_t MIN_ITEMS_PER_TASK = 256;
+    idx_t threads = (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads();
+    idx_t tasks = std::min<idx_t>(threads, count / MIN_ITEMS_PER_TASK);
+    if (tasks <= 1) {
+        fn(0, count);
+        return;
+    }
+
+    // Slices run on DuckDB's worker threads; this thread works on them too until all are done
+    idx_t per_task = (count + tasks - 1) / tasks;
+    TaskExecutor executor(context);
+    for (idx_t begin = 0; begin < count; begin += per_task) {
+        idx_t end = std::min(count, begin + per_task);
+        executor.ScheduleTask(make_uniq<InsoRangeTask>(executor, fn, begin, end));
+    }
+    executor.WorkOnTasks();
+}
+
+} // namespace stps
+} // namespace duckdb
@@ -2,7 +2,16 @@
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
-#include <fstream>
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 #include <sys/stat.h>
 #include <cerrno>
 
@@ -11,6 +20,15 @@
 #else
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h>
+#endif
+#if defined(__linux__)
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
 #endif
 
 namespace duckdb {
@@ -93,6 +111,210 @@ bool create_directories(const std::string& path) {
     #endif
 }
 
+// How a file's bytes were transferred
+struct FileTransfer {
+    int64_t bytes = 0;
+    const char *method = "";
+};
+
+#ifndef _WIN32
+enum class TransferResult { DONE, UNSUPPORTED, FAILED };
+
+#if defined(__linux__)
+// In-kernel copy without a user-space buffer. UNSUPPORTED (nothing written) lets the caller
+// fall back, e.g. for cross-filesystem copies on older kernels.
+static TransferResult CopyWithCopyFileRange(int in, int out, int64_t size, int64_t &copied) {
+#ifdef SYS_copy_file_range
+    copied = 0;
+    while (copied < size) {
+        long n = syscall(SYS_copy_file_range, in, nullptr, out, nullptr, static_cast<size_t>(size - copied), 0u);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (copied == 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP ||
+                                errno == EBADF)) {
+                return TransferResult::UNSUPPORTED;
+            }
+            return TransferResult::FAILED;
+        }
+        if (n == 0) {
+            break;  // Source shrank while copying
+        }
+        copied += n;
+    }
+    return TransferResult::DONE;
+#else
+    return TransferResult::UNSUPPORTED;
+#endif
+}
+
+static TransferResult CopyWithSendfile(int in, int out, int64_t size, int64_t &copied) {
+    copied = 0;
+    off_t offset = 0;
+    while (copied < size) {
+        ssize_t n = sendfile(out, in, &offset, static_cast<size_t>(size - copied));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (copied == 0 && (errno == EINVAL || errno == ENOSYS)) {
+                return TransferResult::UNSUPPORTED;
+            }
+            return TransferResult::FAILED;
+        }
+        if (n == 0) {
+            break;
+        }
+        copied += n;
+    }
+    return TransferResult::DONE;
+}
+#endif
+
+// Portable fallback; also used for files whose size is not known up front (size 0)
+static TransferResult CopyWithReadWrite(int in, int out, int64_t &copied) {
+    thread_local std::vector<char> buffer(1024 * 1024);
+    copied = 0;
+    while (true) {
+        ssize_t n = read(in, buffer.data(), buffer.size());
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return TransferResult::FAILED;
+        }
+        if (n == 0) {
+            return TransferResult::DONE;
+        }
+        for (ssize_t written = 0; written < n;) {
+            ssize_t w = write(out, buffer.data() + written, static_cast<size_t>(n - written));
+            if (w < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return TransferResult::FAILED;
+            }
+            written += w;
+        }
+        copied += n;
+    }
+}
+#endif
+
+// Copy source to destination (truncating it). Uses the cheapest path available: a reflink
+// (shared extents on btrfs/XFS), copy_file_range, sendfile, then a read/write loop.
+// Returns an empty string on success, otherwise the error message.
+static std::string CopyFileContents(const std::string &source, const std::string &destination,
+                                    FileTransfer &transfer) {
+#ifdef _WIN32
+    std::wstring wsrc = Utf8ToWide(source);
+    std::wstring wdest = Utf8ToWide(destination);
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExW(wsrc.c_str(), GetFileExInfoStandard, &attributes)) {
+        return "Cannot open source file: " + source;
+    }
+    if (!CopyFileW(wsrc.c_str(), wdest.c_str(), FALSE)) {
+        return "Cannot create destination file: " + destination;
+    }
+    transfer.bytes = (static_cast<int64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    transfer.method = "CopyFileW";
+    return "";
+#else
+    int in = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        return "Cannot open source file: " + source;
+    }
+    struct stat st;
+    if (fstat(in, &st) != 0 || S_ISDIR(st.st_mode)) {
+        close(in);
+        return "Cannot open source file: " + source;
+    }
+    struct stat existing;
+    if (stat(destination.c_str(), &existing) == 0 && existing.st_dev == st.st_dev && existing.st_ino == st.st_ino) {
+        // Truncating the destination would destroy the source
+        close(in);
+        return "Source and destination are the same file: " + source;
+    }
+    int out = open(destination.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, st.st_mode & 0777);
+    if (out < 0) {
+        close(in);
+        return "Cannot create destination file: " + destination;
+    }
+
+    int64_t size = static_cast<int64_t>(st.st_size);
+    int64_t copied = 0;
+    TransferResult result = TransferResult::UNSUPPORTED;
+#if defined(__linux__)
+    if (size > 0) {
+        if (ioctl(out, FICLONE, in) == 0) {
+            copied = size;
+            transfer.method = "reflink";
+            result = TransferResult::DONE;
+        }
+        if (result == TransferResult::UNSUPPORTED) {
+            result = CopyWithCopyFileRange(in, out, size, copied);
+            transfer.method = "copy_file_range";
+        }
+        if (result == TransferResult::UNSUPPORTED) {
+            result = CopyWithSendfile(in, out, size, copied);
+            transfer.method = "sendfile";
+        }
+    }
+#endif
+    if (result == TransferResult::UNSUPPORTED) {
+        result = CopyWithReadWrite(in, out, copied);
+        transfer.method = "read_write";
+    }
+    close(in);
+    bool closed = close(out) == 0;
+    if (result != TransferResult::DONE || !closed) {
+        return "Failed to write to destination: " + destination;
+    }
+    transfer.bytes = copied;
+    return "";
+#endif
+}
+
+// Move source to destination (replacing it). A rename where possible; across filesystems
+// the file is copied and the source removed.
+static std::string MoveFileContents(const std::string &source, const std::string &destination,
+                                    FileTransfer &transfer) {
+#ifdef _WIN32
+    std::wstring wsrc = Utf8ToWide(source);
+    std::wstring wdest = Utf8ToWide(destination);
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (GetFileAttributesExW(wsrc.c_str(), GetFileExInfoStandard, &attributes)) {
+        transfer.bytes = (static_cast<int64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    }
+    if (!MoveFileExW(wsrc.c_str(), wdest.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED)) {
+        return "Cannot move file from " + source + " to " + destination;
+    }
+    transfer.method = "MoveFileExW";
+    return "";
+#else
+    struct stat st;
+    if (lstat(source.c_str(), &st) == 0) {
+        transfer.bytes = static_cast<int64_t>(st.st_size);
+    }
+    if (rename(source.c_str(), destination.c_str()) == 0) {
+        transfer.method = "rename";
+        return "";
+    }
+    if (errno != EXDEV) {
+        return "Cannot move file from " + source + " to " + destination;
+    }
+    auto error = CopyFileContents(source, destination, transfer);
+    if (!error.empty()) {
+        return error;
+    }
+    if (unlink(source.c_str()) != 0) {
+        return "Copied but cannot remove source file: " + source;
+    }
+    return "";
+#endif
+}
+
 // Helper function to copy file with error handling
 std::string stps_copy_file_impl(const std::string& source, const std::string& destination) {
     try {
@@ -101,38 +323,19 @@ std::string stps_copy_file_impl(const std::string& source, const std::string& de
             return "ERROR: Source file does not exist: " + source;
         }
 
-        // Open source file
-        std::ifstream src(source, std::ios::binary);
-        if (!src.is_open()) {
-            return "ERROR: Cannot open source file: " + source;
-        }
-
         // Create parent directories if they don't exist
         std::string parent_dir = get_parent_directory(destination);
         if (!parent_dir.empty() && !directory_exists(parent_dir)) {
             if (!create_directories(parent_dir)) {
-                src.close();
                 return "ERROR: Cannot create destination directory: " + parent_dir;
             }
         }
 
-        // Open destination file (truncate if exists)
-        std::ofstream dest(destination, std::ios::binary | std::ios::trunc);
-        if (!dest.is_open()) {
-            src.close();
-            return "ERROR: Cannot create destination file: " + destination;
-        }
-
         // Copy the file
-        dest << src.rdbuf();
-
-        // Close files
-        src.close();
-        dest.close();
-
-        // Check if copy was successful
-        if (!dest.good()) {
-            return "ERROR: Failed to write to destination: " + destination;
+        FileTransfer transfer;
+        auto error = CopyFileContents(source, destination, transfer);
+        if (!error.empty()) {
+            return "ERROR: " + error;
         }
 
         return "SUCCESS: Copied " + source + " to " + destination;
@@ -157,28 +360,12 @@ std::string stps_move_file_impl(const std::string& source, const std::string& de
             }
         }
 
-        // Try to rename (move) the file
-        #ifdef _WIN32
-        // On Windows, remove destination first if it exists
-        if (file_exists(destination)) {
-            std::wstring wdest = Utf8ToWide(destination);
-            if (!DeleteFileW(wdest.c_str())) {
-                return "ERROR: Cannot remove existing destination file: " + destination;
-            }
-        }
-        {
-            std::wstring wsrc = Utf8ToWide(source);
-            std::wstring wdest = Utf8ToWide(destination);
-            if (!MoveFileW(wsrc.c_str(), wdest.c_str())) {
-                return "ERROR: Cannot move file from " + source + " to " + destination;
-            }
-        }
-        #else
-        // On Unix-like systems, rename handles overwrite
-        if (rename(source.c_str(), destination.c_str()) != 0) {
-            return "ERROR: Cannot move file from " + source + " to " + destination;
+        // Move the file (rename, or copy + delete across filesystems)
+        FileTransfer transfer;
+        auto error = MoveFileContents(source, destination, transfer);
+        if (!error.empty()) {
+            return "ERROR: " + error;
         }
-        #endif
 
         return "SUCCESS: Moved " + source + " to " + destination;
     } catch (const std::exception& e) {
@@ -279,13 +466,18 @@ bool delete_directory_recursive(const std::string& path) {
 
         std::string full_path = path + "/" + name;
 
-        struct stat st;
-        if (stat(full_path.c_str(), &st) != 0) {
-            closedir(dir);
-            return false;
+        // d_type saves a stat per entry; symlinks are removed, never followed
+        bool is_dir = entry->d_type == DT_DIR;
+        if (entry->d_type == DT_UNKNOWN) {
+            struct stat st;
+            if (lstat(full_path.c_str(), &st) != 0) {
+                closedir(dir);
+                return false;
+            }
+            is_dir = S_ISDIR(st.st_mode);
         }
 
-        if (S_ISDIR(st.st_mode)) {
+        if (is_dir) {
             if (!delete_directory_recursive(full_path)) {
                 closedir(dir);
                 return false;
@@ -421,6 +613,349 @@ static void StpsRenameIoFunction(DataChunk &args, ExpressionState &state, Vector
         });
 }
 
+//===--------------------------------------------------------------------===//
+// Set-oriented file operations: stps_copy_files / stps_move_files / stps_delete_files
+//===--------------------------------------------------------------------===//
+
+enum class BulkFileOperation { COPY, MOVE, DELETE };
+
+// Operations claimed by a thread per scan call
+static constexpr idx_t BULK_FILE_BATCH_SIZE = 32;
+
+struct BulkFileBindData : public TableFunctionData {
+    BulkFileOperation operation;
+    string table_name;
+    string source_column;
+    string destination_column;
+    bool overwrite = true;
+    idx_t threads = 0;  // 0 = DuckDB thread count
+};
+
+struct BulkFileTask {
+    string source;
+    string destination;
+    bool valid = true;
+};
+
+struct BulkFileGlobalState : public GlobalTableFunctionState {
+    vector<BulkFileTask> tasks;
+    // Destination directories by path: true once created, false if creating them failed.
+    // A directory is only created when the first file is about to be written into it.
+    std::mutex directory_lock;
+    std::unordered_map<string, bool> directories;
+    std::atomic<idx_t> next_task {0};
+    idx_t max_threads = 1;
+
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
+};
+
+static const char *BulkFileFunctionName(BulkFileOperation operation) {
+    switch (operation) {
+    case BulkFileOperation::COPY:
+        return "stps_copy_files";
+    case BulkFileOperation::MOVE:
+        return "stps_move_files";
+    default:
+        return "stps_delete_files";
+    }
+}
+
+static string EscapeIdentifier(const string &name) {
+    string escaped = "\"";
+    for (char c : name) {
+        if (c == '"') {
+            escaped += "\"\"";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+// Schema-qualified table reference ("schema.table" or "table")
+static string EscapeTableRef(const string &table_name) {
+    auto dot_pos = table_name.find('.');
+    if (dot_pos != string::npos) {
+        return EscapeIdentifier(table_name.substr(0, dot_pos)) + "." +
+               EscapeIdentifier(table_name.substr(dot_pos + 1));
+    }
+    return EscapeIdentifier(table_name);
+}
+
+static unique_ptr<FunctionData> BulkFileBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names,
+                                             BulkFileOperation operation) {
+    auto result = make_uniq<BulkFileBindData>();
+    result->operation = operation;
+    const char *function_name = BulkFileFunctionName(operation);
+
+    if (input.inputs.empty() || input.inputs[0].IsNull()) {
+        throw BinderException("%s requires a table name", function_name);
+    }
+    result->table_name = input.inputs[0].GetValue<string>();
+    result->source_column = operation == BulkFileOperation::DELETE ? "path" : "source";
+    result->destination_column = "destination";
+
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "source_column" || kv.first == "path_column") {
+            result->source_column = kv.second.GetValue<string>();
+        } else if (kv.first == "destination_column") {
+            result->destination_column = kv.second.GetValue<string>();
+        } else if (kv.first == "overwrite") {
+            result->overwrite = kv.second.GetValue<bool>();
+        } else if (kv.first == "threads") {
+            auto threads = kv.second.GetValue<int64_t>();
+            if (threads < 1) {
+                throw BinderException("%s: threads must be at least 1", function_name);
+            }
+            result->threads = static_cast<idx_t>(threads);
+        }
+    }
+
+    // Validate the table and its columns up front
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, EscapeTableRef(result->table_name), table, error)) {
+        throw BinderException("%s: table '%s' does not exist or cannot be queried: %s", function_name,
+                              result->table_name, error);
+    }
+    vector<string> required = {result->source_column};
+    if (operation != BulkFileOperation::DELETE) {
+        required.push_back(result->destination_column);
+    }
+    for (auto &column : required) {
+        if (std::find(table.column_names.begin(), table.column_names.end(), column) ==
+            table.column_names.end()) {
+            throw BinderException("%s: column '%s' not found in table '%s'", function_name, column,
+                                  result->table_name);
+        }
+    }
+
+    if (operation == BulkFileOperation::DELETE) {
+        names = {"path", "status", "message", "elapsed_ms"};
+        return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE};
+    } else {
+        names = {"source", "destination", "status", "message", "bytes", "elapsed_ms", "mb_per_second", "method"};
+        return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR,
+                        LogicalType::BIGINT,  LogicalType::DOUBLE,  LogicalType::DOUBLE,  LogicalType::VARCHAR};
+    }
+    return std::move(result);
+}
+
+static unique_ptr<FunctionData> CopyFilesBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+    return BulkFileBind(context, input, return_types, names, BulkFileOperation::COPY);
+}
+
+static unique_ptr<FunctionData> MoveFilesBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+    return BulkFileBind(context, input, return_types, names, BulkFileOperation::MOVE);
+}
+
+static unique_ptr<FunctionData> DeleteFilesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+    return BulkFileBind(context, input, return_types, names, BulkFileOperation::DELETE);
+}
+
+// Init: read the operations table once
+static unique_ptr<GlobalTableFunctionState> BulkFileInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<BulkFileBindData>();
+    auto state = make_uniq<BulkFileGlobalState>();
+    bool has_destination = bind_data.operation != BulkFileOperation::DELETE;
+
+    string sql = "SELECT CAST(" + EscapeIdentifier(bind_data.source_column) + " AS VARCHAR)";
+    if (has_destination) {
+        sql += ", CAST(" + EscapeIdentifier(bind_data.destination_column) + " AS VARCHAR)";
+    }
+    sql += " FROM " + EscapeTableRef(bind_data.table_name);
+
+    auto session = SessionPool::Acquire(context);
+    auto result = session.Query(sql);
+    if (result->HasError()) {
+        throw InvalidInputException("%s: cannot read '%s': %s", BulkFileFunctionName(bind_data.operation),
+                                    bind_data.table_name, result->GetError());
+    }
+    while (true) {
+        auto chunk = result->Fetch();
+        if (!chunk || chunk->size() == 0) {
+            break;
+        }
+        UnifiedVectorFormat source_format, destination_format;
+        chunk->data[0].ToUnifiedFormat(chunk->size(), source_format);
+        if (has_destination) {
+            chunk->data[1].ToUnifiedFormat(chunk->size(), destination_format);
+        }
+        auto sources = UnifiedVectorFormat::GetData<string_t>(source_format);
+        auto destinations = has_destination ? UnifiedVectorFormat::GetData<string_t>(destination_format) : nullptr;
+        for (idx_t row = 0; row < chunk->size(); row++) {
+            BulkFileTask task;
+            auto source_idx = source_format.sel->get_index(row);
+            if (source_format.validity.RowIsValid(source_idx)) {
+                task.source = sources[source_idx].GetString();
+            } else {
+                task.valid = false;
+            }
+            if (has_destination) {
+                auto destination_idx = destination_format.sel->get_index(row);
+                if (destination_format.validity.RowIsValid(destination_idx)) {
+                    task.destination = destinations[destination_idx].GetString();
+                } else {
+                    task.valid = false;
+                }
+            }
+            state->tasks.push_back(std::move(task));
+        }
+    }
+
+    idx_t threads = bind_data.threads;
+    if (threads == 0) {
+        threads = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+    }
+    state->max_threads = MaxValue<idx_t>(1, MinValue<idx_t>(threads, state->tasks.size() / BULK_FILE_BATCH_SIZE + 1));
+    return std::move(state);
+}
+
+// Outcome of one operation
+struct BulkFileOutcome {
+    string status;
+    string message;
+    FileTransfer transfer;
+    double elapsed_ms = 0;
+};
+
+// Create a destination file's parent directory tree, once per directory across all threads
+static bool EnsureDestinationDirectory(BulkFileGlobalState &state, const string &directory) {
+    if (directory.empty()) {
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(state.directory_lock);
+    auto entry = state.directories.find(directory);
+    if (entry != state.directories.end()) {
+        return entry->second;
+    }
+    bool created = create_directories(directory);
+    state.directories.emplace(directory, created);
+    return created;
+}
+
+static BulkFileOutcome RunBulkFileTask(const BulkFileBindData &bind_data, BulkFileGlobalState &state,
+                                       const BulkFileTask &task) {
+    BulkFileOutcome outcome;
+    auto start = std::chrono::steady_clock::now();
+    string error;
+    if (!task.valid) {
+        error = "NULL path";
+    } else if (bind_data.operation == BulkFileOperation::DELETE) {
+        auto message = stps_delete_file_impl(task.source);
+        if (message.compare(0, 9, "SUCCESS: ") == 0) {
+            outcome.message = message.substr(9);
+        } else {
+            error = message.compare(0, 7, "ERROR: ") == 0 ? message.substr(7) : message;
+        }
+    } else if (!file_exists(task.source)) {
+        error = "Source file does not exist: " + task.source;
+    } else if (!bind_data.overwrite && file_exists(task.destination)) {
+        outcome.status = "SKIPPED";
+        outcome.message = "Destination already exists: " + task.destination;
+    } else if (!EnsureDestinationDirectory(state, get_parent_directory(task.destination))) {
+        error = "Cannot create destination directory: " + get_parent_directory(task.destination);
+    } else if (bind_data.operation == BulkFileOperation::COPY) {
+        error = CopyFileContents(task.source, task.destination, outcome.transfer);
+        if (error.empty()) {
+            outcome.message = "Copied " + task.source + " to " + task.destination;
+        }
+    } else {
+        error = MoveFileContents(task.source, task.destination, outcome.transfer);
+        if (error.empty()) {
+            outcome.message = "Moved " + task.source + " to " + task.destination;
+        }
+    }
+    outcome.elapsed_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (!error.empty()) {
+        outcome.status = "ERROR";
+        outcome.message = error;
+    } else if (outcome.status.empty()) {
+        outcome.status = "SUCCESS";
+    }
+    return outcome;
+}
+
+// Scan: every DuckDB thread claims a batch of operations and runs it, so the worker pool is
+// the scheduler's own. Rows come back in completion order.
+static void BulkFileScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<BulkFileBindData>();
+    auto &state = data_p.global_state->Cast<BulkFileGlobalState>();
+
+    idx_t begin = state.next_task.fetch_add(BULK_FILE_BATCH_SIZE);
+    if (begin >= state.tasks.size()) {
+        output.SetCardinality(0);
+        return;
+    }
+    idx_t end = MinValue<idx_t>(begin + BULK_FILE_BATCH_SIZE, state.tasks.size());
+
+    idx_t count = 0;
+    for (idx_t i = begin; i < end; i++, count++) {
+        auto &task = state.tasks[i];
+        auto outcome = RunBulkFileTask(bind_data, state, task);
+
+        idx_t col = 0;
+        if (task.valid) {
+            FlatVector::GetData<string_t>(output.data[col])[count] =
+                StringVector::AddString(output.data[col], task.source);
+        } else {
+            FlatVector::SetNull(output.data[col], count, true);
+        }
+        col++;
+        if (bind_data.operation != BulkFileOperation::DELETE) {
+            if (task.valid) {
+                FlatVector::GetData<string_t>(output.data[col])[count] =
+                    StringVector::AddString(output.data[col], task.destination);
+            } else {
+                FlatVector::SetNull(output.data[col], count, true);
+            }
+            col++;
+        }
+        FlatVector::GetData<string_t>(output.data[col])[count] =
+            StringVector::AddString(output.data[col], outcome.status);
+        col++;
+        FlatVector::GetData<string_t>(output.data[col])[count] =
+            StringVector::AddString(output.data[col], outcome.message);
+        col++;
+        if (bind_data.operation == BulkFileOperation::DELETE) {
+            FlatVector::GetData<double>(output.data[col])[count] = outcome.elapsed_ms;
+            continue;
+        }
+
+        bool transferred = outcome.status == "SUCCESS";
+        if (transferred) {
+            FlatVector::GetData<int64_t>(output.data[col])[count] = outcome.transfer.bytes;
+        } else {
+            FlatVector::SetNull(output.data[col], count, true);
+        }
+        col++;
+        FlatVector::GetData<double>(output.data[col])[count] = outcome.elapsed_ms;
+        col++;
+        if (transferred && outcome.elapsed_ms > 0) {
+            FlatVector::GetData<double>(output.data[col])[count] =
+                static_cast<double>(outcome.transfer.bytes) / (1024.0 * 1024.0) / (outcome.elapsed_ms / 1000.0);
+        } else {
+            FlatVector::SetNull(output.data[col], count, true);
+        }
+        col++;
+        if (transferred) {
+            FlatVector::GetData<string_t>(output.data[col])[count] =
+                StringVector::AddString(output.data[col], outcome.transfer.method);
+        } else {
+            FlatVector::SetNull(output.data[col], count, true);
+        }
+    }
+    output.SetCardinality(count);
+}
+
 void RegisterIoOperationFunctions(ExtensionLoader &loader) {
     // stps_copy_io(source_path, destination_path)
     ScalarFunctionSet copy_io_set("stps_copy_io");
@@ -451,6 +986,24 @@ void RegisterIoOperationFunctions(ExtensionLoader &loader) {
     rename_io_set.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR},
                                              LogicalType::VARCHAR, StpsRenameIoFunction));
     loader.RegisterFunction(rename_io_set);
+
+    // stps_copy_files(table) / stps_move_files(table): one row per source/destination pair
+    TableFunction copy_files("stps_copy_files", {LogicalType::VARCHAR}, BulkFileScan, CopyFilesBind, BulkFileInit);
+    TableFunction move_files("stps_move_files", {LogicalType::VARCHAR}, BulkFileScan, MoveFilesBind, BulkFileInit);
+    for (auto *func : {&copy_files, &move_files}) {
+        func->named_parameters["source_column"] = LogicalType::VARCHAR;
+        func->named_parameters["destination_column"] = LogicalType::VARCHAR;
+        func->named_parameters["overwrite"] = LogicalType::BOOLEAN;
+        func->named_parameters["threads"] = LogicalType::BIGINT;
+        loader.RegisterFunction(*func);
+    }
+
+    // stps_delete_files(table): one row per path
+    TableFunction delete_files("stps_delete_files", {LogicalType::VARCHAR}, BulkFileScan, DeleteFilesBind,
+                               BulkFileInit);
+    delete_files.named_parameters["path_column"] = LogicalType::VARCHAR;
+    delete_files.named_parameters["threads"] = LogicalType::BIGINT;
+    loader.RegisterFunction(delete_files);
 }
 
 } // namespace stps
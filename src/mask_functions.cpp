@@ -1,6 +1,8 @@
 #include "include/mask_functions.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 
@@ -8,38 +10,57 @@
 #include <cmath>
 #include <string>
 #include <vector>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 
 namespace duckdb {
 namespace stps {
 
-// FNV-1a 64-bit hash
-static uint64_t FNV1aHash(const std::string &data) {
-    uint64_t hash = 14695981039346656037ULL;
-    for (unsigned char c : data) {
-        hash ^= c;
+static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+// FNV-1a 64-bit hash, optionally continuing from a previous hash state
+static uint64_t FNV1aHash(const char *data, size_t size, uint64_t hash = FNV_OFFSET_BASIS) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
         hash *= 1099511628211ULL;
     }
     return hash;
 }
 
+// Hash state after "seed:column_name:", the fixed prefix of every keyed hash in a column
+static uint64_t KeyedHashPrefix(const std::string &seed, const std::string &column_name) {
+    uint64_t hash = FNV1aHash(seed.data(), seed.size());
+    hash = FNV1aHash(":", 1, hash);
+    hash = FNV1aHash(column_name.data(), column_name.size(), hash);
+    return FNV1aHash(":", 1, hash);
+}
+
 // Keyed hash: combines seed + column_name + value
 static uint64_t KeyedHash(const std::string &seed, const std::string &column_name, const std::string &value) {
-    std::string input = seed + ":" + column_name + ":" + value;
-    return FNV1aHash(input);
+    return FNV1aHash(value.data(), value.size(), KeyedHashPrefix(seed, column_name));
+}
+
+// Fill target with length hex digits: 16 zero-padded digits per hash round, each round
+// rehashing the decimal form of the previous hash
+static void WriteHashHex(uint64_t hash, char *target, idx_t length) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    uint64_t h = hash;
+    idx_t written = 0;
+    while (written < length) {
+        for (int shift = 60; shift >= 0 && written < length; shift -= 4) {
+            target[written++] = HEX_DIGITS[(h >> shift) & 0xF];
+        }
+        char digits[24];
+        int digit_count = snprintf(digits, sizeof(digits), "%llu", static_cast<unsigned long long>(h));
+        h = FNV1aHash(digits, static_cast<size_t>(digit_count));
+    }
 }
 
 // Convert hash to hex string of given length (min 4)
 static std::string HashToHexString(uint64_t hash, idx_t target_length) {
     if (target_length < 4) target_length = 4;
-    std::ostringstream oss;
-    uint64_t h = hash;
-    while (oss.str().size() < target_length) {
-        oss << std::hex << std::setfill('0') << std::setw(16) << h;
-        h = FNV1aHash(std::to_string(h));
-    }
-    return oss.str().substr(0, target_length);
+    std::string result(target_length, '0');
+    WriteHashHex(hash, &result[0], target_length);
+    return result;
 }
 
 struct MaskTableBindData : public TableFunctionData {
@@ -49,12 +70,14 @@ struct MaskTableBindData : public TableFunctionData {
     std::vector<std::string> column_names;
     std::vector<LogicalType> column_types;
     std::vector<bool> column_masked; // true = mask, false = pass through
+    std::vector<uint64_t> column_hash_prefix; // KeyedHashPrefix(seed, column name)
 };
 
 struct MaskTableGlobalState : public GlobalTableFunctionState {
     unique_ptr<QueryResult> query_result;
     unique_ptr<DataChunk> current_chunk;
     idx_t chunk_offset = 0;
+    std::vector<UnifiedVectorFormat> formats; // Unified formats of current_chunk
     bool finished = false;
 };
 
@@ -83,12 +106,6 @@ static unique_ptr<FunctionData> MaskTableBind(
         }
     }
 
-    // Escape table name for safe SQL interpolation
-    std::string escaped_table_name;
-    for (char c : result->table_name) {
-        if (c == '\'') escaped_table_name += "''";
-        else escaped_table_name += c;
-    }
     std::string quoted_table_name;
     for (char c : result->table_name) {
         if (c == '"') quoted_table_name += "\"\"";
@@ -96,36 +113,16 @@ static unique_ptr<FunctionData> MaskTableBind(
     }
 
     // Discover table schema
-    Connection conn(context.db->GetDatabase(context));
-    auto schema_result = conn.Query(
-        "SELECT column_name, data_type FROM information_schema.columns "
-        "WHERE table_name = '" + escaped_table_name + "' "
-        "AND table_schema NOT IN ('information_schema', 'pg_catalog') "
-        "ORDER BY ordinal_position"
-    );
-
-    if (schema_result->HasError()) {
-        throw BinderException("stps_mask_table: Failed to query schema for table '%s': %s",
-                              result->table_name.c_str(), schema_result->GetError().c_str());
-    }
-
-    // Collect column names for validation
-    while (true) {
-        auto chunk = schema_result->Fetch();
-        if (!chunk || chunk->size() == 0) break;
-        for (idx_t row = 0; row < chunk->size(); row++) {
-            result->column_names.push_back(chunk->data[0].GetValue(row).ToString());
-        }
-    }
-
-    if (result->column_names.empty()) {
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, "\"" + quoted_table_name + "\"", table, error) || table.column_names.empty()) {
         throw BinderException("stps_mask_table: Table '%s' not found or has no columns", result->table_name.c_str());
     }
 
     // Validate excluded columns exist
     for (const auto &excl : result->exclude_columns) {
         bool found = false;
-        for (const auto &col : result->column_names) {
+        for (const auto &col : table.column_names) {
             if (col == excl) { found = true; break; }
         }
         if (!found) {
@@ -134,27 +131,20 @@ static unique_ptr<FunctionData> MaskTableBind(
         }
     }
 
-    // Get actual types by querying the table with LIMIT 0
-    auto type_result = conn.Query("SELECT * FROM \"" + quoted_table_name + "\" LIMIT 0");
-    if (type_result->HasError()) {
-        throw BinderException("stps_mask_table: Failed to query table '%s': %s",
-                              result->table_name.c_str(), type_result->GetError().c_str());
-    }
-
-    // Use the result types and names from the actual query
-    result->column_names.clear();
-    for (idx_t i = 0; i < type_result->names.size(); i++) {
-        result->column_names.push_back(type_result->names[i]);
-        result->column_types.push_back(type_result->types[i]);
+    for (idx_t i = 0; i < table.column_names.size(); i++) {
+        const auto &column_name = table.column_names[i];
+        result->column_names.push_back(column_name);
+        result->column_types.push_back(table.column_types[i]);
 
         bool excluded = false;
         for (const auto &excl : result->exclude_columns) {
-            if (excl == type_result->names[i]) { excluded = true; break; }
+            if (excl == column_name) { excluded = true; break; }
         }
         result->column_masked.push_back(!excluded);
+        result->column_hash_prefix.push_back(KeyedHashPrefix(result->seed, column_name));
 
-        return_types.push_back(type_result->types[i]);
-        names.push_back(type_result->names[i]);
+        return_types.push_back(table.column_types[i]);
+        names.push_back(column_name);
     }
 
     return std::move(result);
@@ -268,13 +258,13 @@ static void MaskTableScan(
 
     // On first call, execute the query
     if (!state.query_result) {
-        Connection conn(context.db->GetDatabase(context));
+        auto session = SessionPool::Acquire(context);
         std::string q_name;
         for (char c : bind_data.table_name) {
             if (c == '"') q_name += "\"\"";
             else q_name += c;
         }
-        state.query_result = conn.Query("SELECT * FROM \"" + q_name + "\"");
+        state.query_result = session.Query("SELECT * FROM \"" + q_name + "\"");
         if (state.query_result->HasError()) {
             throw InternalException("stps_mask_table: Failed to query table '%s': %s",
                                     bind_data.table_name.c_str(), state.query_result->GetError().c_str());
@@ -292,10 +282,37 @@ static void MaskTableScan(
                 state.finished = true;
                 break;
             }
+            state.formats.resize(state.current_chunk->ColumnCount());
+            for (idx_t col = 0; col < state.current_chunk->ColumnCount(); col++) {
+                state.current_chunk->data[col].ToUnifiedFormat(state.current_chunk->size(), state.formats[col]);
+            }
         }
 
         while (state.chunk_offset < state.current_chunk->size() && output_idx < STANDARD_VECTOR_SIZE) {
             for (idx_t col = 0; col < bind_data.column_names.size(); col++) {
+                if (bind_data.column_types[col].id() == LogicalTypeId::VARCHAR) {
+                    // Strings are hashed and masked straight from / into the vectors
+                    auto &format = state.formats[col];
+                    auto &target = output.data[col];
+                    auto idx = format.sel->get_index(state.chunk_offset);
+                    if (!format.validity.RowIsValid(idx)) {
+                        FlatVector::SetNull(target, output_idx, true);
+                        continue;
+                    }
+                    auto &value = UnifiedVectorFormat::GetData<string_t>(format)[idx];
+                    if (!bind_data.column_masked[col]) {
+                        FlatVector::GetData<string_t>(target)[output_idx] = StringVector::AddString(target, value);
+                        continue;
+                    }
+                    uint64_t hash = FNV1aHash(value.GetData(), value.GetSize(), bind_data.column_hash_prefix[col]);
+                    idx_t length = MaxValue<idx_t>(value.GetSize(), 4);
+                    auto masked = StringVector::EmptyString(target, length);
+                    WriteHashHex(hash, masked.GetDataWriteable(), length);
+                    masked.Finalize();
+                    FlatVector::GetData<string_t>(target)[output_idx] = masked;
+                    continue;
+                }
+
                 Value val = state.current_chunk->data[col].GetValue(state.chunk_offset);
 
                 if (bind_data.column_masked[col]) {
@@ -4,6 +4,8 @@
 #include "curl_utils.hpp"
 #include "case_transform.hpp"
 #include "gobd_reader.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/schema_union.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
@@ -12,6 +14,8 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include <atomic>
 #include <fstream>
 #include <algorithm>
 #include <sstream>
@@ -253,6 +257,45 @@ struct NextcloudFolderFileInfo {
     std::string download_url;    // full URL to download
 };
 
+// Text formats are sampled in bind: the schema comes from the file's first bytes
+static constexpr idx_t NEXTCLOUD_SAMPLE_BYTES = 1 << 20;
+
+// Local copy of a downloaded file, removed with its last reference
+struct NextcloudTempFile {
+    explicit NextcloudTempFile(std::string path_p) : path(std::move(path_p)) {
+    }
+    ~NextcloudTempFile() {
+        std::remove(path.c_str());
+    }
+
+    std::string path;
+};
+
+// One source of output rows: a file, or a skipped folder (error only)
+struct NextcloudFolderEntry {
+    std::string parent_folder;
+    std::string child_folder;
+    std::string file_name;
+    std::string download_url;
+
+    // Set in bind: folder skipped or file unreadable; the entry becomes a status row
+    std::string error;
+
+    // File schema detected in bind: names as the reader returns them, normalized names, types
+    // as read (all_varchar on Excel is applied by casting in the scan)
+    std::vector<std::string> source_names;
+    std::vector<std::string> col_names;
+    std::vector<LogicalType> col_types;
+    // Excel sheet with duplicate header names: names from the first row, data read without it
+    bool header_from_first_row = false;
+    // The DuckDB readers failed on the sample; the file is parsed with ParseCSVContent
+    bool csv_fallback = false;
+    // Source index in the bind data's plan
+    idx_t plan_source = DConstants::INVALID_INDEX;
+    // Complete file when it was already downloaded in bind (binary formats, small text files)
+    shared_ptr<NextcloudTempFile> content;
+};
+
 struct NextcloudFolderBindData : public TableFunctionData {
     std::string parent_url;
     std::string child_folder;
@@ -269,12 +312,11 @@ struct NextcloudFolderBindData : public TableFunctionData {
     // Discovered files
     std::vector<NextcloudFolderFileInfo> files;
 
-    // Unified schema from all files (UNION ALL BY NAME)
-    std::vector<std::string> column_names;
-    std::vector<LogicalType> column_types;
+    // Unified schema from all files (UNION ALL BY NAME), planned from the files' headers
+    SchemaUnionPlan plan;
 
-    // All materialized rows (metadata + data columns)
-    std::vector<std::vector<Value>> all_rows;
+    // Output order: skipped folders, then files. The rows are read in the scan.
+    std::vector<NextcloudFolderEntry> entries;
 
     // Track skipped subfolders for error reporting
     struct SkippedFolder {
@@ -284,11 +326,34 @@ struct NextcloudFolderBindData : public TableFunctionData {
     std::vector<SkippedFolder> skipped_folders;
 };
 
+// Threads claim whole entries; each entry's rows carry its index as batch index, which keeps
+// the output in entry order
 struct NextcloudFolderGlobalState : public GlobalTableFunctionState {
-    std::vector<std::vector<Value>> rows;
-    idx_t current_row = 0;
+    std::atomic<idx_t> next_entry {0};
+    std::atomic<idx_t> finished_entries {0};
+    idx_t max_threads = 1;
+
+    idx_t MaxThreads() const override {
+        return max_threads;
+    }
 };
 
+struct NextcloudFolderLocalState : public LocalTableFunctionState {
+    explicit NextcloudFolderLocalState(ClientContext &context) : session(SessionPool::Acquire(context)) {
+    }
+
+    SessionLease session;
+    bool active = false;
+    idx_t entry_index = 0;
+    idx_t rows_emitted = 0;
+    // Local copy of the current file, and the streaming read of it
+    shared_ptr<NextcloudTempFile> file;
+    unique_ptr<QueryResult> result;
+    // ParseCSVContent rows of a csv_fallback file, mapped through fallback_map
+    std::vector<std::vector<Value>> fallback_rows;
+    std::vector<idx_t> fallback_map;
+    idx_t fallback_offset = 0;
+};
 
 // Check if a file type requires binary reading (not CSV parsing)
 static bool IsBinaryFileType(const std::string &file_type) {
@@ -349,6 +414,91 @@ static void DeduplicateColumnNames(std::vector<std::string> &col_names) {
     }
 }
 
+// DuckDB reader call for a local copy of a file: read_sheet for Excel, read_parquet for
+// Parquet/Arrow/Feather, read_csv_auto otherwise
+static std::string BuildReaderExpression(const std::string &path, const std::string &ext, bool all_varchar,
+                                         bool ignore_errors, const std::string &reader_options,
+                                         const std::string &sheet, const std::string &range,
+                                         const std::string &extra_options = "") {
+    std::string read_expr;
+    if (ext == "xlsx" || ext == "xls") {
+        read_expr = "read_sheet('" + path + "'";
+        if (!sheet.empty()) {
+            read_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
+        }
+        if (!range.empty()) {
+            read_expr += ", range='" + EscapeSqlLiteral(range) + "'";
+        }
+        if (all_varchar) {
+            read_expr += ", columns={'*': 'VARCHAR'}";
+        }
+    } else if (ext == "parquet" || ext == "arrow" || ext == "feather") {
+        read_expr = "read_parquet('" + path + "'";
+    } else {
+        // CSV/TSV - use DuckDB's read_csv_auto for robust parsing
+        read_expr = "read_csv_auto('" + path + "'";
+        if (all_varchar) {
+            read_expr += ", all_varchar=true";
+        }
+        if (ignore_errors) {
+            read_expr += ", ignore_errors=true";
+        }
+    }
+    if (!reader_options.empty()) {
+        read_expr += ", " + reader_options;
+    }
+    if (!extra_options.empty()) {
+        read_expr += ", " + extra_options;
+    }
+    return read_expr + ")";
+}
+
+// Excel sheets with duplicate header names cannot be read with header=true. The header
+// row is read on its own, all VARCHAR, so text headers stay as strings instead of becoming
+// NULL in numeric columns...
+static std::string BuildSheetHeaderQuery(const std::string &path, const std::string &sheet,
+                                         const std::string &range) {
+    std::string names_expr = "read_sheet('" + path + "', header=false, columns={'*': 'VARCHAR'}";
+    if (!sheet.empty()) {
+        names_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
+    }
+    if (!range.empty()) {
+        names_expr += ", range='" + EscapeSqlLiteral(range) + "'";
+    }
+    return "SELECT * FROM " + names_expr + ") LIMIT 1";
+}
+
+// ...and the data without it: range='A2' skips the header row entirely, which gives
+// rusty_sheet native type detection (DOUBLE for numbers, DATE for dates) instead of
+// all-VARCHAR (which happens when the text header row is included in type detection).
+// With a user range the header row is skipped with OFFSET 1.
+static std::string BuildSheetDataQuery(const std::string &path, bool all_varchar,
+                                       const std::string &reader_options, const std::string &sheet,
+                                       const std::string &range) {
+    std::string data_expr = "read_sheet('" + path + "', header=false";
+    if (!sheet.empty()) {
+        data_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
+    }
+    if (range.empty()) {
+        data_expr += ", range='A2'";
+    } else {
+        data_expr += ", range='" + EscapeSqlLiteral(range) + "'";
+    }
+    if (all_varchar) {
+        data_expr += ", columns={'*': 'VARCHAR'}";
+    }
+    if (!reader_options.empty()) {
+        data_expr += ", " + reader_options;
+    }
+    data_expr += ")";
+
+    std::string data_query = "SELECT * FROM " + data_expr;
+    if (!range.empty()) {
+        data_query += " OFFSET 1";
+    }
+    return data_query;
+}
+
 // Unified file reader: writes content to temp file, reads via DuckDB's built-in readers with options.
 // Handles CSV, TSV, Parquet, Arrow, Feather, XLSX, XLS.
 // Returns true on success, false on failure.
@@ -388,49 +538,15 @@ static bool ReadFileViaDuckDB(ClientContext &context, const std::string &body, c
         out.write(write_ptr->data(), write_ptr->size());
         out.close();
 
-        auto &db = DatabaseInstance::GetDatabase(context);
-        Connection conn(db);
-
-        // Build the reader expression based on file type
-        std::string read_expr;
+        auto session = SessionPool::Acquire(context);
+        auto &conn = session.Conn();
 
         if (ext == "xlsx" || ext == "xls") {
             conn.Query("INSTALL rusty_sheet FROM community");
             conn.Query("LOAD rusty_sheet");
-            read_expr = "read_sheet('" + temp_path + "'";
-            if (!sheet.empty()) {
-                read_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
-            }
-            if (!range.empty()) {
-                read_expr += ", range='" + EscapeSqlLiteral(range) + "'";
-            }
-            if (all_varchar) {
-                read_expr += ", columns={'*': 'VARCHAR'}";
-            }
-            if (!reader_options.empty()) {
-                read_expr += ", " + reader_options;
-            }
-            read_expr += ")";
-        } else if (ext == "parquet" || ext == "arrow" || ext == "feather") {
-            read_expr = "read_parquet('" + temp_path + "'";
-            if (!reader_options.empty()) {
-                read_expr += ", " + reader_options;
-            }
-            read_expr += ")";
-        } else {
-            // CSV/TSV - use DuckDB's read_csv_auto for robust parsing
-            read_expr = "read_csv_auto('" + temp_path + "'";
-            if (all_varchar) {
-                read_expr += ", all_varchar=true";
-            }
-            if (ignore_errors) {
-                read_expr += ", ignore_errors=true";
-            }
-            if (!reader_options.empty()) {
-                read_expr += ", " + reader_options;
-            }
-            read_expr += ")";
         }
+        std::string read_expr = BuildReaderExpression(temp_path, ext, all_varchar, ignore_errors, reader_options,
+                                                      sheet, range);
 
         std::string base_query = "SELECT * FROM " + read_expr;
 
@@ -445,16 +561,7 @@ static bool ReadFileViaDuckDB(ClientContext &context, const std::string &body, c
 
                 // Step 1: Read with header=false + all VARCHAR to get correct column names
                 // (text headers stay as strings instead of becoming NULL in numeric columns)
-                std::string names_expr = "read_sheet('" + temp_path + "', header=false, columns={'*': 'VARCHAR'}";
-                if (!sheet.empty()) {
-                    names_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
-                }
-                if (!range.empty()) {
-                    names_expr += ", range='" + EscapeSqlLiteral(range) + "'";
-                }
-                names_expr += ")";
-
-                auto names_result = conn.Query("SELECT * FROM " + names_expr + " LIMIT 1");
+                auto names_result = conn.Query(BuildSheetHeaderQuery(temp_path, sheet, range));
                 if (names_result->HasError()) {
                     if (error_out) *error_out = names_result->GetError();
                     std::remove(temp_path.c_str());
@@ -474,32 +581,8 @@ static bool ReadFileViaDuckDB(ClientContext &context, const std::string &body, c
                 }
                 DeduplicateColumnNames(col_names);
 
-                // Step 2: Read data with range='A2' to skip the header row entirely.
-                // This gives rusty_sheet native type detection (DOUBLE for numbers,
-                // DATE for dates) instead of all-VARCHAR (which happens when the
-                // text header row is included in type detection with header=false).
-                std::string data_expr = "read_sheet('" + temp_path + "', header=false";
-                if (!sheet.empty()) {
-                    data_expr += ", sheet='" + EscapeSqlLiteral(sheet) + "'";
-                }
-                if (range.empty()) {
-                    data_expr += ", range='A2'";
-                } else {
-                    data_expr += ", range='" + EscapeSqlLiteral(range) + "'";
-                }
-                if (all_varchar) {
-                    data_expr += ", columns={'*': 'VARCHAR'}";
-                }
-                if (!reader_options.empty()) {
-                    data_expr += ", " + reader_options;
-                }
-                data_expr += ")";
-
-                // With range='A2', header row is excluded. With user range, OFFSET 1.
-                std::string data_query = "SELECT * FROM " + data_expr;
-                if (!range.empty()) {
-                    data_query += " OFFSET 1";
-                }
+                // Step 2: Read data without the header row (see BuildSheetDataQuery)
+                std::string data_query = BuildSheetDataQuery(temp_path, all_varchar, reader_options, sheet, range);
                 auto data_result = conn.Query(data_query);
                 if (data_result->HasError()) {
                     if (error_out) *error_out = data_result->GetError();
@@ -595,6 +678,221 @@ static bool ReadFileViaDuckDB(ClientContext &context, const std::string &body, c
     }
 }
 
+// ============================================================================
+// stps_nextcloud_folder: bind detects each file's schema from a sample, the
+// scan streams the files through DuckDB's readers into the output vectors.
+// ============================================================================
+
+// Write downloaded bytes to a temp file; text formats are converted to UTF-8 first
+static shared_ptr<NextcloudTempFile> WriteNextcloudTempFile(const std::string &body, const std::string &ext,
+                                                            const std::string &encoding) {
+    auto file = make_shared_ptr<NextcloudTempFile>(GenerateTempFilename(ext));
+    std::ofstream out(file->path, std::ios::binary);
+    if (!out) {
+        return nullptr;
+    }
+    if (IsBinaryFileType(ext)) {
+        out.write(body.data(), body.size());
+    } else {
+        std::string converted = encoding.empty() ? EnsureUtf8(body) : ConvertToUtf8(body, encoding);
+        out.write(converted.data(), converted.size());
+    }
+    out.close();
+    return out ? file : nullptr;
+}
+
+static std::string ReadNextcloudTempFile(const NextcloudTempFile &file) {
+    std::ifstream in(file.path, std::ios::binary);
+    std::ostringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+// Download a file, or for text formats only its first NEXTCLOUD_SAMPLE_BYTES cut at the last
+// complete line. complete is set when the body is the whole file. Returns false with error set
+// when the download failed.
+static bool FetchNextcloudFile(const NextcloudFolderBindData &bind, const std::string &url, bool sample,
+                               std::string &body, bool &complete, std::string &error) {
+    CurlHeaders headers;
+    BuildAuthHeaders(headers, bind.username, bind.password);
+    if (sample) {
+        headers.append("Range: bytes=0-" + std::to_string(NEXTCLOUD_SAMPLE_BYTES - 1));
+    }
+
+    long http_code = 0;
+    body = curl_get(NormalizeRequestUrl(url), headers, &http_code);
+    // 416: the range starts beyond the end, i.e. the file is empty
+    if (body.empty() || http_code == 416) {
+        error = "Empty response from server";
+        return false;
+    }
+    if (body.find("ERROR:") == 0 || http_code >= 400) {
+        error = http_code >= 400 ? "HTTP " + std::to_string(http_code) : body.substr(0, 200);
+        return false;
+    }
+
+    // Servers without range support answer 200 with the whole file
+    complete = !sample || http_code != 206 || body.size() < NEXTCLOUD_SAMPLE_BYTES;
+    if (!complete) {
+        auto last_newline = body.find_last_of('\n');
+        if (last_newline != std::string::npos) {
+            body.resize(last_newline + 1);
+        }
+    }
+    return true;
+}
+
+// Detect a file's columns from a local copy, reading a single row. has_rows is set when the
+// file has at least one data row.
+static bool DescribeNextcloudFile(Connection &conn, const NextcloudFolderBindData &bind, const std::string &path,
+                                  NextcloudFolderEntry &entry, bool &has_rows, std::string &error) {
+    if (!bind.reader_options.empty() && !ValidateReaderOptions(bind.reader_options)) {
+        error = "Invalid reader_options: contains disallowed characters (;, --, /*)";
+        return false;
+    }
+    bool is_sheet = bind.file_type == "xlsx" || bind.file_type == "xls";
+    std::string read_expr = BuildReaderExpression(path, bind.file_type, bind.all_varchar, bind.ignore_errors,
+                                                  bind.reader_options, bind.sheet, bind.range);
+
+    auto schema_result = conn.Query("SELECT * FROM " + read_expr + " LIMIT 1");
+    if (!schema_result->HasError()) {
+        entry.source_names = schema_result->names;
+        entry.col_names = schema_result->names;
+        entry.col_types = schema_result->types;
+        has_rows = schema_result->RowCount() > 0;
+        return true;
+    }
+
+    error = schema_result->GetError();
+    // Handle duplicate column names in Excel files by retrying with header=false
+    if (!is_sheet || error.find("duplicate column name") == std::string::npos) {
+        return false;
+    }
+    auto names_result = conn.Query(BuildSheetHeaderQuery(path, bind.sheet, bind.range));
+    if (names_result->HasError()) {
+        error = names_result->GetError();
+        return false;
+    }
+    if (names_result->RowCount() == 0) {
+        error = "No rows found (including header)";
+        return false;
+    }
+    for (idx_t c = 0; c < names_result->ColumnCount(); c++) {
+        auto val = names_result->GetValue(c, 0);
+        entry.col_names.push_back(val.IsNull() ? "column" : val.ToString());
+    }
+    DeduplicateColumnNames(entry.col_names);
+
+    auto data_query = BuildSheetDataQuery(path, bind.all_varchar, bind.reader_options, bind.sheet, bind.range);
+    auto data_result = conn.Query("SELECT * FROM (" + data_query + ") LIMIT 1");
+    if (data_result->HasError()) {
+        error = data_result->GetError();
+        return false;
+    }
+    entry.source_names = data_result->names;
+    entry.col_types = data_result->types;
+    // Trim column names to match data column count (range='A2' may
+    // exclude trailing columns that only had header text, no data)
+    if (entry.col_names.size() > entry.col_types.size()) {
+        entry.col_names.resize(entry.col_types.size());
+    }
+    entry.header_from_first_row = true;
+    has_rows = data_result->RowCount() > 0;
+    error.clear();
+    return true;
+}
+
+// Schema of one file from its sample (text) or full download (binary). Sets entry.error when
+// the file cannot be read; it is then reported as a status row.
+static void DetectNextcloudFileSchema(Connection &conn, const NextcloudFolderBindData &bind,
+                                      NextcloudFolderEntry &entry) {
+    bool binary = IsBinaryFileType(bind.file_type);
+    std::string body;
+    bool complete = false;
+    if (!FetchNextcloudFile(bind, entry.download_url, !binary, body, complete, entry.error)) {
+        return;
+    }
+    auto sample = WriteNextcloudTempFile(body, bind.file_type, bind.encoding);
+    if (!sample) {
+        entry.error = "Failed to write temporary file";
+        return;
+    }
+
+    bool has_rows = false;
+    std::string read_error;
+    if (!DescribeNextcloudFile(conn, bind, sample->path, entry, has_rows, read_error)) {
+        entry.source_names.clear();
+        entry.col_names.clear();
+        entry.col_types.clear();
+        std::vector<std::vector<Value>> rows;
+        if (!binary) {
+            ParseCSVContent(ReadNextcloudTempFile(*sample), entry.col_names, entry.col_types, rows);
+        }
+        if (entry.col_names.empty() || rows.empty()) {
+            entry.error = read_error.empty() ? "Failed to parse file" : read_error;
+            return;
+        }
+        entry.csv_fallback = true;
+        has_rows = true;
+    }
+    if (entry.col_names.empty() || !has_rows) {
+        entry.error = "File has no data rows";
+        return;
+    }
+
+    // Normalize column names to snake_case
+    for (auto &name : entry.col_names) {
+        name = NormalizeColumnName(name);
+    }
+    // Deduplicate after normalization (e.g. "Zeitraum A" and "ZeitraumA" both -> "zeitraum_a")
+    DeduplicateColumnNames(entry.col_names);
+    if (complete) {
+        entry.content = std::move(sample);
+    }
+}
+
+// read_csv types= pinning a sampled text file to the types detected in bind: the full file
+// must not be sniffed again, or a column could come back with another type than planned.
+// Empty when reader_options sets the types itself.
+static std::string PinnedCsvTypes(const NextcloudFolderBindData &bind, const NextcloudFolderEntry &entry) {
+    if (IsBinaryFileType(bind.file_type) || bind.all_varchar) {
+        return "";
+    }
+    auto options = StringUtil::Lower(bind.reader_options);
+    for (auto option : {"types", "dtypes", "column_types", "columns"}) {
+        if (options.find(option) != std::string::npos) {
+            return "";
+        }
+    }
+    std::string types = "types={";
+    for (idx_t i = 0; i < entry.source_names.size(); i++) {
+        if (i > 0) {
+            types += ", ";
+        }
+        types += "'" + EscapeSqlLiteral(entry.source_names[i]) + "': '" + entry.col_types[i].ToString() + "'";
+    }
+    return types + "}";
+}
+
+// Query that reads a local copy of the file in the unified column order: a file's own columns
+// are cast where the unified type is wider (TRY_CAST with ignore_errors), missing ones are NULL.
+// Values of a text file that do not fit the types of its sample fail the read (with
+// ignore_errors read_csv skips their rows).
+static std::string BuildFolderScanQuery(const NextcloudFolderBindData &bind, const NextcloudFolderEntry &entry,
+                                        const std::string &path) {
+    std::string source;
+    if (entry.header_from_first_row) {
+        source = BuildSheetDataQuery(path, bind.all_varchar, bind.reader_options, bind.sheet, bind.range);
+    } else {
+        source = "SELECT * FROM " + BuildReaderExpression(path, bind.file_type, bind.all_varchar, bind.ignore_errors,
+                                                          bind.reader_options, bind.sheet, bind.range,
+                                                          PinnedCsvTypes(bind, entry));
+    }
+
+    auto select = bind.plan.SelectList(entry.plan_source, entry.source_names, bind.ignore_errors);
+    return "SELECT " + select + " FROM (" + source + ") AS nextcloud_file";
+}
+
 static unique_ptr<FunctionData> NextcloudFolderBind(ClientContext &context, TableFunctionBindInput &input,
                                                      vector<LogicalType> &return_types, vector<string> &names) {
     auto result = make_uniq<NextcloudFolderBindData>();
@@ -772,195 +1070,44 @@ static unique_ptr<FunctionData> NextcloudFolderBind(ClientContext &context, Tabl
         }
     }
 
-    if (result->files.empty()) {
-        // No files found - return a minimal schema with metadata columns + _read_status
-        names = {"parent_folder", "child_folder", "file_name", "_read_status"};
-        return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR};
-        // Include error rows for any skipped subfolders
-        for (auto &sf : result->skipped_folders) {
-            result->all_rows.push_back({
-                Value(sf.folder_name), Value(""), Value(""), Value(sf.error)
-            });
-        }
-        return result;
-    }
-
-    // Step 3: Download and parse ALL files (UNION ALL BY NAME)
-    struct ParsedFileData {
-        std::vector<std::string> col_names;
-        std::vector<LogicalType> col_types;
-        std::vector<std::vector<Value>> rows;
-        size_t file_idx;
-        std::string error;  // empty = success
-    };
-    std::vector<ParsedFileData> parsed_files;
-
-    for (size_t file_idx = 0; file_idx < result->files.size(); file_idx++) {
-        CurlHeaders headers;
-        BuildAuthHeaders(headers, result->username, result->password);
-
-        long http_code = 0;
-        std::string request_url = NormalizeRequestUrl(result->files[file_idx].download_url);
-        std::string body = curl_get(request_url, headers, &http_code);
-
-        if (body.find("ERROR:") == 0 || http_code >= 400 || body.empty()) {
-            ParsedFileData pf;
-            pf.file_idx = file_idx;
-            pf.error = body.empty() ? "Empty response from server"
-                     : (http_code >= 400 ? "HTTP " + std::to_string(http_code) : body.substr(0, 200));
-            parsed_files.push_back(std::move(pf));
-            continue;
-        }
-
-        std::vector<std::string> col_names;
-        std::vector<LogicalType> col_types;
-        std::vector<std::vector<Value>> rows;
-
-        std::string read_error;
-        if (!ReadFileViaDuckDB(context, body, result->file_type, result->all_varchar,
-                               result->ignore_errors, result->reader_options,
-                               result->sheet, result->range,
-                               col_names, col_types, rows, &read_error, result->encoding)) {
-            if (!IsBinaryFileType(result->file_type)) {
-                ParseCSVContent(body, col_names, col_types, rows);
-            }
-            if (col_names.empty() || rows.empty()) {
-                ParsedFileData pf;
-                pf.file_idx = file_idx;
-                pf.error = read_error.empty() ? "Failed to parse file" : read_error;
-                parsed_files.push_back(std::move(pf));
-                continue;
-            }
-        }
-
-        if (col_names.empty() || rows.empty()) {
-            ParsedFileData pf;
-            pf.file_idx = file_idx;
-            pf.error = "File has no data rows";
-            parsed_files.push_back(std::move(pf));
-            continue;
-        }
-
-        // Normalize column names to snake_case
-        for (auto &name : col_names) {
-            name = NormalizeColumnName(name);
-        }
-        // Deduplicate after normalization (e.g. "Zeitraum A" and "ZeitraumA" both -> "zeitraum_a")
-        DeduplicateColumnNames(col_names);
-
-        ParsedFileData pf;
-        pf.col_names = std::move(col_names);
-        pf.col_types = std::move(col_types);
-        pf.rows = std::move(rows);
-        pf.file_idx = file_idx;
-        parsed_files.push_back(std::move(pf));
+    if (result->file_type == "xlsx" || result->file_type == "xls") {
+        auto session = SessionPool::Acquire(context);
+        session.Query("INSTALL rusty_sheet FROM community");
+        session.Query("LOAD rusty_sheet");
     }
 
-    // Check if ANY files were parsed successfully
-    bool has_successful_files = false;
-    for (auto &pf : parsed_files) {
-        if (pf.error.empty()) { has_successful_files = true; break; }
+    // Step 3: Detect each file's schema. Text files are only sampled here; every file is
+    // read in full by the scan, so no rows are kept in the bind data.
+    for (auto &sf : result->skipped_folders) {
+        NextcloudFolderEntry entry;
+        entry.parent_folder = sf.folder_name;
+        entry.error = sf.error;
+        result->entries.push_back(std::move(entry));
     }
-
-    if (!has_successful_files) {
-        // No files with data — return metadata + _read_status with error rows
-        names = {"parent_folder", "child_folder", "file_name", "_read_status"};
-        return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR};
-        for (auto &sf : result->skipped_folders) {
-            result->all_rows.push_back({
-                Value(sf.folder_name), Value(""), Value(""), Value(sf.error)
-            });
-        }
-        for (auto &pf : parsed_files) {
-            result->all_rows.push_back({
-                Value(result->files[pf.file_idx].parent_folder),
-                Value(result->files[pf.file_idx].child_folder),
-                Value(result->files[pf.file_idx].file_name),
-                Value(pf.error)
-            });
+    {
+        auto session = SessionPool::Acquire(context);
+        for (auto &file : result->files) {
+            NextcloudFolderEntry entry;
+            entry.parent_folder = file.parent_folder;
+            entry.child_folder = file.child_folder;
+            entry.file_name = file.file_name;
+            entry.download_url = file.download_url;
+            DetectNextcloudFileSchema(session.Conn(), *result, entry);
+            result->entries.push_back(std::move(entry));
         }
-        return result;
     }
 
     // Build unified schema: superset of all column names from successful files (UNION ALL BY NAME)
     // When the same column appears with different types across files, promote to the wider type
     // (e.g., BIGINT + DOUBLE → DOUBLE) to avoid truncating decimal values.
-    std::unordered_map<std::string, size_t> col_name_to_idx;
-    for (auto &pf : parsed_files) {
-        if (!pf.error.empty()) continue;
-        for (size_t i = 0; i < pf.col_names.size(); i++) {
-            auto it = col_name_to_idx.find(pf.col_names[i]);
-            if (it == col_name_to_idx.end()) {
-                col_name_to_idx[pf.col_names[i]] = result->column_names.size();
-                result->column_names.push_back(pf.col_names[i]);
-                result->column_types.push_back(pf.col_types[i]);
-            } else {
-                // Promote to wider type if types differ across files
-                auto &existing_type = result->column_types[it->second];
-                if (existing_type != pf.col_types[i]) {
-                    existing_type = LogicalType::ForceMaxLogicalType(existing_type, pf.col_types[i]);
-                }
-            }
-        }
+    // Without any successful file only the metadata columns and _read_status are returned.
+    for (auto &entry : result->entries) {
+        if (!entry.error.empty()) continue;
+        entry.plan_source = result->plan.AddSource(entry.col_names, entry.col_types);
     }
-
-    // Add error rows for skipped subfolders
-    for (auto &sf : result->skipped_folders) {
-        std::vector<Value> row;
-        row.reserve(4 + result->column_names.size());
-        row.push_back(Value(sf.folder_name));
-        row.push_back(Value(""));
-        row.push_back(Value(""));
-        row.push_back(Value(sf.error));
-        for (size_t i = 0; i < result->column_names.size(); i++) {
-            row.push_back(Value());
-        }
-        result->all_rows.push_back(std::move(row));
-    }
-
-    // Map each file's rows to the unified schema, NULLs for missing columns
-    for (auto &pf : parsed_files) {
-        if (!pf.error.empty()) {
-            // Error row: metadata + error status + NULL data columns
-            std::vector<Value> row;
-            row.reserve(4 + result->column_names.size());
-            row.push_back(Value(result->files[pf.file_idx].parent_folder));
-            row.push_back(Value(result->files[pf.file_idx].child_folder));
-            row.push_back(Value(result->files[pf.file_idx].file_name));
-            row.push_back(Value(pf.error));
-            for (size_t i = 0; i < result->column_names.size(); i++) {
-                row.push_back(Value());
-            }
-            result->all_rows.push_back(std::move(row));
-            continue;
-        }
-
-        // Build column mapping: unified_col_idx -> file_col_idx (-1 if missing)
-        std::vector<int> col_map(result->column_names.size(), -1);
-        for (size_t i = 0; i < pf.col_names.size(); i++) {
-            auto it = col_name_to_idx.find(pf.col_names[i]);
-            if (it != col_name_to_idx.end()) {
-                col_map[it->second] = static_cast<int>(i);
-            }
-        }
-
-        for (auto &row : pf.rows) {
-            std::vector<Value> full_row;
-            full_row.reserve(4 + result->column_names.size());
-            // Metadata columns
-            full_row.push_back(Value(result->files[pf.file_idx].parent_folder));
-            full_row.push_back(Value(result->files[pf.file_idx].child_folder));
-            full_row.push_back(Value(result->files[pf.file_idx].file_name));
-            full_row.push_back(Value());  // _read_status = NULL (success)
-            // Data columns mapped to unified schema
-            for (size_t col = 0; col < result->column_names.size(); col++) {
-                if (col_map[col] >= 0 && static_cast<size_t>(col_map[col]) < row.size()) {
-                    full_row.push_back(row[col_map[col]]);
-                } else {
-                    full_row.push_back(Value());
-                }
-            }
-            result->all_rows.push_back(std::move(full_row));
+    if (result->all_varchar && (result->file_type == "xlsx" || result->file_type == "xls")) {
+        for (idx_t i = 0; i < result->plan.ColumnCount(); i++) {
+            result->plan.SetType(i, LogicalType::VARCHAR);
         }
     }
 
@@ -974,9 +1121,9 @@ static unique_ptr<FunctionData> NextcloudFolderBind(ClientContext &context, Tabl
     names.push_back("_read_status");
     return_types.push_back(LogicalType::VARCHAR);
 
-    for (size_t i = 0; i < result->column_names.size(); i++) {
-        names.push_back(result->column_names[i]);
-        return_types.push_back(result->column_types[i]);
+    for (idx_t i = 0; i < result->plan.ColumnCount(); i++) {
+        names.push_back(result->plan.Names()[i]);
+        return_types.push_back(result->plan.Types()[i]);
     }
 
     return result;
@@ -985,31 +1132,189 @@ static unique_ptr<FunctionData> NextcloudFolderBind(ClientContext &context, Tabl
 static unique_ptr<GlobalTableFunctionState> NextcloudFolderInit(ClientContext &context, TableFunctionInitInput &input) {
     auto &bind = input.bind_data->Cast<NextcloudFolderBindData>();
     auto state = make_uniq<NextcloudFolderGlobalState>();
+    auto threads = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+    state->max_threads = MaxValue<idx_t>(1, MinValue<idx_t>(threads, bind.entries.size()));
+    return state;
+}
 
-    // Copy rows from bind phase
-    state->rows.reserve(bind.all_rows.size());
-    for (auto &row : bind.all_rows) {
-        state->rows.emplace_back(row.begin(), row.end());
+static unique_ptr<LocalTableFunctionState> NextcloudFolderInitLocal(ExecutionContext &context,
+                                                                    TableFunctionInitInput &input,
+                                                                    GlobalTableFunctionState *global_state) {
+    return make_uniq<NextcloudFolderLocalState>(context.client);
+}
+
+// Open an entry's file for streaming: download it unless bind already did, then start the
+// read. Returns the error for the status row, or an empty string.
+static std::string OpenFolderEntry(const NextcloudFolderBindData &bind, const NextcloudFolderEntry &entry,
+                                   NextcloudFolderLocalState &local) {
+    local.file = entry.content;
+    if (!local.file) {
+        std::string body;
+        bool complete = false;
+        std::string error;
+        if (!FetchNextcloudFile(bind, entry.download_url, false, body, complete, error)) {
+            return error;
+        }
+        local.file = WriteNextcloudTempFile(body, bind.file_type, bind.encoding);
+        if (!local.file) {
+            return "Failed to write temporary file";
+        }
     }
 
-    return state;
+    if (entry.csv_fallback) {
+        std::vector<std::string> col_names;
+        std::vector<LogicalType> col_types;
+        ParseCSVContent(ReadNextcloudTempFile(*local.file), col_names, col_types, local.fallback_rows);
+        for (auto &name : col_names) {
+            name = NormalizeColumnName(name);
+        }
+        DeduplicateColumnNames(col_names);
+        auto &union_names = bind.plan.Names();
+        local.fallback_map.assign(union_names.size(), DConstants::INVALID_INDEX);
+        for (idx_t i = 0; i < union_names.size(); i++) {
+            auto it = std::find(col_names.begin(), col_names.end(), union_names[i]);
+            if (it != col_names.end()) {
+                local.fallback_map[i] = static_cast<idx_t>(it - col_names.begin());
+            }
+        }
+        return "";
+    }
+
+    local.result = local.session.Conn().SendQuery(BuildFolderScanQuery(bind, entry, local.file->path));
+    if (local.result->HasError()) {
+        return local.result->GetError();
+    }
+    return "";
+}
+
+// Next rows of the open entry into output's data columns; 0 once the file is done
+static idx_t ReadFolderRows(const NextcloudFolderBindData &bind, NextcloudFolderLocalState &local,
+                            DataChunk &output, std::string &error) {
+    if (!local.result) {
+        idx_t count = 0;
+        while (local.fallback_offset < local.fallback_rows.size() && count < STANDARD_VECTOR_SIZE) {
+            auto &row = local.fallback_rows[local.fallback_offset++];
+            for (idx_t col = 0; col < local.fallback_map.size(); col++) {
+                auto file_col = local.fallback_map[col];
+                output.SetValue(4 + col, count, file_col < row.size() ? row[file_col] : Value());
+            }
+            count++;
+        }
+        return count;
+    }
+
+    unique_ptr<DataChunk> chunk;
+    try {
+        chunk = local.result->Fetch();
+    } catch (std::exception &e) {
+        error = e.what();
+        return 0;
+    }
+    if (local.result->HasError()) {
+        error = local.result->GetError();
+        return 0;
+    }
+    if (!chunk || chunk->size() == 0) {
+        return 0;
+    }
+    // The read already has the unified column order and types
+    for (idx_t col = 0; col < chunk->ColumnCount(); col++) {
+        if (chunk->data[col].GetType() != output.data[4 + col].GetType()) {
+            error = StringUtil::Format("Column %s read as %s instead of %s", bind.plan.Names()[col],
+                                       chunk->data[col].GetType().ToString(),
+                                       output.data[4 + col].GetType().ToString());
+            return 0;
+        }
+    }
+    for (idx_t col = 0; col < chunk->ColumnCount(); col++) {
+        output.data[4 + col].Reference(chunk->data[col]);
+    }
+    return chunk->size();
+}
+
+static void FinishFolderEntry(NextcloudFolderGlobalState &state, NextcloudFolderLocalState &local) {
+    local.active = false;
+    local.result.reset();
+    local.file.reset();
+    local.fallback_rows.clear();
+    local.fallback_map.clear();
+    local.fallback_offset = 0;
+    state.finished_entries++;
+}
+
+static void EmitFolderStatusRow(const NextcloudFolderEntry &entry, const std::string &status, DataChunk &output) {
+    output.SetValue(0, 0, Value(entry.parent_folder));
+    output.SetValue(1, 0, Value(entry.child_folder));
+    output.SetValue(2, 0, Value(entry.file_name));
+    output.SetValue(3, 0, Value(status));
+    for (idx_t col = 4; col < output.ColumnCount(); col++) {
+        output.SetValue(col, 0, Value());
+    }
+    output.SetCardinality(1);
 }
 
 static void NextcloudFolderScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind = data_p.bind_data->Cast<NextcloudFolderBindData>();
     auto &state = data_p.global_state->Cast<NextcloudFolderGlobalState>();
+    auto &local = data_p.local_state->Cast<NextcloudFolderLocalState>();
+
+    output.SetCardinality(0);
+    while (true) {
+        if (!local.active) {
+            local.entry_index = state.next_entry++;
+            if (local.entry_index >= bind.entries.size()) {
+                return;
+            }
+            local.active = true;
+            local.rows_emitted = 0;
+            auto &entry = bind.entries[local.entry_index];
+            auto error = entry.error.empty() ? OpenFolderEntry(bind, entry, local) : entry.error;
+            if (!error.empty()) {
+                EmitFolderStatusRow(entry, error, output);
+                FinishFolderEntry(state, local);
+                return;
+            }
+        }
 
-    idx_t count = 0;
-    idx_t max_count = STANDARD_VECTOR_SIZE;
-
-    while (state.current_row < state.rows.size() && count < max_count) {
-        auto &row = state.rows[state.current_row];
-        for (idx_t col = 0; col < row.size() && col < output.ColumnCount(); col++) {
-            output.SetValue(col, count, row[col]);
+        // Rows already returned for a file that fails mid-read stay; its status row follows them
+        auto &entry = bind.entries[local.entry_index];
+        std::string error;
+        auto count = ReadFolderRows(bind, local, output, error);
+        if (count > 0) {
+            output.data[0].Reference(Value(entry.parent_folder));
+            output.data[1].Reference(Value(entry.child_folder));
+            output.data[2].Reference(Value(entry.file_name));
+            output.data[3].Reference(Value(LogicalType::VARCHAR));  // _read_status = NULL (success)
+            output.SetCardinality(count);
+            local.rows_emitted += count;
+            return;
         }
-        state.current_row++;
-        count++;
+        if (!error.empty() || local.rows_emitted == 0) {
+            EmitFolderStatusRow(entry, error.empty() ? "File has no data rows" : error, output);
+            FinishFolderEntry(state, local);
+            return;
+        }
+        FinishFolderEntry(state, local);
     }
-    output.SetCardinality(count);
+}
+
+static OperatorPartitionData NextcloudFolderPartitionData(ClientContext &context,
+                                                          TableFunctionGetPartitionInput &input) {
+    if (input.partition_info.RequiresPartitionColumns()) {
+        throw InternalException("stps_nextcloud_folder: partition columns are not supported");
+    }
+    auto &local = input.local_state->Cast<NextcloudFolderLocalState>();
+    return OperatorPartitionData(local.entry_index);
+}
+
+static double NextcloudFolderProgress(ClientContext &context, const FunctionData *bind_data,
+                                      const GlobalTableFunctionState *global_state) {
+    auto &bind = bind_data->Cast<NextcloudFolderBindData>();
+    auto &state = global_state->Cast<NextcloudFolderGlobalState>();
+    if (bind.entries.empty()) {
+        return 100.0;
+    }
+    return 100.0 * static_cast<double>(state.finished_entries.load()) / static_cast<double>(bind.entries.size());
 }
 
 // ============================================================================
@@ -1032,7 +1337,10 @@ void RegisterNextcloudFunctions(ExtensionLoader &loader) {
 
     // next_cloud_folder - scan parent folder's company subfolders
     TableFunction folder_func("stps_nextcloud_folder", {LogicalType::VARCHAR},
-                              NextcloudFolderScan, NextcloudFolderBind, NextcloudFolderInit);
+                              NextcloudFolderScan, NextcloudFolderBind, NextcloudFolderInit,
+                              NextcloudFolderInitLocal);
+    folder_func.get_partition_data = NextcloudFolderPartitionData;
+    folder_func.table_scan_progress = NextcloudFolderProgress;
     folder_func.named_parameters["child_folder"] = LogicalType::VARCHAR;
     folder_func.named_parameters["file_type"] = LogicalType::VARCHAR;
     folder_func.named_parameters["username"] = LogicalType::VARCHAR;
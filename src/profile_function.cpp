@@ -0,0 +1,187 @@
+#include "profile_function.hpp"
+#include "shared/profiler.hpp"
+#include "shared/string_arena.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/main/client_context.hpp"
+#include <map>
+
+namespace duckdb {
+namespace stps {
+
+using ::stps::shared::Profiler;
+using ::stps::shared::StageProfile;
+
+// ============ stps_profile ============
+
+struct ProfileBindData : public TableFunctionData {
+    string trace_path;  // Empty: no trace is written
+};
+
+struct ProfileGlobalState : public GlobalTableFunctionState {
+    vector<StageProfile> stages;
+    idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> ProfileBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<ProfileBindData>();
+
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "trace_path") {
+            result->trace_path = StringValue::Get(kv.second);
+        }
+    }
+
+    names = {"stage", "calls", "total_ms", "avg_ms", "min_ms", "max_ms", "pct_of_parent", "bytes", "rows",
+             "histogram_us"};
+    return_types = {LogicalType::VARCHAR, LogicalType::BIGINT, LogicalType::DOUBLE, LogicalType::DOUBLE,
+                    LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::BIGINT,
+                    LogicalType::BIGINT, LogicalType::LIST(LogicalType::BIGINT)};
+    return std::move(result);
+}
+
+// The trace is written and the stages are read when the query runs, not when it is bound
+static unique_ptr<GlobalTableFunctionState> ProfileInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<ProfileBindData>();
+    auto &profiler = Profiler::Instance();
+    auto result = make_uniq<ProfileGlobalState>();
+
+    if (!bind_data.trace_path.empty()) {
+        if (!profiler.Tracing()) {
+            throw InvalidInputException("stps_profile: tracing is off, start it with stps_profile_reset(trace := true)");
+        }
+        if (!profiler.WriteChromeTrace(bind_data.trace_path)) {
+            throw IOException("stps_profile: cannot write trace file: " + bind_data.trace_path);
+        }
+    }
+    result->stages = profiler.Snapshot();
+    return std::move(result);
+}
+
+static void ProfileFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &state = data_p.global_state->Cast<ProfileGlobalState>();
+
+    // Stage "a.b.c" is a part of "a.b": its share is taken relative to that stage
+    std::map<string, uint64_t> totals;
+    for (auto &stage : state.stages) {
+        totals[stage.stage] = stage.total_ns;
+    }
+
+    idx_t count = 0;
+    while (state.offset < state.stages.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &stage = state.stages[state.offset];
+        output.SetValue(0, count, Value(stage.stage));
+        output.SetValue(1, count, Value::BIGINT(static_cast<int64_t>(stage.calls)));
+        output.SetValue(2, count, Value::DOUBLE(stage.total_ns / 1e6));
+        output.SetValue(3, count, Value::DOUBLE(stage.calls > 0 ? stage.total_ns / 1e6 / stage.calls : 0.0));
+        output.SetValue(4, count, Value::DOUBLE(stage.min_ns / 1e6));
+        output.SetValue(5, count, Value::DOUBLE(stage.max_ns / 1e6));
+
+        Value pct_of_parent;
+        auto dot = stage.stage.rfind('.');
+        if (dot != string::npos) {
+            auto parent = totals.find(stage.stage.substr(0, dot));
+            if (parent != totals.end() && parent->second > 0) {
+                pct_of_parent = Value::DOUBLE(100.0 * stage.total_ns / parent->second);
+            }
+        }
+        output.SetValue(6, count, pct_of_parent);
+        output.SetValue(7, count, Value::BIGINT(static_cast<int64_t>(stage.bytes)));
+        output.SetValue(8, count, Value::BIGINT(static_cast<int64_t>(stage.rows)));
+
+        vector<Value> buckets;
+        for (auto bucket : stage.histogram) {
+            buckets.push_back(Value::BIGINT(static_cast<int64_t>(bucket)));
+        }
+        output.SetValue(9, count, Value::LIST(LogicalType::BIGINT, std::move(buckets)));
+
+        state.offset++;
+        count++;
+    }
+    output.SetCardinality(count);
+}
+
+// ============ stps_profile_reset ============
+
+// Unset options keep the profiler's current setting
+struct ProfileResetBindData : public TableFunctionData {
+    bool set_enabled = false;
+    bool enabled = false;
+    bool set_tracing = false;
+    bool tracing = false;
+};
+
+struct ProfileResetGlobalState : public GlobalTableFunctionState {
+    bool enabled = false;
+    bool tracing = false;
+    bool finished = false;
+};
+
+static unique_ptr<FunctionData> ProfileResetBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<ProfileResetBindData>();
+
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "enabled") {
+            result->set_enabled = true;
+            result->enabled = BooleanValue::Get(kv.second);
+        } else if (kv.first == "trace") {
+            result->set_tracing = true;
+            result->tracing = BooleanValue::Get(kv.second);
+        }
+    }
+
+    names = {"enabled", "tracing"};
+    return_types = {LogicalType::BOOLEAN, LogicalType::BOOLEAN};
+    return std::move(result);
+}
+
+// The reset happens when the query runs, not when it is bound (a prepared statement
+// resets on every execution)
+static unique_ptr<GlobalTableFunctionState> ProfileResetInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<ProfileResetBindData>();
+    auto &profiler = Profiler::Instance();
+    auto result = make_uniq<ProfileResetGlobalState>();
+
+    if (bind_data.set_enabled) {
+        profiler.SetEnabled(bind_data.enabled);
+    }
+    if (bind_data.set_tracing) {
+        profiler.SetTracing(bind_data.tracing);
+    }
+    profiler.Reset();
+    // arena.block then counts from cold arenas instead of the blocks kept since warm-up
+    ::stps::shared::StringArena::ReleaseAll();
+    result->enabled = profiler.Enabled();
+    result->tracing = profiler.Tracing();
+    return std::move(result);
+}
+
+static void ProfileResetFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &state = data_p.global_state->Cast<ProfileResetGlobalState>();
+    if (state.finished) {
+        output.SetCardinality(0);
+        return;
+    }
+    output.SetValue(0, 0, Value::BOOLEAN(state.enabled));
+    output.SetValue(1, 0, Value::BOOLEAN(state.tracing));
+    output.SetCardinality(1);
+    state.finished = true;
+}
+
+void RegisterProfileFunctions(ExtensionLoader& loader) {
+    // stps_profile(trace_path := VARCHAR)
+    TableFunction profile_func("stps_profile", {}, ProfileFunction, ProfileBind, ProfileInit);
+    profile_func.named_parameters["trace_path"] = LogicalType::VARCHAR;
+    loader.RegisterFunction(profile_func);
+
+    // stps_profile_reset(enabled := BOOLEAN, trace := BOOLEAN)
+    TableFunction reset_func("stps_profile_reset", {}, ProfileResetFunction, ProfileResetBind, ProfileResetInit);
+    reset_func.named_parameters["enabled"] = LogicalType::BOOLEAN;
+    reset_func.named_parameters["trace"] = LogicalType::BOOLEAN;
+    loader.RegisterFunction(reset_func);
+}
+
+} // namespace stps
+} // namespace duckdb
@@ -7,9 +7,10 @@
 
 namespace stps {
 
-bool ScanScanner::PassesBasicFilters(duckdb::FileSystem& fs, const std::string& path, bool is_directory,
+bool ScanScanner::PassesBasicFilters(duckdb::FileSystem& fs, const shared::WalkEntry& entry,
                                      const ScanFunctionOptions& options) {
-    const std::string filename = shared::FileSystemUtils::GetName(fs, path);
+    const std::string& filename = entry.name;
+    const bool is_directory = entry.is_directory;
 
     // Check hidden files first (cheapest)
     if (!options.include_hidden && shared::FileSystemUtils::IsHidden(filename)) {
@@ -30,7 +31,7 @@ bool ScanScanner::PassesBasicFilters(duckdb::FileSystem& fs, const std::string&
 
     // Check file_type third (extension comparison)
     if (!options.file_type.empty() && !is_directory) {
-        std::string ext = shared::FileSystemUtils::GetExtension(fs, path);
+        std::string ext = shared::FileSystemUtils::GetExtension(fs, entry.path);
         std::string file_type_lower = options.file_type;
         std::string ext_lower = ext;
         std::transform(file_type_lower.begin(), file_type_lower.end(), file_type_lower.begin(), ::tolower);
@@ -44,83 +45,47 @@ bool ScanScanner::PassesBasicFilters(duckdb::FileSystem& fs, const std::string&
     return true;
 }
 
-bool ScanScanner::PassesAdvancedFilters(duckdb::FileSystem& fs, const std::string& path,
-                                         const ScanFunctionOptions& options) {
-    // Size filters
-    if (options.min_size >= 0 || options.max_size >= 0) {
-        try {
-            auto handle = fs.OpenFile(path, duckdb::FileOpenFlags::FILE_FLAGS_READ);
-            int64_t size = fs.GetFileSize(*handle);
-            if (options.min_size >= 0 && size < options.min_size) {
-                return false;
-            }
-            if (options.max_size >= 0 && size > options.max_size) {
-                return false;
-            }
-        } catch (...) {
-            return false;
-        }
+bool ScanScanner::PassesAdvancedFilters(duckdb::FileSystem& fs, shared::WalkEntry& entry,
+                                         const ScanFunctionOptions& options,
+                                         const shared::ContentSearcher* searcher) {
+    // Size and date filters (stat'ed by the walker): an entry that could not be stat'ed
+    // does not match them
+    if (entry.stat_failed && (options.min_size >= 0 || options.max_size >= 0 || options.min_date >= 0 ||
+                              options.max_date >= 0)) {
+        return false;
+    }
+    if (options.min_size >= 0 && entry.size < options.min_size) {
+        return false;
+    }
+    if (options.max_size >= 0 && entry.size > options.max_size) {
+        return false;
     }
 
     // Date filters
-    if (options.min_date >= 0 || options.max_date >= 0) {
-        int64_t timestamp = shared::FileSystemUtils::GetModifiedTime(fs, path);
-        if (options.min_date >= 0 && timestamp < options.min_date) {
-            return false;
-        }
-        if (options.max_date >= 0 && timestamp > options.max_date) {
-            return false;
-        }
+    if (options.min_date >= 0 && entry.modified_time < options.min_date) {
+        return false;
+    }
+    if (options.max_date >= 0 && entry.modified_time > options.max_date) {
+        return false;
     }
 
-    // Content search (expensive - file I/O)
-    if (!options.content_search.empty()) {
-        if (!shared::ContentSearcher::FileContainsText(fs, path, options.content_search)) {
+    // Content search (expensive - file I/O, runs on the walker threads so files are searched in parallel)
+    if (searcher) {
+        shared::ContentMatch match;
+        if (!searcher->SearchFile(fs, entry.path, match)) {
             return false;
         }
+        entry.match_line = match.line;
+        entry.match_offset = match.offset;
     }
 
     return true;
 }
 
-void ScanScanner::ScanRecursive(duckdb::FileSystem& fs, const std::string& path, const ScanFunctionOptions& options,
-                                std::vector<shared::FileInfo>& results, int current_depth) {
-    // Check depth limit
-    if (options.max_depth >= 0 && current_depth > options.max_depth) {
-        return;
-    }
-
-    try {
-        fs.ListFiles(path, [&](const std::string& entry_name, bool is_dir) {
-            // Build full path by joining current path with entry name
-            std::string full_path = fs.JoinPath(path, entry_name);
-            // Apply basic filters first (fast)
-            if (PassesBasicFilters(fs, full_path, is_dir, options)) {
-                if (!is_dir) {
-                    // Apply advanced filters (slower)
-                    if (PassesAdvancedFilters(fs, full_path, options)) {
-                        results.push_back(shared::FileSystemUtils::GetFileStats(fs, full_path, false));
-                    }
-                } else if (options.recursive) {
-                    // Add directory entry
-                    results.push_back(shared::FileSystemUtils::GetFileStats(fs, full_path, true));
-                    // Recurse into subdirectory
-                    ScanRecursive(fs, full_path, options, results, current_depth + 1);
-                }
-            } else if (is_dir && options.recursive) {
-                // Even if directory doesn't match filter, still recurse
-                ScanRecursive(fs, full_path, options, results, current_depth + 1);
-            }
-        });
-    } catch (...) {
-        // Skip directories we can't access (permission denied, etc.)
-    }
-}
-
-std::vector<shared::FileInfo> ScanScanner::ScanPath(duckdb::FileSystem& fs, const ScanFunctionOptions& options) {
-    std::vector<shared::FileInfo> results;
-    results.reserve(256); // Pre-allocate for typical case
-
+std::unique_ptr<shared::DirectoryWalker> ScanScanner::StartScan(duckdb::ClientContext& context,
+                                                                 duckdb::FileSystem& fs,
+                                                                 const ScanFunctionOptions& options,
+                                                                 bool need_stat, size_t threads) {
     // Validate path
     if (!fs.DirectoryExists(options.base_path)) {
         if (!fs.FileExists(options.base_path)) {
@@ -130,25 +95,25 @@ std::vector<shared::FileInfo> ScanScanner::ScanPath(duckdb::FileSystem& fs, cons
         }
     }
 
-    if (options.recursive) {
-        ScanRecursive(fs, options.base_path, options, results, 0);
-    } else {
-        // Non-recursive scan
-        try {
-            fs.ListFiles(options.base_path, [&](const std::string& entry_name, bool is_dir) {
-                // Build full path by joining base_path with entry name
-                std::string full_path = fs.JoinPath(options.base_path, entry_name);
-                if (PassesBasicFilters(fs, full_path, is_dir, options) &&
-                    (is_dir || PassesAdvancedFilters(fs, full_path, options))) {
-                    results.push_back(shared::FileSystemUtils::GetFileStats(fs, full_path, is_dir));
-                }
-            });
-        } catch (const std::exception& e) {
-            throw std::runtime_error("Error scanning directory: " + std::string(e.what()));
-        }
+    shared::WalkOptions walk;
+    walk.recursive = options.recursive;
+    walk.max_depth = options.max_depth;
+    walk.need_stat = need_stat || options.min_size >= 0 || options.max_size >= 0 || options.min_date >= 0 ||
+                     options.max_date >= 0;
+    walk.threads = threads;
+
+    // Built once and shared by all walker threads
+    std::shared_ptr<shared::ContentSearcher> searcher;
+    if (!options.content_search.empty()) {
+        searcher = std::make_shared<shared::ContentSearcher>(options.content_search, options.content_ignore_case);
     }
 
-    return results;
+    return std::unique_ptr<shared::DirectoryWalker>(new shared::DirectoryWalker(
+        context, fs, options.base_path, walk, [&fs, options, searcher](shared::WalkEntry& entry) {
+            // Basic filters first (fast), advanced filters only for files (slower)
+            return PassesBasicFilters(fs, entry, options) &&
+                   (entry.is_directory || PassesAdvancedFilters(fs, entry, options, searcher.get()));
+        }));
 }
 
 } // namespace stps
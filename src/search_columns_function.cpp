@@ -3,6 +3,8 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include <algorithm>
 #include <cctype>
 
@@ -68,18 +70,15 @@ static unique_ptr<FunctionData> SearchColumnsBind(ClientContext &context, TableF
     result->table_name = input.inputs[0].GetValue<string>();
     result->search_pattern = input.inputs[1].GetValue<string>();
 
-    Connection conn(context.db->GetDatabase(context));
-
-    string schema_query = "SELECT * FROM " + result->table_name + " LIMIT 0";
-    auto schema_result = conn.Query(schema_query);
-
-    if (schema_result->HasError()) {
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, result->table_name, table, error)) {
         throw BinderException("Table '%s' not found or inaccessible: %s",
-                            result->table_name.c_str(), schema_result->GetError().c_str());
+                            result->table_name.c_str(), error.c_str());
     }
 
-    result->original_column_names = schema_result->names;
-    result->original_column_types = schema_result->types;
+    result->original_column_names = std::move(table.column_names);
+    result->original_column_types = std::move(table.column_types);
 
     if (result->original_column_names.empty()) {
         throw BinderException("Table '%s' has no columns", result->table_name.c_str());
@@ -120,12 +119,7 @@ static void SearchColumnsFunction(ClientContext &context, TableFunctionInput &da
 
     // Execute query on first call
     if (!state.query_executed) {
-        Connection conn(context.db->GetDatabase(context));
-
-        auto prepared = conn.Prepare(bind_data.generated_sql);
-        if (prepared->HasError()) {
-            throw InvalidInputException("Failed to prepare search query: %s", prepared->GetError().c_str());
-        }
+        auto session = SessionPool::Acquire(context);
 
         // Bind pattern for each column in WHERE clause
         vector<Value> params;
@@ -133,7 +127,8 @@ static void SearchColumnsFunction(ClientContext &context, TableFunctionInput &da
             params.push_back(Value(bind_data.search_pattern));
         }
 
-        state.result = prepared->Execute(params);
+        // Prepared once per pooled connection; the same table is usually searched repeatedly
+        state.result = session.Execute(bind_data.generated_sql, std::move(params));
 
         if (state.result->HasError()) {
             throw InvalidInputException("Search query failed: %s", state.result->GetError().c_str());
@@ -3,30 +3,19 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
+#include "shared/table_driver.hpp"
 #include <algorithm>
 #include <cctype>
-#include <sstream>
 
 namespace duckdb {
 namespace stps {
 
 struct SearchDatabaseBindData : public TableFunctionData {
     string search_pattern;
-    vector<string> schema_names;
-    vector<string> table_names;
-    vector<vector<string>> table_columns; // columns for each table
-};
-
-struct SearchDatabaseGlobalState : public GlobalTableFunctionState {
-    idx_t current_table_idx = 0;
-    idx_t current_col_idx = 0;
-    unique_ptr<QueryResult> current_result;
-    unique_ptr<DataChunk> current_chunk;
-    idx_t chunk_offset = 0;
-    bool finished = false;
-    string current_schema_name;
-    string current_table_name;
-    string current_column_name;
+    vector<CatalogTableInfo> tables;
+    TableDriverOptions options;
 };
 
 // Helper: escape identifier for SQL
@@ -65,34 +54,49 @@ static bool MatchesPattern(const string &value, const string &pattern) {
     return p == lower_pattern.size();
 }
 
-// Convert a row to JSON string for context
-static string RowToJson(DataChunk &chunk, idx_t row, const vector<string> &column_names) {
-    std::ostringstream json;
-    json << "{";
+// Append text with JSON string escaping
+static void AppendJsonEscaped(string &json, const char *data, idx_t size) {
+    for (idx_t i = 0; i < size; i++) {
+        char c = data[i];
+        if (c == '"') json += "\\\"";
+        else if (c == '\\') json += "\\\\";
+        else if (c == '\n') json += "\\n";
+        else if (c == '\r') json += "\\r";
+        else if (c == '\t') json += "\\t";
+        else json += c;
+    }
+}
+
+// Convert a row to JSON string for context. json is cleared and reused across rows;
+// formats holds the unified format of every chunk column.
+static void RowToJson(DataChunk &chunk, const vector<UnifiedVectorFormat> &formats, idx_t row,
+                      const vector<string> &column_names, string &json) {
+    json.clear();
+    json += '{';
     for (idx_t col = 0; col < chunk.ColumnCount(); col++) {
-        if (col > 0) json << ", ";
-        json << "\"" << column_names[col] << "\": ";
-        
-        if (FlatVector::IsNull(chunk.data[col], row)) {
-            json << "null";
+        if (col > 0) json += ", ";
+        json += '"';
+        json += column_names[col];
+        json += "\": ";
+
+        auto &format = formats[col];
+        auto idx = format.sel->get_index(row);
+        if (!format.validity.RowIsValid(idx)) {
+            json += "null";
+            continue;
+        }
+        json += '"';
+        if (chunk.data[col].GetType().id() == LogicalTypeId::VARCHAR) {
+            // Strings are escaped straight from the vector
+            auto &value = UnifiedVectorFormat::GetData<string_t>(format)[idx];
+            AppendJsonEscaped(json, value.GetData(), value.GetSize());
         } else {
-            Value val = chunk.data[col].GetValue(row);
-            string str_val = val.ToString();
-            // Escape quotes in string
-            string escaped;
-            for (char c : str_val) {
-                if (c == '"') escaped += "\\\"";
-                else if (c == '\\') escaped += "\\\\";
-                else if (c == '\n') escaped += "\\n";
-                else if (c == '\r') escaped += "\\r";
-                else if (c == '\t') escaped += "\\t";
-                else escaped += c;
-            }
-            json << "\"" << escaped << "\"";
+            auto str_val = chunk.data[col].GetValue(row).ToString();
+            AppendJsonEscaped(json, str_val.data(), str_val.size());
         }
+        json += '"';
     }
-    json << "}";
-    return json.str();
+    json += '}';
 }
 
 static unique_ptr<FunctionData> SearchDatabaseBind(ClientContext &context, TableFunctionBindInput &input,
@@ -104,57 +108,16 @@ static unique_ptr<FunctionData> SearchDatabaseBind(ClientContext &context, Table
     }
 
     result->search_pattern = input.inputs[0].GetValue<string>();
+    result->options = ParallelTableDriver::ParseOptions(input.named_parameters, "stps_search_database");
 
-    // Get all tables from the database across all schemas
-    Connection conn(context.db->GetDatabase(context));
-
-    // Query to get all tables from all user schemas (excluding system schemas)
-    auto tables_result = conn.Query(
-        "SELECT table_schema, table_name FROM information_schema.tables "
-        "WHERE table_type = 'BASE TABLE' "
-        "AND table_schema NOT IN ('information_schema', 'pg_catalog') "
-        "ORDER BY table_schema, table_name"
-    );
-
-    if (tables_result->HasError()) {
-        throw BinderException("Failed to get tables: %s", tables_result->GetError().c_str());
-    }
-
-    // Collect all schema + table names
-    while (true) {
-        auto chunk = tables_result->Fetch();
-        if (!chunk || chunk->size() == 0) break;
-
-        for (idx_t row = 0; row < chunk->size(); row++) {
-            string schema_name = chunk->data[0].GetValue(row).ToString();
-            string table_name = chunk->data[1].GetValue(row).ToString();
-            result->schema_names.push_back(schema_name);
-            result->table_names.push_back(table_name);
+    // All user tables with their columns, straight from the catalog. Empty tables cannot
+    // match and are left out.
+    for (auto &table : ListTables(context)) {
+        if (table.estimated_rows != 0) {
+            result->tables.push_back(std::move(table));
         }
     }
 
-    // For each table, get column names
-    for (idx_t i = 0; i < result->table_names.size(); i++) {
-        const auto &schema_name = result->schema_names[i];
-        const auto &table_name = result->table_names[i];
-        string col_query = "SELECT column_name FROM information_schema.columns "
-                          "WHERE table_schema = '" + schema_name + "' AND table_name = '" + table_name + "'";
-        auto cols_result = conn.Query(col_query);
-
-        vector<string> columns;
-        if (!cols_result->HasError()) {
-            while (true) {
-                auto chunk = cols_result->Fetch();
-                if (!chunk || chunk->size() == 0) break;
-
-                for (idx_t row = 0; row < chunk->size(); row++) {
-                    columns.push_back(chunk->data[0].GetValue(row).ToString());
-                }
-            }
-        }
-        result->table_columns.push_back(columns);
-    }
-
     // Output schema: schema_name, table_name, column_name, matched_value, row_data (JSON)
     return_types.push_back(LogicalType::VARCHAR);
     names.push_back("schema_name");
@@ -174,142 +137,129 @@ static unique_ptr<FunctionData> SearchDatabaseBind(ClientContext &context, Table
     return std::move(result);
 }
 
-static unique_ptr<GlobalTableFunctionState> SearchDatabaseInit(ClientContext &context, TableFunctionInitInput &input) {
-    auto state = make_uniq<SearchDatabaseGlobalState>();
-    state->finished = false;
-    return std::move(state);
-}
-
-// Helper to start querying a specific column in a table
-static bool StartColumnQuery(ClientContext &context, SearchDatabaseGlobalState &state, 
-                             const SearchDatabaseBindData &bind_data) {
-    if (state.current_table_idx >= bind_data.table_names.size()) {
-        state.finished = true;
-        return false;
-    }
-
-    const string &schema_name = bind_data.schema_names[state.current_table_idx];
-    const string &table_name = bind_data.table_names[state.current_table_idx];
-    const vector<string> &columns = bind_data.table_columns[state.current_table_idx];
-
-    if (state.current_col_idx >= columns.size()) {
-        // Move to next table
-        state.current_table_idx++;
-        state.current_col_idx = 0;
-        return StartColumnQuery(context, state, bind_data);
-    }
-
-    const string &column_name = columns[state.current_col_idx];
-    state.current_schema_name = schema_name;
-    state.current_table_name = table_name;
-    state.current_column_name = column_name;
-
-    // Build query to search this specific column (schema-qualified)
-    string sql = "SELECT * FROM " + EscapeIdentifier(schema_name) + "." + EscapeIdentifier(table_name) +
-                 " WHERE LOWER(CAST(" + EscapeIdentifier(column_name) +
-                 " AS VARCHAR)) LIKE LOWER(?)";
-
-    Connection conn(context.db->GetDatabase(context));
-    auto prepared = conn.Prepare(sql);
-    
-    if (prepared->HasError()) {
-        // Skip this column if query fails
-        state.current_col_idx++;
-        return StartColumnQuery(context, state, bind_data);
-    }
-
-    vector<Value> params;
-    params.push_back(Value(bind_data.search_pattern));
-    
-    state.current_result = prepared->Execute(params);
-    
-    if (state.current_result->HasError()) {
-        // Skip this column if execution fails
-        state.current_col_idx++;
-        return StartColumnQuery(context, state, bind_data);
-    }
-
-    state.current_chunk.reset();
-    state.chunk_offset = 0;
-    return true;
-}
-
-static void SearchDatabaseFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-    auto &bind_data = data_p.bind_data->Cast<SearchDatabaseBindData>();
-    auto &state = data_p.global_state->Cast<SearchDatabaseGlobalState>();
-
-    if (state.finished) {
-        output.SetCardinality(0);
-        return;
+// Per-thread cursor: one query per column of the current table, rows of the current chunk
+class SearchDatabaseLocalState : public TableDriverLocalState {
+public:
+    SearchDatabaseLocalState(ClientContext &context, const SearchDatabaseBindData &bind_data_p)
+        : TableDriverLocalState(context), bind_data(bind_data_p) {
     }
 
-    // Initialize first query if needed
-    if (!state.current_result) {
-        if (!StartColumnQuery(context, state, bind_data)) {
-            output.SetCardinality(0);
-            return;
-        }
+    void BeginTable(ClientContext &context, const CatalogTableInfo &table_p) override {
+        table = &table_p;
+        column_idx = 0;
+        result.reset();
+        chunk.reset();
+        chunk_offset = 0;
     }
 
-    idx_t output_idx = 0;
-    
-    while (output_idx < STANDARD_VECTOR_SIZE && !state.finished) {
-        // Get current chunk or fetch new one
-        if (!state.current_chunk || state.chunk_offset >= state.current_chunk->size()) {
-            state.current_chunk = state.current_result->Fetch();
-            state.chunk_offset = 0;
-
-            if (!state.current_chunk || state.current_chunk->size() == 0) {
-                // Move to next column
-                state.current_col_idx++;
-                if (!StartColumnQuery(context, state, bind_data)) {
-                    break;
+    bool NextRows(ClientContext &context, DataChunk &output) override {
+        idx_t output_idx = 0;
+        while (output_idx < STANDARD_VECTOR_SIZE) {
+            // Get current chunk or fetch new one
+            if (!chunk || chunk_offset >= chunk->size()) {
+                if (!NextChunk()) {
+                    output.SetCardinality(output_idx);
+                    return false;
                 }
                 continue;
             }
-        }
 
-        // Get column names for current table
-        const vector<string> &columns = bind_data.table_columns[state.current_table_idx];
-        
-        // Find the column index for the matched column
-        idx_t matched_col_idx = 0;
-        for (idx_t i = 0; i < columns.size(); i++) {
-            if (columns[i] == state.current_column_name) {
-                matched_col_idx = i;
-                break;
+            auto &column_name = table->column_names[column_idx];
+            while (chunk_offset < chunk->size() && output_idx < STANDARD_VECTOR_SIZE) {
+                idx_t row = chunk_offset;
+                // schema_name
+                FlatVector::GetData<string_t>(output.data[0])[output_idx] =
+                    StringVector::AddString(output.data[0], table->schema);
+                // table_name
+                FlatVector::GetData<string_t>(output.data[1])[output_idx] =
+                    StringVector::AddString(output.data[1], table->name);
+                // column_name
+                FlatVector::GetData<string_t>(output.data[2])[output_idx] =
+                    StringVector::AddString(output.data[2], column_name);
+                // matched_value
+                FlatVector::GetData<string_t>(output.data[3])[output_idx] =
+                    StringVector::AddString(output.data[3], chunk->data[column_idx].GetValue(row).ToString());
+                // row_data (JSON)
+                RowToJson(*chunk, formats, row, table->column_names, row_json);
+                FlatVector::GetData<string_t>(output.data[4])[output_idx] =
+                    StringVector::AddString(output.data[4], row_json);
+
+                output_idx++;
+                chunk_offset++;
             }
         }
+        output.SetCardinality(output_idx);
+        return true;
+    }
 
-        // Process rows from current chunk
-        while (state.chunk_offset < state.current_chunk->size() && output_idx < STANDARD_VECTOR_SIZE) {
-            idx_t row = state.chunk_offset;
-            
-            // Get the matched value
-            Value matched_val;
-            if (matched_col_idx < state.current_chunk->ColumnCount()) {
-                matched_val = state.current_chunk->data[matched_col_idx].GetValue(row);
+private:
+    // Advance to the next chunk with rows, running the next column's query when the current
+    // one is exhausted; false once all columns are done
+    bool NextChunk() {
+        while (true) {
+            if (result) {
+                chunk = result->Fetch();
+                chunk_offset = 0;
+                if (chunk && chunk->size() > 0) {
+                    formats.resize(chunk->ColumnCount());
+                    for (idx_t col = 0; col < chunk->ColumnCount(); col++) {
+                        chunk->data[col].ToUnifiedFormat(chunk->size(), formats[col]);
+                    }
+                    return true;
+                }
+                result.reset();
+                column_idx++;
+            }
+            if (column_idx >= table->column_names.size()) {
+                return false;
+            }
+            // Search this column (fully qualified); a column whose query fails is skipped
+            string sql = "SELECT * FROM " + table->SqlName() + " WHERE LOWER(CAST(" +
+                         EscapeIdentifier(table->column_names[column_idx]) + " AS VARCHAR)) LIKE LOWER(?)";
+            // One statement per column: prepared on this thread's connection but not cached,
+            // its matches streamed
+            auto prepared = session.Conn().Prepare(sql);
+            if (prepared->HasError()) {
+                column_idx++;
+                continue;
+            }
+            vector<Value> params;
+            params.push_back(Value(bind_data.search_pattern));
+            result = prepared->Execute(params, true);
+            if (result->HasError()) {
+                result.reset();
+                column_idx++;
             }
-            
-            // Set output values
-            // schema_name
-            output.data[0].SetValue(output_idx, Value(state.current_schema_name));
-            // table_name
-            output.data[1].SetValue(output_idx, Value(state.current_table_name));
-            // column_name
-            output.data[2].SetValue(output_idx, Value(state.current_column_name));
-            // matched_value
-            output.data[3].SetValue(output_idx, Value(matched_val.ToString()));
-            // row_data (JSON)
-            string row_json = RowToJson(*state.current_chunk, row, columns);
-            output.data[4].SetValue(output_idx, Value(row_json));
-            
-            output_idx++;
-            state.chunk_offset++;
         }
     }
 
-    output.SetCardinality(output_idx);
+    const SearchDatabaseBindData &bind_data;
+    const CatalogTableInfo *table = nullptr;
+    idx_t column_idx = 0;
+    unique_ptr<QueryResult> result;
+    unique_ptr<DataChunk> chunk;
+    idx_t chunk_offset = 0;
+    // Unified formats of chunk and the reused row_data buffer
+    vector<UnifiedVectorFormat> formats;
+    string row_json;
+};
+
+static unique_ptr<GlobalTableFunctionState> SearchDatabaseInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<SearchDatabaseBindData>();
+    return make_uniq<ParallelTableDriver>(context, bind_data.tables, bind_data.options);
+}
+
+static unique_ptr<LocalTableFunctionState> SearchDatabaseInitLocal(ExecutionContext &context,
+                                                                   TableFunctionInitInput &input,
+                                                                   GlobalTableFunctionState *global_state) {
+    auto &bind_data = input.bind_data->Cast<SearchDatabaseBindData>();
+    return make_uniq<SearchDatabaseLocalState>(context.client, bind_data);
+}
+
+// Threads search whole tables in parallel; rows stay grouped per table
+static void SearchDatabaseFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+    auto &driver = data_p.global_state->Cast<ParallelTableDriver>();
+    driver.Scan(context, data_p.local_state->Cast<SearchDatabaseLocalState>(), output);
 }
 
 void RegisterSearchDatabaseFunction(ExtensionLoader& loader) {
@@ -318,8 +268,10 @@ void RegisterSearchDatabaseFunction(ExtensionLoader& loader) {
         {LogicalType::VARCHAR},
         SearchDatabaseFunction,
         SearchDatabaseBind,
-        SearchDatabaseInit
+        SearchDatabaseInit,
+        SearchDatabaseInitLocal
     );
+    ParallelTableDriver::AddNamedParameters(search_database_func);
 
     loader.RegisterFunction(search_database_func);
 }
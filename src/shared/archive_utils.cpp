@@ -1,4 +1,5 @@
 #include "archive_utils.hpp"
+#include "csv_sniffer.hpp"
 #include "duckdb/common/exception.hpp"
 #include <algorithm>
 #include <fstream>
@@ -74,19 +75,9 @@ std::string ExtractToTemp(const std::string &content, const std::string &origina
 }
 
 char DetectDelimiter(const std::string &content) {
-    size_t semicolon_count = std::count(content.begin(), content.end(), ';');
-    size_t comma_count = std::count(content.begin(), content.end(), ',');
-    size_t tab_count = std::count(content.begin(), content.end(), '\t');
-    size_t pipe_count = std::count(content.begin(), content.end(), '|');
-
-    if (semicolon_count >= comma_count && semicolon_count >= tab_count && semicolon_count >= pipe_count) {
-        return ';';
-    } else if (tab_count >= comma_count && tab_count >= pipe_count) {
-        return '\t';
-    } else if (pipe_count >= comma_count) {
-        return '|';
-    }
-    return ',';
+    // A bounded prefix is representative and keeps large bodies out of the cache
+    size_t sample = (std::min)(content.size(), CsvSniffOptions().sample_bytes);
+    return SniffDelimiter(content.data(), sample);
 }
 
 std::vector<std::string> SplitLine(const std::string &line, char delimiter) {
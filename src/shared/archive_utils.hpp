@@ -23,13 +23,14 @@ std::string GetTempDirectory();
 // Extract content to a temp file, returns the temp file path
 std::string ExtractToTemp(const std::string &content, const std::string &original_filename, const std::string &prefix);
 
-// Detect CSV delimiter from content
+// Detect CSV delimiter from the first 64KB of content
 char DetectDelimiter(const std::string &content);
 
 // Split a CSV line by delimiter (handles quoted fields)
 std::vector<std::string> SplitLine(const std::string &line, char delimiter);
 
-// Parse CSV content into column names, types, and rows
+// Parse CSV content into column names, types (all VARCHAR), and rows.
+// Materializes every row; readers that stream should use SniffCSV / CsvBodyReader.
 void ParseCSVContent(const std::string &content,
                      std::vector<std::string> &column_names,
                      std::vector<LogicalType> &column_types,
@@ -0,0 +1,142 @@
+#include "shared/catalog_helper.hpp"
+#include "shared/session_pool.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include <algorithm>
+
+namespace duckdb {
+namespace stps {
+
+string CatalogTableInfo::SqlName() const {
+    string result;
+    if (!catalog.empty()) {
+        result += KeywordHelper::WriteQuoted(catalog, '"') + ".";
+    }
+    if (!schema.empty()) {
+        result += KeywordHelper::WriteQuoted(schema, '"') + ".";
+    }
+    return result + KeywordHelper::WriteQuoted(name, '"');
+}
+
+static void FillFromEntry(TableCatalogEntry &table, CatalogTableInfo &result) {
+    result.catalog = table.ParentCatalog().GetName();
+    result.schema = table.ParentSchema().name;
+    result.name = table.name;
+    result.column_names.clear();
+    result.column_types.clear();
+    for (auto &column : table.GetColumns().Logical()) {
+        result.column_names.push_back(column.Name());
+        result.column_types.push_back(column.Type());
+    }
+    result.estimated_rows = -1;
+    if (table.IsDuckTable()) {
+        result.estimated_rows = static_cast<int64_t>(table.Cast<DuckTableEntry>().GetStorage().GetTotalRows());
+    }
+    result.from_catalog = true;
+}
+
+static optional_ptr<TableCatalogEntry> FindTable(ClientContext &context, const string &catalog, const string &schema,
+                                                 const string &name) {
+    try {
+        auto entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, catalog, schema, name,
+                                       OnEntryNotFound::RETURN_NULL);
+        if (!entry || entry->type != CatalogType::TABLE_ENTRY) {
+            return nullptr;  // Missing, or a view
+        }
+        return &entry->Cast<TableCatalogEntry>();
+    } catch (std::exception &) {
+        // Unknown catalog or schema
+        return nullptr;
+    }
+}
+
+bool LookupTable(ClientContext &context, const string &schema, const string &name, CatalogTableInfo &result) {
+    auto table = FindTable(context, INVALID_CATALOG, schema.empty() ? INVALID_SCHEMA : schema, name);
+    if (!table) {
+        return false;
+    }
+    FillFromEntry(*table, result);
+    return true;
+}
+
+bool DescribeRelation(ClientContext &context, const string &reference, CatalogTableInfo &result, string &error) {
+    try {
+        auto qualified = QualifiedName::Parse(reference);
+        auto table = FindTable(context, qualified.catalog, qualified.schema, qualified.name);
+        if (table) {
+            FillFromEntry(*table, result);
+            return true;
+        }
+    } catch (std::exception &) {
+        // Not a plain name (e.g. a file path or function call): let the planner resolve it
+    }
+
+    auto session = SessionPool::Acquire(context);
+    auto described = session.Query("SELECT * FROM " + reference + " LIMIT 0");
+    if (described->HasError()) {
+        error = described->GetError();
+        return false;
+    }
+    result = CatalogTableInfo();
+    result.name = reference;
+    result.column_names = described->names;
+    result.column_types = described->types;
+    return true;
+}
+
+vector<CatalogTableInfo> ListTables(ClientContext &context, const string &schema_filter) {
+    vector<CatalogTableInfo> tables;
+    for (auto &schema_ref : Catalog::GetAllSchemas(context)) {
+        auto &schema = schema_ref.get();
+        auto &catalog = schema.ParentCatalog();
+        if (catalog.IsSystemCatalog() || catalog.IsTemporaryCatalog()) {
+            continue;
+        }
+        if (!schema_filter.empty() && schema.name != schema_filter) {
+            continue;
+        }
+        // The table set also holds views
+        schema.Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+            if (entry.internal || entry.type != CatalogType::TABLE_ENTRY) {
+                return;
+            }
+            CatalogTableInfo info;
+            FillFromEntry(entry.Cast<TableCatalogEntry>(), info);
+            tables.push_back(std::move(info));
+        });
+    }
+    std::sort(tables.begin(), tables.end(), [](const CatalogTableInfo &a, const CatalogTableInfo &b) {
+        if (a.catalog != b.catalog) {
+            return a.catalog < b.catalog;
+        }
+        if (a.schema != b.schema) {
+            return a.schema < b.schema;
+        }
+        return a.name < b.name;
+    });
+    return tables;
+}
+
+unique_ptr<BaseStatistics> GetColumnStatistics(ClientContext &context, const CatalogTableInfo &table, idx_t column) {
+    if (!table.from_catalog || column >= table.column_names.size()) {
+        return nullptr;
+    }
+    auto entry = FindTable(context, table.catalog, table.schema, table.name);
+    if (!entry) {
+        return nullptr;
+    }
+    return entry->GetStatistics(context, column);
+}
+
+void InTransaction(Connection &conn, const std::function<void(ClientContext &)> &fun) {
+    auto &context = *conn.context;
+    context.RunFunctionInTransaction([&]() { fun(context); });
+}
+
+} // namespace stps
+} // namespace duckdb
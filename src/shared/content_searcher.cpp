@@ -2,8 +2,12 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/file_open_flags.hpp"
 #include <algorithm>
+#include <cctype>
 #include <vector>
 #include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace stps {
 namespace shared {
@@ -25,19 +29,7 @@ bool ContentSearcher::IsTextExtension(const std::string& extension) {
     return std::find(text_extensions.begin(), text_extensions.end(), ext_lower) != text_extensions.end();
 }
 
-bool ContentSearcher::IsBinaryFile(duckdb::FileSystem& fs, const std::string& file_path) {
-    // Check extension first (fast)
-    std::string ext = fs.ExtractExtension(file_path);
-
-    // If extension suggests text, return false
-    if (IsTextExtension(ext)) {
-        return false;
-    }
-
-    // Check for known binary extensions
-    std::string ext_lower = ext;
-    std::transform(ext_lower.begin(), ext_lower.end(), ext_lower.begin(), ::tolower);
-
+bool ContentSearcher::IsBinaryExtension(const std::string& extension) {
     static const std::vector<std::string> binary_extensions = {
         "jpg", "jpeg", "png", "gif", "bmp", "ico", "webp",
         "mp4", "avi", "mov", "mkv", "flv", "wmv", "webm",
@@ -48,88 +40,194 @@ bool ContentSearcher::IsBinaryFile(duckdb::FileSystem& fs, const std::string& fi
         "class", "jar", "war", "ear", "o", "a"
     };
 
-    if (std::find(binary_extensions.begin(), binary_extensions.end(), ext_lower) != binary_extensions.end()) {
-        return true;
-    }
+    std::string ext_lower = extension;
+    std::transform(ext_lower.begin(), ext_lower.end(), ext_lower.begin(), ::tolower);
 
-    // Read first 8KB to check for null bytes (indicates binary)
-    try {
-        auto handle = fs.OpenFile(file_path, duckdb::FileOpenFlags::FILE_FLAGS_READ);
-        char buffer[8192];
-        int64_t bytes_read = handle->Read(buffer, sizeof(buffer));
+    return std::find(binary_extensions.begin(), binary_extensions.end(), ext_lower) != binary_extensions.end();
+}
 
-        // Check for null bytes
-        for (int64_t i = 0; i < bytes_read; ++i) {
-            if (buffer[i] == '\0') {
-                return true;
-            }
+// Size of the sniffed prefix used for binary detection
+static constexpr size_t BINARY_SNIFF_SIZE = 8192;
+// Bytes read per block when streaming a file
+static constexpr size_t SEARCH_BLOCK_SIZE = 1024 * 1024;
+
+static bool HasNullByte(const char* data, size_t size) {
+    return std::memchr(data, '\0', std::min(size, BINARY_SNIFF_SIZE)) != nullptr;
+}
+
+ContentSearcher::ContentSearcher(std::vector<std::string> patterns_p, bool case_insensitive_p)
+    : case_insensitive(case_insensitive_p) {
+    for (auto& pattern : patterns_p) {
+        if (pattern.empty()) {
+            continue;
         }
-    } catch (...) {
-        return true; // Can't read, assume binary
+        if (case_insensitive) {
+            std::transform(pattern.begin(), pattern.end(), pattern.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        }
+        max_pattern_length = std::max(max_pattern_length, pattern.size());
+        patterns.push_back(std::move(pattern));
     }
-
-    return false;
 }
 
-bool ContentSearcher::BoyerMooreSearch(const char* text, size_t text_len, const std::string& pattern) {
-    if (pattern.empty() || text_len < pattern.size()) {
-        return false;
+// ASCII case folding; multi-byte UTF-8 sequences are left as they are
+static void FoldCase(char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (c >= 'A' && c <= 'Z') {
+            data[i] = static_cast<char>(c + ('a' - 'A'));
+        }
     }
+}
 
+// First occurrence of pattern in text[0, text_len), or text_len if there is none
+static size_t FindPattern(const char* text, size_t text_len, const std::string& pattern) {
     const size_t pattern_len = pattern.size();
-
-    // Build bad character table
-    int bad_char[256];
-    for (int i = 0; i < 256; ++i) {
-        bad_char[i] = -1;
+    if (text_len < pattern_len) {
+        return text_len;
     }
-    for (size_t i = 0; i < pattern_len; ++i) {
-        bad_char[static_cast<unsigned char>(pattern[i])] = static_cast<int>(i);
+    if (pattern_len == 1) {
+        auto hit = static_cast<const char*>(std::memchr(text, pattern[0], text_len));
+        return hit ? static_cast<size_t>(hit - text) : text_len;
     }
 
-    // Search
-    size_t shift = 0;
-    while (shift <= (text_len - pattern_len)) {
-        int j = static_cast<int>(pattern_len) - 1;
-
-        while (j >= 0 && pattern[j] == text[shift + j]) {
-            --j;
+    const char first = pattern[0];
+    const char last = pattern[pattern_len - 1];
+    const char* middle = pattern.data() + 1;
+    const size_t middle_len = pattern_len - 2;
+    const size_t last_start = text_len - pattern_len;  // Last valid candidate position
+    size_t i = 0;
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+    // Candidate positions have the first pattern byte at i and the last at i + len - 1;
+    // test 16 positions per iteration and memcmp only where both bytes agree
+    const __m128i first_vec = _mm_set1_epi8(first);
+    const __m128i last_vec = _mm_set1_epi8(last);
+    for (; i + 16 <= last_start + 1; i += 16) {
+        __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + pattern_len - 1));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(block_first, first_vec), _mm_cmpeq_epi8(block_last, last_vec))));
+        while (mask != 0) {
+            size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (std::memcmp(text + candidate + 1, middle, middle_len) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
         }
+    }
+#endif
 
-        if (j < 0) {
-            return true; // Pattern found
+    for (; i <= last_start; i++) {
+        if (text[i] == first && text[i + pattern_len - 1] == last &&
+            std::memcmp(text + i + 1, middle, middle_len) == 0) {
+            return i;
         }
+    }
+    return text_len;
+}
 
-        shift += std::max(1, j - bad_char[static_cast<unsigned char>(text[shift + j])]);
+bool ContentSearcher::FindFirst(const char* text, size_t text_len, size_t& position, size_t& pattern_index) const {
+    size_t best = text_len;
+    for (size_t p = 0; p < patterns.size(); p++) {
+        // Only the part before the current best can hold an earlier match
+        size_t limit = std::min(text_len, best + patterns[p].size() - 1);
+        size_t found = FindPattern(text, limit, patterns[p]);
+        if (found < best) {
+            best = found;
+            pattern_index = p;
+        }
     }
+    position = best;
+    return best < text_len;
+}
+
+static int64_t CountLines(const char* data, size_t size) {
+    return static_cast<int64_t>(std::count(data, data + size, '\n'));
+}
 
-    return false;
+bool ContentSearcher::SearchBuffer(const char* data, size_t size, ContentMatch& match) const {
+    if (patterns.empty()) {
+        match = ContentMatch {1, 0, 0};
+        return true;
+    }
+    std::string folded;
+    if (case_insensitive) {
+        folded.assign(data, size);
+        FoldCase(&folded[0], size);
+        data = folded.data();
+    }
+    size_t position;
+    size_t pattern_index = 0;
+    if (!FindFirst(data, size, position, pattern_index)) {
+        return false;
+    }
+    match.line = CountLines(data, position) + 1;
+    match.offset = static_cast<int64_t>(position);
+    match.pattern_index = pattern_index;
+    return true;
 }
 
-bool ContentSearcher::FileContainsText(duckdb::FileSystem& fs, const std::string& file_path, const std::string& search_text) {
-    if (search_text.empty()) {
+bool ContentSearcher::SearchFile(duckdb::FileSystem& fs, const std::string& file_path, ContentMatch& match) const {
+    if (patterns.empty()) {
+        match = ContentMatch {1, 0, 0};
         return true;
     }
 
+    std::string ext = fs.ExtractExtension(file_path);
+    const bool text_extension = IsTextExtension(ext);
+    if (!text_extension && IsBinaryExtension(ext)) {
+        return false;
+    }
+
+    // One buffer per walker thread, reused across files
+    thread_local std::vector<char> buffer;
+    const size_t carry_max = max_pattern_length - 1;
+    if (buffer.size() < SEARCH_BLOCK_SIZE + carry_max) {
+        buffer.resize(SEARCH_BLOCK_SIZE + carry_max);
+    }
+
     try {
-        // Check file size
         auto handle = fs.OpenFile(file_path, duckdb::FileOpenFlags::FILE_FLAGS_READ);
-        int64_t file_size = fs.GetFileSize(*handle);
 
-        if (file_size > MAX_SEARCH_SIZE) {
-            return false;
-        }
-
-        // Skip binary files
-        if (IsBinaryFile(fs, file_path)) {
-            return false;
-        }
+        size_t carry = 0;               // Bytes kept from the previous block at buffer[0]
+        int64_t buffer_offset = 0;      // File offset of buffer[0]
+        int64_t lines_before = 0;       // Newlines before buffer[0]
+        bool first_block = true;
+        while (true) {
+            int64_t bytes_read = handle->Read(buffer.data() + carry, SEARCH_BLOCK_SIZE);
+            if (bytes_read <= 0) {
+                return false;
+            }
+            char* block = buffer.data() + carry;
+            if (first_block) {
+                if (!text_extension && HasNullByte(block, static_cast<size_t>(bytes_read))) {
+                    return false;
+                }
+                first_block = false;
+            }
+            if (case_insensitive) {
+                FoldCase(block, static_cast<size_t>(bytes_read));
+            }
 
-        // Read file into memory
-        std::vector<char> buffer(file_size);
-        handle->Read(buffer.data(), file_size);
+            const size_t available = carry + static_cast<size_t>(bytes_read);
+            size_t position;
+            size_t pattern_index = 0;
+            if (FindFirst(buffer.data(), available, position, pattern_index)) {
+                match.line = lines_before + CountLines(buffer.data(), position) + 1;
+                match.offset = buffer_offset + static_cast<int64_t>(position);
+                match.pattern_index = pattern_index;
+                return true;
+            }
 
-        return BoyerMooreSearch(buffer.data(), file_size, search_text);
+            // Keep the tail so a match straddling the block boundary is still seen
+            size_t keep = std::min(available, carry_max);
+            size_t consumed = available - keep;
+            lines_before += CountLines(buffer.data(), consumed);
+            buffer_offset += static_cast<int64_t>(consumed);
+            std::memmove(buffer.data(), buffer.data() + consumed, keep);
+            carry = keep;
+        }
     } catch (...) {
         return false;
     }
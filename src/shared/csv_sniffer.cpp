@@ -0,0 +1,275 @@
+#include "csv_sniffer.hpp"
+#include "duckdb/common/exception.hpp"
+#include <algorithm>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace duckdb {
+namespace stps {
+
+std::vector<std::string> CsvSchema::ColumnNames() const {
+    std::vector<std::string> names;
+    for (auto &column : columns) {
+        names.push_back(column.name);
+    }
+    return names;
+}
+
+std::vector<LogicalType> CsvSchema::ColumnTypes() const {
+    std::vector<LogicalType> types;
+    for (auto &column : columns) {
+        types.push_back(column.type);
+    }
+    return types;
+}
+
+static const char DELIMITER_CANDIDATES[4] = {';', ',', '\t', '|'};
+
+char SniffDelimiter(const char *data, size_t size) {
+    size_t counts[4] = {0, 0, 0, 0};
+    size_t i = 0;
+#if defined(__SSE2__)
+    // One load per 16 bytes compared against all four candidates. Matches are accumulated
+    // in byte lanes and folded into the totals before a lane can overflow.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i needles[4];
+    for (int c = 0; c < 4; c++) {
+        needles[c] = _mm_set1_epi8(DELIMITER_CANDIDATES[c]);
+    }
+    while (i + 16 <= size) {
+        __m128i acc[4] = {zero, zero, zero, zero};
+        for (int rounds = 0; rounds < 255 && i + 16 <= size; rounds++, i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+            for (int c = 0; c < 4; c++) {
+                acc[c] = _mm_sub_epi8(acc[c], _mm_cmpeq_epi8(block, needles[c]));
+            }
+        }
+        for (int c = 0; c < 4; c++) {
+            __m128i sums = _mm_sad_epu8(acc[c], zero);
+            counts[c] += static_cast<size_t>(_mm_cvtsi128_si32(sums)) +
+                         static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        for (int c = 0; c < 4; c++) {
+            counts[c] += data[i] == DELIMITER_CANDIDATES[c];
+        }
+    }
+
+    size_t semicolon_count = counts[0], comma_count = counts[1], tab_count = counts[2], pipe_count = counts[3];
+    if (semicolon_count >= comma_count && semicolon_count >= tab_count && semicolon_count >= pipe_count) {
+        return ';';
+    } else if (tab_count >= comma_count && tab_count >= pipe_count) {
+        return '\t';
+    } else if (pipe_count >= comma_count) {
+        return '|';
+    }
+    return ',';
+}
+
+// Next line starting at position within [0, end): sets line_start/line_length (without
+// '\r\n') and advances position past the newline. Returns false at the end.
+static bool NextLine(const std::string &content, size_t end, size_t &position, size_t &line_start,
+                     size_t &line_length) {
+    while (position < end) {
+        line_start = position;
+        auto newline = static_cast<const char *>(std::memchr(content.data() + position, '\n', end - position));
+        size_t line_end = newline ? static_cast<size_t>(newline - content.data()) : end;
+        position = newline ? line_end + 1 : end;
+        if (line_end > line_start && content[line_end - 1] == '\r') {
+            line_end--;
+        }
+        line_length = line_end - line_start;
+        if (line_length > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Split one line, calling emit(column, field) per field; quotes toggle grouping and are dropped
+template <class EMIT>
+static void SplitFields(const char *line, size_t length, char delimiter, std::string &field, EMIT &&emit) {
+    field.clear();
+    bool in_quotes = false;
+    idx_t column = 0;
+    for (size_t i = 0; i < length; i++) {
+        char c = line[i];
+        if (c == '"') {
+            in_quotes = !in_quotes;
+        } else if (c == delimiter && !in_quotes) {
+            emit(column++, field);
+            field.clear();
+        } else {
+            field += c;
+        }
+    }
+    emit(column, field);
+}
+
+// Column type from the sample values (already trimmed, non-empty)
+static void InferColumn(CsvColumn &column, const std::vector<std::string> &values) {
+    if (values.empty()) {
+        return;
+    }
+    column.locale = SmartCastUtils::DetectLocale(values);
+    column.date_format = SmartCastUtils::DetectDateFormat(values);
+
+    DetectedType merged = DetectedType::UNKNOWN;
+    bool numeric_booleans = true;  // Only 0/1 seen as BOOLEAN: a numeric flag, not a boolean
+    for (auto &value : values) {
+        DetectedType type = SmartCastUtils::DetectType(value, column.locale, column.date_format);
+        if (type == DetectedType::BOOLEAN) {
+            numeric_booleans = numeric_booleans && (value == "0" || value == "1");
+            type = numeric_booleans ? DetectedType::INTEGER : DetectedType::BOOLEAN;
+            if (type == DetectedType::BOOLEAN && merged == DetectedType::INTEGER) {
+                merged = DetectedType::VARCHAR;
+                break;
+            }
+        }
+        if (merged == DetectedType::UNKNOWN || merged == type) {
+            merged = type;
+        } else if ((merged == DetectedType::INTEGER && type == DetectedType::DOUBLE) ||
+                   (merged == DetectedType::DOUBLE && type == DetectedType::INTEGER)) {
+            merged = DetectedType::DOUBLE;
+        } else {
+            merged = DetectedType::VARCHAR;
+            break;
+        }
+    }
+    // UUID / DECIMAL are left to explicit casts
+    if (merged != DetectedType::BOOLEAN && merged != DetectedType::INTEGER && merged != DetectedType::DOUBLE &&
+        merged != DetectedType::DATE && merged != DetectedType::TIMESTAMP) {
+        merged = DetectedType::VARCHAR;
+    }
+    column.detected_type = merged;
+    column.type = SmartCastUtils::ToLogicalType(merged);
+    if (merged == DetectedType::DATE || merged == DetectedType::TIMESTAMP) {
+        column.date_kernel = SmartCastUtils::SelectDateKernel(values, merged);
+    }
+}
+
+CsvSchema SniffCSV(const std::string &content, const CsvSniffOptions &options) {
+    CsvSchema schema;
+    if (content.empty()) {
+        return schema;
+    }
+
+    // Sample: whole lines within the first sample_bytes (at least the first line)
+    size_t sample_end = content.size();
+    if (sample_end > options.sample_bytes) {
+        auto last_newline = content.rfind('\n', options.sample_bytes);
+        sample_end = last_newline == std::string::npos ? content.find('\n') : last_newline + 1;
+        if (sample_end == std::string::npos) {
+            sample_end = content.size();
+        }
+    }
+    schema.delimiter = SniffDelimiter(content.data(), sample_end);
+
+    size_t position = 0, line_start = 0, line_length = 0;
+    if (!NextLine(content, content.size(), position, line_start, line_length)) {
+        return schema;
+    }
+    std::string field;
+    SplitFields(content.data() + line_start, line_length, schema.delimiter, field,
+                [&](idx_t, const std::string &name) {
+                    CsvColumn column;
+                    column.name = name;
+                    schema.columns.push_back(std::move(column));
+                });
+    schema.body_offset = position;
+    if (options.all_varchar) {
+        return schema;
+    }
+
+    std::vector<std::vector<std::string>> samples(schema.columns.size());
+    std::string processed;
+    size_t lines = 0;
+    while (lines < options.sample_lines && NextLine(content, sample_end, position, line_start, line_length)) {
+        lines++;
+        SplitFields(content.data() + line_start, line_length, schema.delimiter, field,
+                    [&](idx_t column, const std::string &value) {
+                        if (column < samples.size() && SmartCastUtils::Preprocess(value, processed)) {
+                            samples[column].push_back(processed);
+                        }
+                    });
+    }
+    for (idx_t i = 0; i < schema.columns.size(); i++) {
+        InferColumn(schema.columns[i], samples[i]);
+    }
+    return schema;
+}
+
+CsvBodyReader::CsvBodyReader(const std::string &content_p, const CsvSchema &schema_p)
+    : content(content_p), schema(schema_p), position(schema_p.body_offset) {
+}
+
+void CsvBodyReader::WriteField(DataChunk &output, idx_t column, idx_t row, const std::string &value) {
+    auto &plan = schema.columns[column];
+    auto &vec = output.data[column];
+    bool ok = false;
+    switch (plan.detected_type) {
+    case DetectedType::DATE:
+        ok = SmartCastUtils::ParseDateFast(plan.date_kernel, value.data(), value.size(), plan.date_format,
+                                           FlatVector::GetData<date_t>(vec)[row]);
+        break;
+    case DetectedType::TIMESTAMP:
+        ok = SmartCastUtils::ParseTimestampFast(plan.date_kernel, value.data(), value.size(), plan.date_format,
+                                                FlatVector::GetData<timestamp_t>(vec)[row]);
+        break;
+    case DetectedType::BOOLEAN:
+        ok = SmartCastUtils::Preprocess(value, processed) &&
+             SmartCastUtils::ParseBoolean(processed, FlatVector::GetData<bool>(vec)[row]);
+        break;
+    case DetectedType::INTEGER:
+        ok = SmartCastUtils::Preprocess(value, processed) &&
+             SmartCastUtils::ParseInteger(processed, plan.locale, FlatVector::GetData<int64_t>(vec)[row]);
+        break;
+    case DetectedType::DOUBLE:
+        ok = SmartCastUtils::Preprocess(value, processed) &&
+             SmartCastUtils::ParseDouble(processed, plan.locale, FlatVector::GetData<double>(vec)[row]);
+        break;
+    default:
+        FlatVector::GetData<string_t>(vec)[row] = StringVector::AddString(vec, value);
+        ok = true;
+        break;
+    }
+    if (!ok) {
+        if (SmartCastUtils::Preprocess(value, processed)) {
+            throw ConversionException("Could not convert '%s' in column \"%s\" (data row %llu) to %s; the type was "
+                                      "sniffed from the first rows, use all_varchar := true to read every column "
+                                      "as VARCHAR",
+                                      value, plan.name, rows_read + row + 1, plan.type.ToString());
+        }
+        FlatVector::SetNull(vec, row, true);
+    }
+}
+
+idx_t CsvBodyReader::Read(DataChunk &output) {
+    const idx_t column_count = schema.columns.size();
+    idx_t count = 0;
+    size_t line_start = 0, line_length = 0;
+    while (count < STANDARD_VECTOR_SIZE && NextLine(content, content.size(), position, line_start, line_length)) {
+        idx_t filled = 0;
+        SplitFields(content.data() + line_start, line_length, schema.delimiter, field,
+                    [&](idx_t column, const std::string &value) {
+                        if (column < column_count) {
+                            WriteField(output, column, count, value);
+                            filled = column + 1;
+                        }
+                    });
+        for (idx_t column = filled; column < column_count; column++) {
+            FlatVector::SetNull(output.data[column], count, true);
+        }
+        count++;
+    }
+    rows_read += count;
+    output.SetCardinality(count);
+    return count;
+}
+
+} // namespace stps
+} // namespace duckdb
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "duckdb/common/types/data_chunk.hpp"
+#include "smart_cast_utils.hpp"
+#include <string>
+#include <vector>
+
+namespace duckdb {
+namespace stps {
+
+// Bounds of the prefix the sniffer looks at
+struct CsvSniffOptions {
+    size_t sample_bytes = 64 * 1024;
+    size_t sample_lines = 1000;
+    // Keep every column VARCHAR (no type inference)
+    bool all_varchar = false;
+};
+
+// Per-column parse plan chosen from the sample
+struct CsvColumn {
+    std::string name;
+    LogicalType type = LogicalType::VARCHAR;
+    DetectedType detected_type = DetectedType::VARCHAR;
+    NumberLocale locale = NumberLocale::AUTO;
+    DateFormat date_format = DateFormat::AUTO;
+    DateKernel date_kernel = DateKernel::GENERIC;
+};
+
+// Result of SniffCSV: reusable for every read of the same content
+struct CsvSchema {
+    char delimiter = ',';
+    std::vector<CsvColumn> columns;
+    size_t body_offset = 0;  // Byte offset of the first data row
+
+    bool Empty() const {
+        return columns.empty();
+    }
+    std::vector<std::string> ColumnNames() const;
+    std::vector<LogicalType> ColumnTypes() const;
+};
+
+// Count the candidate delimiters (; , \t |) in one pass and pick the most frequent.
+// Ties prefer ';', then tab, then '|', then ','.
+char SniffDelimiter(const char *data, size_t size);
+
+// Detect delimiter, header and column types from a bounded prefix of content. Types come
+// from the SmartCastUtils detectors; a column is only typed if every non-empty sample
+// value agrees, otherwise it stays VARCHAR.
+CsvSchema SniffCSV(const std::string &content, const CsvSniffOptions &options = CsvSniffOptions());
+
+// Streams the data rows of content into typed DataChunks following a CsvSchema.
+// Lines are split on '\n' (a trailing '\r' is dropped), empty lines are skipped, and
+// double quotes group delimiters into one field. Missing and empty fields are NULL; a value
+// that does not convert to its column type (e.g. past the sniffed sample) throws a
+// ConversionException. content must outlive the reader.
+class CsvBodyReader {
+public:
+    CsvBodyReader(const std::string &content, const CsvSchema &schema);
+
+    // Fill up to STANDARD_VECTOR_SIZE rows into output (one vector per schema column);
+    // returns the number of rows written, 0 at the end
+    idx_t Read(DataChunk &output);
+
+private:
+    void WriteField(DataChunk &output, idx_t column, idx_t row, const std::string &field);
+
+    const std::string &content;
+    const CsvSchema &schema;
+    size_t position;
+    idx_t rows_read = 0;
+    std::string field;
+    std::string processed;
+};
+
+} // namespace stps
+} // namespace duckdb
@@ -0,0 +1,389 @@
+#include "shared/directory_walker.hpp"
+#include "duckdb/common/file_open_flags.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+#if defined(__linux__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace stps {
+namespace shared {
+
+#if defined(__linux__)
+// Record layout returned by getdents64 (not exported by glibc headers)
+struct LinuxDirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+#endif
+
+static bool IsLocalPath(const std::string& path) {
+    return path.find("://") == std::string::npos;
+}
+
+// Runs one walker worker on the scheduler
+class DirectoryWalkerTask : public duckdb::BaseExecutorTask {
+public:
+    DirectoryWalkerTask(duckdb::TaskExecutor& executor, DirectoryWalker& walker_p, size_t worker_id_p)
+        : BaseExecutorTask(executor), walker(walker_p), worker_id(worker_id_p) {}
+
+    void ExecuteTask() override {
+        walker.WorkerLoop(worker_id);
+    }
+
+private:
+    DirectoryWalker& walker;
+    size_t worker_id;
+};
+
+DirectoryWalker::DirectoryWalker(duckdb::ClientContext& context, duckdb::FileSystem& fs_p, std::string base_path_p,
+                                 WalkOptions options_p, EntryFilter filter_p)
+    : fs(fs_p), base_path(std::move(base_path_p)), options(options_p), filter(std::move(filter_p)) {
+#if defined(__linux__)
+    local_listing = IsLocalPath(base_path);
+#else
+    local_listing = false;
+#endif
+    if (options.threads == 0) {
+        options.threads = 1;
+    }
+    if (!options.recursive) {
+        // Only one directory to list
+        options.threads = 1;
+    }
+    Start(context);
+}
+
+DirectoryWalker::~DirectoryWalker() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopped = true;
+    }
+    work_available.notify_all();
+    output_space.notify_all();
+    try {
+        JoinWorkers();
+    } catch (...) {
+        // The walk was abandoned: nobody is left to report a worker's exception to
+    }
+}
+
+void DirectoryWalker::Start(duckdb::ClientContext& context) {
+    for (size_t i = 0; i < options.threads; i++) {
+        queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+    }
+    pending = 1;
+    queued = 1;
+    queues[CONSUMER]->directories.push_back(PendingDirectory {base_path, 0});
+
+    executor = duckdb::make_uniq<duckdb::TaskExecutor>(context);
+    for (size_t i = 0; i < options.threads; i++) {
+        if (i != CONSUMER) {
+            executor->ScheduleTask(duckdb::make_uniq<DirectoryWalkerTask>(*executor, *this, i));
+        }
+    }
+}
+
+void DirectoryWalker::WorkerLoop(size_t worker_id) {
+    try {
+        PendingDirectory directory;
+        while (!stopped) {
+            if (TakeDirectory(worker_id, directory)) {
+                ListDirectory(worker_id, directory);
+                FinishDirectory();
+                continue;
+            }
+            // Another worker is still listing and may push subdirectories
+            std::unique_lock<std::mutex> guard(lock);
+            work_available.wait(guard, [&]() { return stopped || pending == 0 || queued > 0; });
+            if (pending == 0) {
+                break;
+            }
+        }
+    } catch (...) {
+        WorkerFailed();
+        throw;
+    }
+}
+
+void DirectoryWalker::WorkerFailed() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopped = true;
+        failed = true;
+    }
+    work_available.notify_all();
+    output_space.notify_all();
+    output_ready.notify_all();
+}
+
+void DirectoryWalker::JoinWorkers() {
+    if (!executor) {
+        return;
+    }
+    // Tasks no scheduler thread picked up run (and return at once) on this thread
+    auto finished = std::move(executor);
+    finished->WorkOnTasks();
+}
+
+bool DirectoryWalker::TakeDirectory(size_t worker_id, PendingDirectory& out) {
+    // Own queue: newest first (depth-first)
+    {
+        auto& own = *queues[worker_id];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.directories.empty()) {
+            out = std::move(own.directories.back());
+            own.directories.pop_back();
+            queued--;
+            return true;
+        }
+    }
+    // Steal the oldest (usually largest remaining subtree) from another worker
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        auto& victim = *queues[(worker_id + offset) % queues.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.directories.empty()) {
+            out = std::move(victim.directories.front());
+            victim.directories.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DirectoryWalker::PushDirectory(size_t worker_id, PendingDirectory directory) {
+    pending++;
+    {
+        auto& own = *queues[worker_id];
+        std::lock_guard<std::mutex> guard(own.lock);
+        own.directories.push_back(std::move(directory));
+        queued++;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+    }
+    work_available.notify_one();
+    output_ready.notify_one();
+}
+
+void DirectoryWalker::FinishDirectory() {
+    if (--pending == 0) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+        }
+        work_available.notify_all();
+        output_ready.notify_all();
+    }
+}
+
+bool DirectoryWalker::Emit(WalkEntry&& entry, bool wait) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (wait) {
+        output_space.wait(guard, [&]() { return stopped || output.size() < options.queue_capacity; });
+    }
+    if (stopped) {
+        return false;
+    }
+    output.push_back(std::move(entry));
+    output_ready.notify_one();
+    return true;
+}
+
+void DirectoryWalker::HandleEntry(size_t worker_id, const PendingDirectory& directory, WalkEntry&& entry) {
+    // Same depth rule as the former recursive scanners: a directory at depth d + 1 is only
+    // listed while d + 1 <= max_depth
+    bool descend = entry.is_directory && options.recursive &&
+                   (options.max_depth < 0 || directory.depth + 1 <= options.max_depth);
+    std::string child_path;
+    if (descend) {
+        child_path = entry.path;
+    }
+    if (options.need_stat && !entry.has_stat) {
+        Stat(fs, entry);
+    }
+    if (filter(entry)) {
+        Emit(std::move(entry), worker_id != CONSUMER);
+    }
+    if (descend) {
+        PushDirectory(worker_id, PendingDirectory {std::move(child_path), directory.depth + 1});
+    }
+}
+
+void DirectoryWalker::ListDirectory(size_t worker_id, const PendingDirectory& directory) {
+#if defined(__linux__)
+    if (local_listing) {
+        int fd = open(directory.path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) {
+            ListingFailed(directory, std::strerror(errno));
+            return;
+        }
+        alignas(8) char buffer[65536];
+        while (!stopped) {
+            long bytes = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+            if (bytes < 0) {
+                ListingFailed(directory, std::strerror(errno));
+                break;
+            }
+            if (bytes == 0) {
+                break;
+            }
+            for (long offset = 0; offset < bytes && !stopped;) {
+                auto record = reinterpret_cast<LinuxDirent64*>(buffer + offset);
+                offset += record->d_reclen;
+                const char* name = record->d_name;
+                if (std::strcmp(name, ".") == 0 || std::strcmp(name, "..") == 0) {
+                    continue;
+                }
+
+                bool is_dir = record->d_type == DT_DIR;
+                bool is_file = record->d_type == DT_REG;
+                struct stat st;
+                bool have_stat = false;
+                bool stat_failed = false;
+                // Symlinks are followed and unknown types resolved, like FileSystem::ListFiles
+                if (record->d_type == DT_UNKNOWN || record->d_type == DT_LNK) {
+                    if (fstatat(fd, name, &st, 0) != 0) {
+                        continue;
+                    }
+                    have_stat = true;
+                    is_dir = S_ISDIR(st.st_mode);
+                    is_file = S_ISREG(st.st_mode);
+                } else if (options.need_stat && (is_dir || is_file)) {
+                    // The type is known from the listing: keep the entry even if the stat fails
+                    have_stat = fstatat(fd, name, &st, 0) == 0;
+                    stat_failed = !have_stat;
+                }
+                if (!is_dir && !is_file) {
+                    continue;
+                }
+
+                WalkEntry entry;
+                entry.name = name;
+                entry.path = fs.JoinPath(directory.path, entry.name);
+                entry.is_directory = is_dir;
+                entry.depth = directory.depth;
+                entry.has_stat = have_stat || stat_failed;
+                entry.stat_failed = stat_failed;
+                if (have_stat) {
+                    entry.size = is_dir ? 0 : static_cast<int64_t>(st.st_size);
+                    entry.modified_time = static_cast<int64_t>(st.st_mtime);
+                }
+                HandleEntry(worker_id, directory, std::move(entry));
+            }
+        }
+        close(fd);
+        return;
+    }
+#endif
+    try {
+        fs.ListFiles(directory.path, [&](const std::string& entry_name, bool is_dir) {
+            if (stopped) {
+                return;
+            }
+            WalkEntry entry;
+            entry.name = entry_name;
+            entry.path = fs.JoinPath(directory.path, entry_name);
+            entry.is_directory = is_dir;
+            entry.depth = directory.depth;
+            HandleEntry(worker_id, directory, std::move(entry));
+        });
+    } catch (const std::exception& e) {
+        ListingFailed(directory, e.what());
+    }
+}
+
+void DirectoryWalker::ListingFailed(const PendingDirectory& directory, const std::string& message) {
+    // Subdirectories we can't access (permission denied, etc.) are skipped, as before
+    if (directory.depth > 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    error = "Error scanning directory " + directory.path + ": " + message;
+    output_ready.notify_all();
+}
+
+bool DirectoryWalker::Next(std::vector<WalkEntry>& out, size_t max_rows) {
+    PendingDirectory directory;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            output_ready.wait(guard, [&]() {
+                return !output.empty() || pending == 0 || queued > 0 || failed || !error.empty();
+            });
+            if (failed) {
+                guard.unlock();
+                JoinWorkers();
+                throw std::runtime_error("directory walk failed");
+            }
+            if (!error.empty()) {
+                throw std::runtime_error(error);
+            }
+            if (!output.empty()) {
+                size_t take = std::min(max_rows, output.size());
+                for (size_t i = 0; i < take; i++) {
+                    out.push_back(std::move(output.front()));
+                    output.pop_front();
+                }
+                output_space.notify_all();
+                return true;
+            }
+            if (pending == 0) {
+                guard.unlock();
+                JoinWorkers();
+                return false;
+            }
+        }
+        // No rows yet: list a directory here instead of waiting for a worker
+        if (TakeDirectory(CONSUMER, directory)) {
+            try {
+                ListDirectory(CONSUMER, directory);
+            } catch (...) {
+                WorkerFailed();
+                throw;
+            }
+            FinishDirectory();
+        }
+    }
+}
+
+void DirectoryWalker::Stat(duckdb::FileSystem& fs, WalkEntry& entry) {
+    entry.has_stat = true;
+#ifndef _WIN32
+    if (IsLocalPath(entry.path)) {
+        // One stat instead of opening the file for its size and again for its mtime
+        struct stat st;
+        if (stat(entry.path.c_str(), &st) == 0) {
+            entry.size = entry.is_directory ? 0 : static_cast<int64_t>(st.st_size);
+            entry.modified_time = static_cast<int64_t>(st.st_mtime);
+        } else {
+            entry.stat_failed = true;
+        }
+        return;
+    }
+#endif
+    try {
+        auto handle = fs.OpenFile(entry.path, duckdb::FileOpenFlags::FILE_FLAGS_READ);
+        if (!entry.is_directory) {
+            entry.size = fs.GetFileSize(*handle);
+        }
+        // DuckDB timestamps are microseconds since the epoch
+        entry.modified_time = fs.GetLastModifiedTime(*handle).value / 1000000;
+    } catch (...) {
+        entry.stat_failed = true;
+    }
+}
+
+} // namespace shared
+} // namespace stps
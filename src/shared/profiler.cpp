@@ -0,0 +1,203 @@
+#include "shared/profiler.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+namespace stps {
+namespace shared {
+
+namespace {
+
+struct StageStats {
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = UINT64_MAX;
+    uint64_t max_ns = 0;
+    uint64_t bytes = 0;
+    uint64_t rows = 0;
+    std::array<uint64_t, Profiler::HISTOGRAM_BUCKETS> histogram {};
+};
+
+struct TraceEvent {
+    const char* stage;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+};
+
+size_t HistogramBucket(uint64_t duration_ns) {
+    uint64_t micros = duration_ns / 1000;
+    size_t bucket = 0;
+    while (micros > 0 && bucket + 1 < Profiler::HISTOGRAM_BUCKETS) {
+        micros >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+const std::chrono::steady_clock::time_point& ProfilerEpoch() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+} // namespace
+
+// Stats are keyed by the stage literal's address (no string hashing while recording) and
+// merged by name in Snapshot(), since the same name may have several addresses
+struct Profiler::ThreadBuffer {
+    std::mutex lock;
+    uint32_t thread_id = 0;
+    std::unordered_map<const char*, StageStats> stages;
+    std::vector<TraceEvent> events;
+};
+
+Profiler::Profiler() {
+    ProfilerEpoch();
+}
+
+Profiler& Profiler::Instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::NowNs() const {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ProfilerEpoch())
+            .count());
+}
+
+Profiler::ThreadBuffer& Profiler::Local() {
+    static thread_local std::shared_ptr<ThreadBuffer> local;
+    if (!local) {
+        local = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> guard(lock);
+        local->thread_id = ++next_thread_id;
+        buffers.push_back(local);
+    }
+    return *local;
+}
+
+void Profiler::Record(const char* stage, uint64_t start_ns, uint64_t duration_ns, uint64_t bytes, uint64_t rows) {
+    auto& buffer = Local();
+    std::lock_guard<std::mutex> guard(buffer.lock);
+    auto& stats = buffer.stages[stage];
+    stats.calls++;
+    stats.total_ns += duration_ns;
+    stats.min_ns = std::min(stats.min_ns, duration_ns);
+    stats.max_ns = std::max(stats.max_ns, duration_ns);
+    stats.bytes += bytes;
+    stats.rows += rows;
+    stats.histogram[HistogramBucket(duration_ns)]++;
+    if (Tracing() && buffer.events.size() < MAX_TRACE_EVENTS) {
+        buffer.events.push_back(TraceEvent {stage, start_ns, duration_ns});
+    }
+}
+
+std::vector<StageProfile> Profiler::Snapshot() {
+    std::map<std::string, StageStats> merged;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& buffer : buffers) {
+            std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+            for (auto& entry : buffer->stages) {
+                auto& target = merged[entry.first];
+                auto& source = entry.second;
+                target.calls += source.calls;
+                target.total_ns += source.total_ns;
+                target.min_ns = std::min(target.min_ns, source.min_ns);
+                target.max_ns = std::max(target.max_ns, source.max_ns);
+                target.bytes += source.bytes;
+                target.rows += source.rows;
+                for (size_t b = 0; b < HISTOGRAM_BUCKETS; b++) {
+                    target.histogram[b] += source.histogram[b];
+                }
+            }
+        }
+    }
+
+    std::vector<StageProfile> result;
+    for (auto& entry : merged) {
+        StageProfile profile;
+        profile.stage = entry.first;
+        profile.calls = entry.second.calls;
+        profile.total_ns = entry.second.total_ns;
+        profile.min_ns = entry.second.calls > 0 ? entry.second.min_ns : 0;
+        profile.max_ns = entry.second.max_ns;
+        profile.bytes = entry.second.bytes;
+        profile.rows = entry.second.rows;
+        // Trailing empty buckets are left out
+        size_t used = HISTOGRAM_BUCKETS;
+        while (used > 0 && entry.second.histogram[used - 1] == 0) {
+            used--;
+        }
+        profile.histogram.assign(entry.second.histogram.begin(), entry.second.histogram.begin() + used);
+        result.push_back(std::move(profile));
+    }
+    return result;
+}
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> guard(lock);
+    // Buffers of threads that have exited are only referenced from here: drop them
+    buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                                 [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer.use_count() == 1; }),
+                  buffers.end());
+    for (auto& buffer : buffers) {
+        std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+        buffer->stages.clear();
+        buffer->events.clear();
+    }
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        return false;
+    }
+    size_t written = 0;
+    char line[128];
+    out << "{\"traceEvents\":[";
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& buffer : buffers) {
+            std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+            for (auto& event : buffer->events) {
+                // Stage names are literals like "gobd.import.load": no JSON escaping needed
+                out << (written > 0 ? ",\n" : "\n") << "{\"name\":\"" << event.stage << "\",\"cat\":\"stps\",\"ph\":\"X\"";
+                std::snprintf(line, sizeof(line), ",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                              event.start_ns / 1000.0, event.duration_ns / 1000.0, buffer->thread_id);
+                out << line;
+                written++;
+            }
+        }
+    }
+    out << "\n]}\n";
+    out.close();
+    return !out.fail();
+}
+
+ScopedTimer::ScopedTimer(const char* stage_p)
+    : stage(stage_p), start_ns(0), active(Profiler::Instance().Enabled()) {
+    if (active) {
+        start_ns = Profiler::Instance().NowNs();
+    }
+}
+
+ScopedTimer::~ScopedTimer() {
+    Stop();
+}
+
+void ScopedTimer::Stop() {
+    if (!active) {
+        return;
+    }
+    active = false;
+    auto& profiler = Profiler::Instance();
+    profiler.Record(stage, start_ns, profiler.NowNs() - start_ns, bytes, rows);
+}
+
+} // namespace shared
+} // namespace stps
@@ -0,0 +1,77 @@
+#include "shared/schema_union.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+
+namespace duckdb {
+namespace stps {
+
+idx_t SchemaUnionPlan::AddSource(const vector<string> &source_names, const vector<LogicalType> &source_types) {
+    D_ASSERT(source_names.size() == source_types.size());
+    Source source;
+    source.types = source_types;
+    for (idx_t i = 0; i < source_names.size(); i++) {
+        auto it = name_index.find(source_names[i]);
+        if (it == name_index.end()) {
+            name_index[source_names[i]] = names.size();
+            source.columns[names.size()] = i;
+            names.push_back(source_names[i]);
+            types.push_back(source_types[i]);
+            continue;
+        }
+        // A name repeated within one source keeps its first column
+        if (source.columns.count(it->second)) {
+            continue;
+        }
+        source.columns[it->second] = i;
+        auto &existing_type = types[it->second];
+        if (existing_type != source_types[i]) {
+            existing_type = LogicalType::ForceMaxLogicalType(existing_type, source_types[i]);
+        }
+    }
+    sources.push_back(std::move(source));
+    return sources.size() - 1;
+}
+
+vector<idx_t> SchemaUnionPlan::Mapping(idx_t source) const {
+    vector<idx_t> result(names.size(), DConstants::INVALID_INDEX);
+    for (auto &column : sources[source].columns) {
+        result[column.first] = column.second;
+    }
+    return result;
+}
+
+string SchemaUnionPlan::ColumnDefinitions() const {
+    string result;
+    for (idx_t i = 0; i < names.size(); i++) {
+        if (i > 0) {
+            result += ", ";
+        }
+        result += KeywordHelper::WriteQuoted(names[i], '"') + " " + types[i].ToString();
+    }
+    return result;
+}
+
+string SchemaUnionPlan::SelectList(idx_t source, const vector<string> &source_columns, bool try_cast) const {
+    auto &src = sources[source];
+    auto mapping = Mapping(source);
+    string result;
+    for (idx_t i = 0; i < names.size(); i++) {
+        if (i > 0) {
+            result += ", ";
+        }
+        auto column = mapping[i];
+        if (column == DConstants::INVALID_INDEX) {
+            result += "CAST(NULL AS " + types[i].ToString() + ")";
+            continue;
+        }
+        auto reference = KeywordHelper::WriteQuoted(source_columns[column], '"');
+        if (src.types[column] == types[i]) {
+            result += reference;
+        } else {
+            result += string(try_cast ? "TRY_CAST(" : "CAST(") + reference + " AS " + types[i].ToString() + ")";
+        }
+    }
+    return result;
+}
+
+} // namespace stps
+} // namespace duckdb
@@ -0,0 +1,81 @@
+#include "shared/session_pool.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+
+namespace duckdb {
+namespace stps {
+
+SessionLease::SessionLease(shared_ptr<SessionPool> pool_p, unique_ptr<InternalSession> session_p)
+    : pool(std::move(pool_p)), session(std::move(session_p)) {
+}
+
+SessionLease::~SessionLease() {
+    if (pool && session) {
+        pool->Release(std::move(session));
+    }
+}
+
+unique_ptr<MaterializedQueryResult> SessionLease::Execute(const string &sql, vector<Value> params) {
+    auto &statements = session->statements;
+    auto entry = statements.find(sql);
+    if (entry == statements.end()) {
+        auto prepared = session->conn.Prepare(sql);
+        if (prepared->HasError()) {
+            // Not cached: the statement may become valid later (e.g. once its table exists)
+            return make_uniq<MaterializedQueryResult>(prepared->GetErrorObject());
+        }
+        if (statements.size() >= SessionPool::MAX_CACHED_STATEMENTS) {
+            statements.clear();
+        }
+        entry = statements.emplace(sql, std::move(prepared)).first;
+    }
+    auto result = entry->second->Execute(params, false);
+    if (result->HasError()) {
+        statements.erase(entry);
+        if (result->type != QueryResultType::MATERIALIZED_RESULT) {
+            return make_uniq<MaterializedQueryResult>(result->GetErrorObject());
+        }
+    }
+    return unique_ptr_cast<QueryResult, MaterializedQueryResult>(std::move(result));
+}
+
+SessionPool::SessionPool(DatabaseInstance &db_p) : db(db_p) {
+}
+
+shared_ptr<SessionPool> SessionPool::Get(ClientContext &context) {
+    return context.registered_state->GetOrCreate<SessionPool>("stps_session_pool", *context.db);
+}
+
+SessionLease SessionPool::Acquire(ClientContext &context) {
+    auto pool = Get(context);
+    unique_ptr<InternalSession> session;
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+        if (!pool->idle.empty()) {
+            session = std::move(pool->idle.back());
+            pool->idle.pop_back();
+        }
+    }
+    if (!session) {
+        session = make_uniq<InternalSession>(pool->db);
+    }
+    return SessionLease(std::move(pool), std::move(session));
+}
+
+void SessionPool::Release(unique_ptr<InternalSession> session) {
+    // A transaction left open (e.g. by an exception between BEGIN and COMMIT) must not
+    // leak into the next lease
+    if (session->conn.HasActiveTransaction()) {
+        try {
+            session->conn.Rollback();
+        } catch (std::exception &) {
+            return;
+        }
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    if (idle.size() < MAX_IDLE_SESSIONS) {
+        idle.push_back(std::move(session));
+    }
+}
+
+} // namespace stps
+} // namespace duckdb
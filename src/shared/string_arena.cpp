@@ -0,0 +1,141 @@
+#include "shared/string_arena.hpp"
+#include "shared/profiler.hpp"
+#include <atomic>
+#include <cstring>
+
+namespace stps {
+namespace shared {
+
+// Bumped by ReleaseAll(); every arena compares it in Reset()
+static std::atomic<uint64_t> release_generation {0};
+
+StringArena::StringArena(size_t block_size_p) : block_size(block_size_p) {
+}
+
+char* StringArena::Allocate(size_t size) {
+    if (size == 0) {
+        size = 1;
+    }
+    while (current < blocks.size()) {
+        auto& block = blocks[current];
+        if (block.size - used >= size) {
+            char* result = block.data.get() + used;
+            used += size;
+            return result;
+        }
+        // Block is full (or too small for this request): move on to the next kept block
+        current++;
+        used = 0;
+    }
+    Block block;
+    block.size = size > block_size ? size : block_size;
+    block.data.reset(new char[block.size]);
+    block_allocations++;
+    // Every heap allocation of the arenas shows up as a call of stage "arena.block"
+    auto& profiler = Profiler::Instance();
+    if (profiler.Enabled()) {
+        profiler.Record("arena.block", profiler.NowNs(), 0, block.size, 0);
+    }
+    blocks.push_back(std::move(block));
+    current = blocks.size() - 1;
+    used = size;
+    return blocks.back().data.get();
+}
+
+duckdb::string_t StringArena::Copy(const char* data, size_t size) {
+    char* target = Allocate(size);
+    std::memcpy(target, data, size);
+    return duckdb::string_t(target, static_cast<uint32_t>(size));
+}
+
+void StringArena::Reset() {
+    current = 0;
+    used = 0;
+    auto released = release_generation.load(std::memory_order_relaxed);
+    if (generation != released) {
+        blocks.clear();
+        generation = released;
+    }
+}
+
+void StringArena::ReleaseAll() {
+    release_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+StringArena& StringArena::ThreadLocal() {
+    static thread_local StringArena arena;
+    return arena;
+}
+
+LineCursor::LineCursor(const char* data_p, size_t size_p, size_t position_p)
+    : data(data_p), size(size_p), position(position_p) {
+}
+
+bool LineCursor::Next(const char*& line, size_t& length) {
+    while (position < size) {
+        size_t line_start = position;
+        auto newline = static_cast<const char*>(std::memchr(data + position, '\n', size - position));
+        size_t line_end = newline ? static_cast<size_t>(newline - data) : size;
+        position = newline ? line_end + 1 : size;
+        if (line_end > line_start && data[line_end - 1] == '\r') {
+            line_end--;
+        }
+        if (line_end > line_start) {
+            line = data + line_start;
+            length = line_end - line_start;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Unescape a field that contains quotes; the field never starts inside quotes because
+// delimiters only split outside them
+static duckdb::string_t UnquoteField(const char* field, size_t length, char quote, StringArena& arena) {
+    char* target = arena.Allocate(length);
+    size_t out = 0;
+    bool in_quotes = false;
+    for (size_t i = 0; i < length; i++) {
+        char c = field[i];
+        if (c == quote) {
+            if (in_quotes && i + 1 < length && field[i + 1] == quote) {
+                target[out++] = quote;
+                i++;
+            } else {
+                in_quotes = !in_quotes;
+            }
+        } else {
+            target[out++] = c;
+        }
+    }
+    return duckdb::string_t(target, static_cast<uint32_t>(out));
+}
+
+void SplitCsvLine(const char* line, size_t length, char delimiter, StringArena& arena,
+                  std::vector<duckdb::string_t>& fields, char quote) {
+    fields.clear();
+    size_t field_start = 0;
+    bool in_quotes = false;
+    bool has_quotes = false;
+    for (size_t i = 0; i < length; i++) {
+        char c = line[i];
+        if (c == quote && quote != '\0') {
+            has_quotes = true;
+            if (in_quotes && i + 1 < length && line[i + 1] == quote) {
+                i++;
+            } else {
+                in_quotes = !in_quotes;
+            }
+        } else if (c == delimiter && !in_quotes) {
+            fields.push_back(has_quotes ? UnquoteField(line + field_start, i - field_start, quote, arena)
+                                        : duckdb::string_t(line + field_start, static_cast<uint32_t>(i - field_start)));
+            field_start = i + 1;
+            has_quotes = false;
+        }
+    }
+    fields.push_back(has_quotes ? UnquoteField(line + field_start, length - field_start, quote, arena)
+                                : duckdb::string_t(line + field_start, static_cast<uint32_t>(length - field_start)));
+}
+
+} // namespace shared
+} // namespace stps
@@ -0,0 +1,116 @@
+#include "shared/table_driver.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace duckdb {
+namespace stps {
+
+TableDriverLocalState::TableDriverLocalState(ClientContext &context) : session(SessionPool::Acquire(context)) {
+}
+
+ParallelTableDriver::ParallelTableDriver(ClientContext &context, const vector<CatalogTableInfo> &tables_p,
+                                         TableDriverOptions options)
+    : tables(tables_p) {
+    work.resize(tables.size());
+    std::iota(work.begin(), work.end(), 0);
+    if (!options.preserve_order) {
+        // Largest first: the long tables start early instead of finishing last on one thread
+        std::stable_sort(work.begin(), work.end(), [&](idx_t a, idx_t b) {
+            return tables[a].estimated_rows > tables[b].estimated_rows;
+        });
+    }
+    for (auto index : work) {
+        total_weight += static_cast<idx_t>(MaxValue<int64_t>(tables[index].estimated_rows, 0)) + 1;
+    }
+
+    idx_t threads = options.threads;
+    if (threads == 0) {
+        threads = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+    }
+    max_threads = MaxValue<idx_t>(1, MinValue<idx_t>(threads, tables.size()));
+}
+
+bool ParallelTableDriver::Claim(TableDriverLocalState &local) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (next_work >= work.size()) {
+        return false;
+    }
+    local.work_index = next_work++;
+    local.active = true;
+    return true;
+}
+
+void ParallelTableDriver::Finish(TableDriverLocalState &local) {
+    auto &table = tables[work[local.work_index]];
+    finished_weight += static_cast<idx_t>(MaxValue<int64_t>(table.estimated_rows, 0)) + 1;
+    local.active = false;
+}
+
+void ParallelTableDriver::Scan(ClientContext &context, TableDriverLocalState &local, DataChunk &output) {
+    output.SetCardinality(0);
+    while (true) {
+        if (!local.active) {
+            if (!Claim(local)) {
+                return;
+            }
+            local.BeginTable(context, tables[work[local.work_index]]);
+        }
+        bool more = local.NextRows(context, output);
+        if (!more) {
+            Finish(local);
+        }
+        // The batch index stays that of this chunk's table until the next claim
+        if (output.size() > 0) {
+            return;
+        }
+    }
+}
+
+double ParallelTableDriver::Progress() const {
+    if (total_weight == 0) {
+        return 100.0;
+    }
+    return 100.0 * static_cast<double>(finished_weight.load()) / static_cast<double>(total_weight);
+}
+
+void ParallelTableDriver::AddNamedParameters(TableFunction &function) {
+    function.named_parameters["threads"] = LogicalType::BIGINT;
+    function.named_parameters["preserve_order"] = LogicalType::BOOLEAN;
+    function.get_partition_data = GetPartitionData;
+    function.table_scan_progress = ScanProgress;
+}
+
+TableDriverOptions ParallelTableDriver::ParseOptions(const named_parameter_map_t &parameters,
+                                                     const string &function_name) {
+    TableDriverOptions options;
+    for (auto &kv : parameters) {
+        if (kv.first == "threads") {
+            auto threads = kv.second.GetValue<int64_t>();
+            if (threads < 1) {
+                throw BinderException("%s: threads must be at least 1", function_name);
+            }
+            options.threads = static_cast<idx_t>(threads);
+        } else if (kv.first == "preserve_order") {
+            options.preserve_order = kv.second.GetValue<bool>();
+        }
+    }
+    return options;
+}
+
+OperatorPartitionData ParallelTableDriver::GetPartitionData(ClientContext &context,
+                                                            TableFunctionGetPartitionInput &input) {
+    if (input.partition_info.RequiresPartitionColumns()) {
+        throw InternalException("ParallelTableDriver: partition columns are not supported");
+    }
+    auto &local = input.local_state->Cast<TableDriverLocalState>();
+    return OperatorPartitionData(local.work_index);
+}
+
+double ParallelTableDriver::ScanProgress(ClientContext &context, const FunctionData *bind_data,
+                                         const GlobalTableFunctionState *global_state) {
+    return global_state->Cast<ParallelTableDriver>().Progress();
+}
+
+} // namespace stps
+} // namespace duckdb
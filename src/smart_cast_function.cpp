@@ -3,6 +3,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include <map>
 #include <chrono>
 #include <random>
@@ -52,23 +54,24 @@ static unique_ptr<FunctionData> SmartCastAnalyzeBind(ClientContext &context, Tab
     }
 
     // Get table schema
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
     // Escape identifier to prevent SQL injection
     string escaped_table;
     for (char c : result->table_name) {
         if (c == '"') escaped_table += "\"\"";
         else escaped_table += c;
     }
-    auto schema_result = conn.Query("SELECT * FROM \"" + escaped_table + "\" LIMIT 0");
-    if (schema_result->HasError()) {
-        throw BinderException("Table '%s' does not exist: %s", result->table_name, schema_result->GetError());
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, "\"" + escaped_table + "\"", table, error)) {
+        throw BinderException("Table '%s' does not exist: %s", result->table_name, error);
     }
 
     // Analyze each column
-    for (idx_t col = 0; col < schema_result->names.size(); col++) {
+    for (idx_t col = 0; col < table.column_names.size(); col++) {
         ColumnAnalysis analysis;
-        analysis.column_name = schema_result->names[col];
-        analysis.original_type = schema_result->types[col];
+        analysis.column_name = table.column_names[col];
+        analysis.original_type = table.column_types[col];
 
         // Only analyze VARCHAR columns
         if (analysis.original_type != LogicalType::VARCHAR) {
@@ -86,7 +89,7 @@ static unique_ptr<FunctionData> SmartCastAnalyzeBind(ClientContext &context, Tab
 
         // Get all values for this column
         auto query = "SELECT \"" + analysis.column_name + "\" FROM " + result->table_name;
-        auto col_result = conn.Query(query);
+        auto col_result = session.Query(query);
         if (col_result->HasError()) {
             throw BinderException("Failed to query column: %s", col_result->GetError());
         }
@@ -193,6 +196,7 @@ static void SmartCastAnalyzeScan(ClientContext &context, TableFunctionInput &dat
             case DetectedType::BOOLEAN: type_str = "BOOLEAN"; break;
             case DetectedType::INTEGER: type_str = "INTEGER"; break;
             case DetectedType::DOUBLE: type_str = "DOUBLE"; break;
+            case DetectedType::DECIMAL: type_str = "DECIMAL(18,2)"; break;
             case DetectedType::DATE: type_str = "DATE"; break;
             case DetectedType::TIMESTAMP: type_str = "TIMESTAMP"; break;
             case DetectedType::UUID: type_str = "UUID"; break;
@@ -255,17 +259,18 @@ static unique_ptr<FunctionData> SmartCastBind(ClientContext &context, TableFunct
     }
 
     // Get table schema and analyze columns
-    Connection conn(context.db->GetDatabase(context));
-    auto schema_result = conn.Query("SELECT * FROM " + result->table_name + " LIMIT 0");
-    if (schema_result->HasError()) {
-        throw BinderException("Table '%s' does not exist: %s", result->table_name, schema_result->GetError());
+    auto session = SessionPool::Acquire(context);
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, result->table_name, table, error)) {
+        throw BinderException("Table '%s' does not exist: %s", result->table_name, error);
     }
 
     // Analyze columns
-    for (idx_t col = 0; col < schema_result->names.size(); col++) {
+    for (idx_t col = 0; col < table.column_names.size(); col++) {
         ColumnAnalysis analysis;
-        analysis.column_name = schema_result->names[col];
-        analysis.original_type = schema_result->types[col];
+        analysis.column_name = table.column_names[col];
+        analysis.original_type = table.column_types[col];
 
         if (analysis.original_type != LogicalType::VARCHAR) {
             analysis.detected_type = DetectedType::VARCHAR;
@@ -278,7 +283,7 @@ static unique_ptr<FunctionData> SmartCastBind(ClientContext &context, TableFunct
 
         // Get values and analyze
         auto query = "SELECT \"" + analysis.column_name + "\" FROM " + result->table_name;
-        auto col_result = conn.Query(query);
+        auto col_result = session.Query(query);
 
         std::vector<std::string> values;
         int64_t total_rows = 0, null_count = 0;
@@ -335,6 +340,7 @@ static unique_ptr<FunctionData> SmartCastBind(ClientContext &context, TableFunct
         }
 
         analysis.target_type = SmartCastUtils::ToLogicalType(analysis.detected_type);
+        analysis.date_kernel = SmartCastUtils::SelectDateKernel(values, analysis.detected_type);
         result->analysis.push_back(analysis);
         result->output_columns.push_back(analysis.column_name);
         result->output_types.push_back(analysis.target_type);
@@ -351,8 +357,8 @@ static unique_ptr<GlobalTableFunctionState> SmartCastInit(ClientContext &context
     auto state = make_uniq<SmartCastGlobalState>();
 
     // Query original data
-    Connection conn(context.db->GetDatabase(context));
-    state->result = conn.Query("SELECT * FROM " + bind_data.table_name);
+    auto session = SessionPool::Acquire(context);
+    state->result = session.Query("SELECT * FROM " + bind_data.table_name);
 
     return std::move(state);
 }
@@ -368,91 +374,79 @@ static void SmartCastScan(ClientContext &context, TableFunctionInput &data_p, Da
     }
 
     idx_t count = chunk->size();
+    std::string str, processed;
 
     for (idx_t col = 0; col < bind_data.analysis.size(); col++) {
         auto &analysis = bind_data.analysis[col];
+        auto &source = chunk->data[col];
+        auto &target = output.data[col];
 
-        for (idx_t row = 0; row < count; row++) {
-            auto val = chunk->GetValue(col, row);
-
-            if (val.IsNull()) {
-                output.SetValue(col, row, Value());
-                continue;
-            }
+        // Non-VARCHAR columns pass through without copying
+        if (analysis.original_type != LogicalType::VARCHAR) {
+            target.Reference(source);
+            continue;
+        }
 
-            // Non-VARCHAR columns pass through
-            if (analysis.original_type != LogicalType::VARCHAR) {
-                output.SetValue(col, row, val);
-                continue;
-            }
+        UnifiedVectorFormat format;
+        source.ToUnifiedFormat(count, format);
+        auto strings = UnifiedVectorFormat::GetData<string_t>(format);
 
-            std::string str = val.GetValue<string>();
-            std::string processed;
-            if (!SmartCastUtils::Preprocess(str, processed)) {
-                output.SetValue(col, row, Value());
+        for (idx_t row = 0; row < count; row++) {
+            auto idx = format.sel->get_index(row);
+            if (!format.validity.RowIsValid(idx)) {
+                FlatVector::SetNull(target, row, true);
                 continue;
             }
+            auto &value = strings[idx];
 
-            // Cast based on detected type
+            // Dates and timestamps go through the column's fixed-layout kernel on the raw string
+            bool ok = true;
             switch (analysis.detected_type) {
-                case DetectedType::BOOLEAN: {
-                    bool parsed;
-                    if (SmartCastUtils::ParseBoolean(processed, parsed)) {
-                        output.SetValue(col, row, Value::BOOLEAN(parsed));
-                    } else {
-                        output.SetValue(col, row, Value());
-                    }
-                    break;
-                }
-                case DetectedType::INTEGER: {
-                    int64_t parsed;
-                    if (SmartCastUtils::ParseInteger(processed, analysis.detected_locale, parsed)) {
-                        output.SetValue(col, row, Value::BIGINT(parsed));
-                    } else {
-                        output.SetValue(col, row, Value());
-                    }
-                    break;
-                }
-                case DetectedType::DOUBLE: {
-                    double parsed;
-                    if (SmartCastUtils::ParseDouble(processed, analysis.detected_locale, parsed)) {
-                        output.SetValue(col, row, Value::DOUBLE(parsed));
-                    } else {
-                        output.SetValue(col, row, Value());
-                    }
-                    break;
-                }
-                case DetectedType::DATE: {
-                    date_t parsed;
-                    if (SmartCastUtils::ParseDate(processed, analysis.detected_date_format, parsed)) {
-                        output.SetValue(col, row, Value::DATE(parsed));
-                    } else {
-                        output.SetValue(col, row, Value());
-                    }
+                case DetectedType::DATE:
+                    ok = SmartCastUtils::ParseDateFast(analysis.date_kernel, value.GetData(), value.GetSize(),
+                                                       analysis.detected_date_format,
+                                                       FlatVector::GetData<date_t>(target)[row]);
                     break;
-                }
-                case DetectedType::TIMESTAMP: {
-                    timestamp_t parsed;
-                    if (SmartCastUtils::ParseTimestamp(processed, analysis.detected_date_format, parsed)) {
-                        output.SetValue(col, row, Value::TIMESTAMP(parsed));
-                    } else {
-                        output.SetValue(col, row, Value());
-                    }
+                case DetectedType::TIMESTAMP:
+                    ok = SmartCastUtils::ParseTimestampFast(analysis.date_kernel, value.GetData(), value.GetSize(),
+                                                            analysis.detected_date_format,
+                                                            FlatVector::GetData<timestamp_t>(target)[row]);
                     break;
-                }
+                case DetectedType::BOOLEAN:
+                case DetectedType::INTEGER:
+                case DetectedType::DOUBLE:
                 case DetectedType::UUID: {
-                    std::string parsed;
-                    if (SmartCastUtils::ParseUUID(processed, parsed)) {
-                        output.SetValue(col, row, Value(parsed));
+                    str.assign(value.GetData(), value.GetSize());
+                    if (!SmartCastUtils::Preprocess(str, processed)) {
+                        ok = false;
+                    } else if (analysis.detected_type == DetectedType::BOOLEAN) {
+                        ok = SmartCastUtils::ParseBoolean(processed, FlatVector::GetData<bool>(target)[row]);
+                    } else if (analysis.detected_type == DetectedType::INTEGER) {
+                        ok = SmartCastUtils::ParseInteger(processed, analysis.detected_locale,
+                                                          FlatVector::GetData<int64_t>(target)[row]);
+                    } else if (analysis.detected_type == DetectedType::DOUBLE) {
+                        ok = SmartCastUtils::ParseDouble(processed, analysis.detected_locale,
+                                                         FlatVector::GetData<double>(target)[row]);
                     } else {
-                        output.SetValue(col, row, Value());
+                        std::string parsed;
+                        ok = SmartCastUtils::ParseUUID(processed, parsed);
+                        if (ok) {
+                            target.SetValue(row, Value(parsed));
+                        }
                     }
                     break;
                 }
                 default:
-                    output.SetValue(col, row, val);
+                    if (analysis.target_type.id() == LogicalTypeId::VARCHAR) {
+                        FlatVector::GetData<string_t>(target)[row] = StringVector::AddString(target, value);
+                    } else {
+                        target.SetValue(row, Value(value.GetString()));
+                    }
                     break;
             }
+            if (!ok) {
+                FlatVector::SetNull(target, row, true);
+            }
         }
     }
 
@@ -518,7 +512,9 @@ static unique_ptr<FunctionData> SmartCastTableBind(ClientContext &context, Table
         }
     }
 
-    Connection conn(context.db->GetDatabase(context));
+    // The temp table lives on the leased connection and is dropped before it goes back to the pool
+    auto session = SessionPool::Acquire(context);
+    auto &conn = session.Conn();
     string tmp = MakeTempTableName();
 
     // Try as SQL query first, then as table name
@@ -543,15 +539,17 @@ static unique_ptr<FunctionData> SmartCastTableBind(ClientContext &context, Table
         ~TempGuard() { conn.Query("DROP TABLE IF EXISTS " + name); }
     } guard{conn, tmp};
 
-    // Get schema
-    auto schema_result = conn.Query("SELECT * FROM " + tmp + " LIMIT 0");
-    if (schema_result->HasError()) {
-        throw InvalidInputException("stps_smart_cast_table: " + schema_result->GetError());
+    // Get schema (the temp table is only visible to the leased connection)
+    CatalogTableInfo table;
+    bool found = false;
+    InTransaction(conn, [&](ClientContext &conn_context) { found = LookupTable(conn_context, "", tmp, table); });
+    if (!found) {
+        throw InvalidInputException("stps_smart_cast_table: temporary table %s not found", tmp);
     }
 
-    idx_t ncols = schema_result->names.size();
-    vector<string> col_names = schema_result->names;
-    vector<LogicalType> orig_types = schema_result->types;
+    idx_t ncols = table.column_names.size();
+    vector<string> col_names = table.column_names;
+    vector<LogicalType> orig_types = table.column_types;
 
     // Analyze each VARCHAR column and determine target type
     vector<LogicalType> target_types = orig_types;
@@ -620,6 +618,7 @@ static unique_ptr<FunctionData> SmartCastTableBind(ClientContext &context, Table
         }
 
         col_analysis[c].target_type = SmartCastUtils::ToLogicalType(col_analysis[c].detected_type);
+        col_analysis[c].date_kernel = SmartCastUtils::SelectDateKernel(values, col_analysis[c].detected_type);
         target_types[c] = col_analysis[c].target_type;
     }
 
@@ -642,6 +641,24 @@ static unique_ptr<FunctionData> SmartCastTableBind(ClientContext &context, Table
                 }
 
                 std::string str = val.GetValue<string>();
+                auto &analysis = col_analysis[c];
+
+                // Dates and timestamps go through the column's fixed-layout kernel on the raw string
+                if (analysis.detected_type == DetectedType::DATE) {
+                    date_t parsed;
+                    row.push_back(SmartCastUtils::ParseDateFast(analysis.date_kernel, str.data(), str.size(),
+                                                                analysis.detected_date_format, parsed)
+                        ? Value::DATE(parsed) : Value());
+                    continue;
+                }
+                if (analysis.detected_type == DetectedType::TIMESTAMP) {
+                    timestamp_t parsed;
+                    row.push_back(SmartCastUtils::ParseTimestampFast(analysis.date_kernel, str.data(), str.size(),
+                                                                     analysis.detected_date_format, parsed)
+                        ? Value::TIMESTAMP(parsed) : Value());
+                    continue;
+                }
+
                 std::string processed;
                 if (!SmartCastUtils::Preprocess(str, processed)) {
                     row.push_back(Value());
@@ -667,18 +684,6 @@ static unique_ptr<FunctionData> SmartCastTableBind(ClientContext &context, Table
                             ? Value::DOUBLE(parsed) : Value());
                         break;
                     }
-                    case DetectedType::DATE: {
-                        date_t parsed;
-                        row.push_back(SmartCastUtils::ParseDate(processed, col_analysis[c].detected_date_format, parsed)
-                            ? Value::DATE(parsed) : Value());
-                        break;
-                    }
-                    case DetectedType::TIMESTAMP: {
-                        timestamp_t parsed;
-                        row.push_back(SmartCastUtils::ParseTimestamp(processed, col_analysis[c].detected_date_format, parsed)
-                            ? Value::TIMESTAMP(parsed) : Value());
-                        break;
-                    }
                     case DetectedType::UUID: {
                         std::string parsed;
                         row.push_back(SmartCastUtils::ParseUUID(processed, parsed)
@@ -2,6 +2,7 @@
 #include "smart_cast_utils.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/decimal.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
@@ -135,6 +136,12 @@ static void SmartCastExplicitFunction(DataChunk &args, ExpressionState &state, V
     NumberLocale locale = SmartCastUtils::DetectLocale(all_values);
     DateFormat date_format = SmartCastUtils::DetectDateFormat(all_values);
 
+    // Date kernels are picked on first use, once per chunk
+    DateKernel date_kernel = DateKernel::GENERIC;
+    DateKernel timestamp_kernel = DateKernel::GENERIC;
+    bool date_kernel_selected = false;
+    bool timestamp_kernel_selected = false;
+
     auto result_data = FlatVector::GetData<string_t>(result);
     auto &result_validity = FlatVector::Validity(result);
 
@@ -186,9 +193,22 @@ static void SmartCastExplicitFunction(DataChunk &args, ExpressionState &state, V
                 }
                 break;
             }
+            case DetectedType::DECIMAL: {
+                int64_t val;
+                if (SmartCastUtils::ParseDecimal(processed, locale, 2, val)) {
+                    result_data[i] = StringVector::AddString(result, Decimal::ToString(val, 18, 2));
+                } else {
+                    result_validity.SetInvalid(i);
+                }
+                break;
+            }
             case DetectedType::DATE: {
+                if (!date_kernel_selected) {
+                    date_kernel = SmartCastUtils::SelectDateKernel(all_values, DetectedType::DATE);
+                    date_kernel_selected = true;
+                }
                 date_t val;
-                if (SmartCastUtils::ParseDate(processed, date_format, val)) {
+                if (SmartCastUtils::ParseDateFast(date_kernel, processed.data(), processed.size(), date_format, val)) {
                     result_data[i] = StringVector::AddString(result, Date::ToString(val));
                 } else {
                     result_validity.SetInvalid(i);
@@ -196,8 +216,13 @@ static void SmartCastExplicitFunction(DataChunk &args, ExpressionState &state, V
                 break;
             }
             case DetectedType::TIMESTAMP: {
+                if (!timestamp_kernel_selected) {
+                    timestamp_kernel = SmartCastUtils::SelectDateKernel(all_values, DetectedType::TIMESTAMP);
+                    timestamp_kernel_selected = true;
+                }
                 timestamp_t val;
-                if (SmartCastUtils::ParseTimestamp(processed, date_format, val)) {
+                if (SmartCastUtils::ParseTimestampFast(timestamp_kernel, processed.data(), processed.size(),
+                                                       date_format, val)) {
                     result_data[i] = StringVector::AddString(result, Timestamp::ToString(val));
                 } else {
                     result_validity.SetInvalid(i);
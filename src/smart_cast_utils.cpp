@@ -4,6 +4,9 @@
 #include <cstdio>
 #include <map>
 #include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
 
 // Month name mappings
 static const std::map<std::string, int> MONTH_NAMES = {
@@ -61,12 +64,29 @@ static bool MakeDate(int year, int month, int day, duckdb::date_t& out_result) {
     if (month < 1 || month > 12 || day < 1 || day > 31) {
         return false;
     }
-    try {
-        out_result = duckdb::Date::FromDate(year, month, day);
-        return true;
-    } catch (...) {
-        return false;
+    return duckdb::Date::TryFromDate(year, month, day, out_result);
+}
+
+// Value of n ASCII digits (caller has validated them)
+static int DigitsToInt(const char* p, size_t n) {
+    int result = 0;
+    for (size_t i = 0; i < n; i++) {
+        result = result * 10 + (p[i] - '0');
     }
+    return result;
+}
+
+// SWAR check that all 8 bytes at p are ASCII digits: every byte must be 0x3X and
+// stay 0x3X after adding 6 (no byte can carry into its neighbour once the first test passed)
+static bool AllDigits8(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return (v & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL &&
+           ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL;
+}
+
+static bool IsSpaceByte(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
 }
 
 // Helper to check if character is hex digit
@@ -85,6 +105,17 @@ static std::string ToLower(const std::string& str) {
 namespace duckdb {
 namespace stps {
 
+// Trim whitespace on a raw byte range (same rule as Preprocess, without copying)
+static void TrimSpan(const char*& data, idx_t& len) {
+    while (len > 0 && IsSpaceByte(data[0])) {
+        data++;
+        len--;
+    }
+    while (len > 0 && IsSpaceByte(data[len - 1])) {
+        len--;
+    }
+}
+
 // Preprocess: trim whitespace, return false for empty
 bool SmartCastUtils::Preprocess(const std::string& input, std::string& out_result) {
     // Trim leading whitespace
@@ -124,203 +155,228 @@ bool SmartCastUtils::IsValidUUID(const std::string& value) {
     return true;
 }
 
-// Check German number format: e.g., 1.234,56 (dot thousands, comma decimal)
-bool SmartCastUtils::MatchesGermanNumberFormat(const std::string& value) {
-    // Must have comma as decimal separator and dots as thousands
-    // Pattern: -?\\d{1,3}(?:\\.\\d{3})*,\\d+
-
-    size_t pos = 0;
-    bool negative = false;
+//=============================================================================
+// Number scanner
+//=============================================================================
 
-    if (pos < value.length() && value[pos] == '-') {
-        negative = true;
-        pos++;
-    }
-
-    // Must start with 1-3 digits
-    size_t digit_count = 0;
-    while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-        digit_count++;
-        pos++;
+// Length of a currency symbol ($, €, £, ¥) at p, 0 if none
+static idx_t CurrencySymbolLength(const char* p, idx_t remaining) {
+    if (remaining >= 1 && p[0] == '$') return 1;
+    if (remaining >= 3 && std::memcmp(p, "\xe2\x82\xac", 3) == 0) return 3;  // €
+    if (remaining >= 2 && (std::memcmp(p, "\xc2\xa3", 2) == 0 ||             // £
+                           std::memcmp(p, "\xc2\xa5", 2) == 0)) {            // ¥
+        return 2;
     }
-    if (digit_count < 1 || digit_count > 3) return false;
-
-    // Then groups of .XXX (exactly 3 digits after each dot)
-    bool has_thousands = false;
-    while (pos < value.length() && value[pos] == '.') {
-        has_thousands = true;
-        pos++;
-        digit_count = 0;
-        while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-            digit_count++;
-            pos++;
-        }
-        if (digit_count != 3) return false;
-    }
-
-    // Must have comma followed by digits (decimal part)
-    if (pos >= value.length() || value[pos] != ',') return false;
-    pos++;
-
-    // At least one digit after comma
-    if (pos >= value.length() || !std::isdigit(static_cast<unsigned char>(value[pos]))) return false;
-
-    while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-        pos++;
-    }
-
-    return pos == value.length();
+    return 0;
 }
 
-// Check US number format: e.g., 1,234.56 (comma thousands, dot decimal)
-bool SmartCastUtils::MatchesUSNumberFormat(const std::string& value) {
-    // Pattern: -?\\d{1,3}(?:,\\d{3})*\\.\\d+
+static bool IsDigitByte(char c) {
+    return c >= '0' && c <= '9';
+}
 
-    size_t pos = 0;
+// One pass over: [currency] [sign] digits with optional grouping [decimal digits] [exponent] [% | currency]
+bool SmartCastUtils::ScanNumber(const char* data, idx_t len, NumberLocale locale, ScannedNumber& out) {
+    out = ScannedNumber();
+    TrimSpan(data, len);
+    const char thousands_sep = (locale == NumberLocale::US) ? ',' : '.';
+    const char decimal_sep = (locale == NumberLocale::US) ? '.' : ',';
 
-    if (pos < value.length() && value[pos] == '-') {
-        pos++;
+    idx_t pos = 0;
+    idx_t currency = CurrencySymbolLength(data, len);
+    if (currency > 0) {
+        pos += currency;
+        while (pos < len && IsSpaceByte(data[pos])) pos++;
     }
 
-    // Must start with 1-3 digits
-    size_t digit_count = 0;
-    while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-        digit_count++;
+    out.body = data + pos;
+    if (pos < len && (data[pos] == '-' || data[pos] == '+')) {
+        out.negative = data[pos] == '-';
+        out.explicit_plus = data[pos] == '+';
         pos++;
     }
-    if (digit_count < 1 || digit_count > 3) return false;
 
-    // Then groups of ,XXX (exactly 3 digits after each comma)
-    while (pos < value.length() && value[pos] == ',') {
-        pos++;
-        digit_count = 0;
-        while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-            digit_count++;
-            pos++;
+    auto add_digit = [&](char c, bool fraction) {
+        uint8_t digit = static_cast<uint8_t>(c - '0');
+        if (out.mantissa == 0 && digit == 0 && !out.truncated) {
+            // Leading zeros are not significant
+            if (fraction) out.exponent--;
+            return;
+        }
+        if (out.significant_digits < 19) {
+            out.mantissa = out.mantissa * 10 + digit;
+            out.significant_digits++;
+            if (fraction) out.exponent--;
+        } else {
+            out.truncated = true;
+            if (!fraction) out.exponent++;
+        }
+    };
+
+    // Integer part; grouping is 1-3 digits, then groups of exactly 3
+    idx_t group_digits = 0;
+    while (pos < len) {
+        char c = data[pos];
+        if (IsDigitByte(c)) {
+            add_digit(c, false);
+            out.integer_digits++;
+            group_digits++;
+        } else if (c == thousands_sep) {
+            if (out.has_grouping ? group_digits != 3 : (group_digits == 0 || group_digits > 3)) return false;
+            if (!out.has_grouping) out.first_group_digits = group_digits;
+            out.has_grouping = true;
+            group_digits = 0;
+        } else {
+            break;
         }
-        if (digit_count != 3) return false;
-    }
-
-    // Must have dot followed by digits (decimal part)
-    if (pos >= value.length() || value[pos] != '.') return false;
-    pos++;
-
-    // At least one digit after dot
-    if (pos >= value.length() || !std::isdigit(static_cast<unsigned char>(value[pos]))) return false;
-
-    while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
         pos++;
     }
-
-    return pos == value.length();
-}
-
-// Remove currency symbol from beginning of value, return true if found
-bool SmartCastUtils::RemoveCurrencySymbol(std::string& value) {
-    if (value.empty()) return false;
-
-    // Common currency symbols (check multi-byte first)
-    const char* euro = "\xe2\x82\xac";  // €
-    const char* pound = "\xc2\xa3";      // £
-    const char* yen = "\xc2\xa5";        // ¥
-
-    bool found = false;
-    size_t pos = 0;
-
-    // Skip leading whitespace
-    while (pos < value.length() && std::isspace(static_cast<unsigned char>(value[pos]))) {
-        pos++;
+    if (out.has_grouping) {
+        if (group_digits != 3) return false;
+    } else {
+        out.first_group_digits = group_digits;
     }
 
-    // Check for currency symbols
-    if (pos < value.length()) {
-        if (value[pos] == '$') {
+    if (pos < len && data[pos] == decimal_sep) {
+        out.has_decimal_separator = true;
+        pos++;
+        while (pos < len && IsDigitByte(data[pos])) {
+            add_digit(data[pos], true);
+            out.fraction_digits++;
             pos++;
-            found = true;
-        } else if (value.length() - pos >= 3 && value.substr(pos, 3) == euro) {
-            pos += 3;
-            found = true;
-        } else if (value.length() - pos >= 2 && value.substr(pos, 2) == pound) {
-            pos += 2;
-            found = true;
-        } else if (value.length() - pos >= 2 && value.substr(pos, 2) == yen) {
-            pos += 2;
-            found = true;
         }
     }
+    if (out.integer_digits + out.fraction_digits == 0) return false;
 
-    if (found) {
-        // Skip whitespace after symbol
-        while (pos < value.length() && std::isspace(static_cast<unsigned char>(value[pos]))) {
-            pos++;
+    if (pos < len && (data[pos] == 'e' || data[pos] == 'E') && !out.has_grouping) {
+        idx_t exp_pos = pos + 1;
+        bool exp_negative = false;
+        if (exp_pos < len && (data[exp_pos] == '-' || data[exp_pos] == '+')) {
+            exp_negative = data[exp_pos] == '-';
+            exp_pos++;
         }
-        value = value.substr(pos);
-    }
-
-    return found;
-}
-
-// Remove trailing percentage, return true if found
-bool SmartCastUtils::RemovePercentage(std::string& value, bool& was_percentage) {
-    was_percentage = false;
-    if (value.empty()) return false;
-
-    // Check for trailing %
-    size_t end = value.length();
-    while (end > 0 && std::isspace(static_cast<unsigned char>(value[end - 1]))) {
-        end--;
-    }
-
-    if (end > 0 && value[end - 1] == '%') {
-        was_percentage = true;
-        value = value.substr(0, end - 1);
-        // Trim trailing whitespace again
-        end = value.length();
-        while (end > 0 && std::isspace(static_cast<unsigned char>(value[end - 1]))) {
-            end--;
+        if (exp_pos >= len || !IsDigitByte(data[exp_pos])) return false;
+        int32_t exp_value = 0;
+        while (exp_pos < len && IsDigitByte(data[exp_pos])) {
+            if (exp_value < 100000) exp_value = exp_value * 10 + (data[exp_pos] - '0');
+            exp_pos++;
         }
-        value = value.substr(0, end);
-        return true;
+        out.has_exponent = true;
+        out.exponent += exp_negative ? -exp_value : exp_value;
+        pos = exp_pos;
     }
+    out.body_len = static_cast<idx_t>(data + pos - out.body);
 
-    return false;
-}
-
-// Check if thousands separator format is valid
-bool SmartCastUtils::IsValidThousandsSeparatorFormat(const std::string& value, char thousands_sep) {
-    // Valid format: first group 1-3 digits, subsequent groups exactly 3 digits
-    // e.g., "1.234.567" or "12.345" but not "15.01.2024"
-
-    size_t pos = 0;
-
-    // Skip optional minus
-    if (pos < value.length() && value[pos] == '-') {
+    // Suffix: percent or currency, optionally separated by whitespace
+    while (pos < len && IsSpaceByte(data[pos])) pos++;
+    if (pos < len && data[pos] == '%') {
+        out.percentage = true;
         pos++;
+    } else if (currency == 0) {
+        pos += CurrencySymbolLength(data + pos, len - pos);
     }
+    return pos == len;
+}
 
-    // First group: 1-3 digits
-    size_t digit_count = 0;
-    while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-        digit_count++;
-        pos++;
+// Exact powers of ten representable as double
+static const double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                             1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                             1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool SmartCastUtils::ScannedToDouble(const ScannedNumber& number, NumberLocale locale, double& out_result) {
+    double result;
+    if (!number.truncated && number.mantissa <= (1ULL << 53) && number.exponent >= -22 && number.exponent <= 22) {
+        // Both operands are exact, so one IEEE multiply/divide is correctly rounded (same as strtod)
+        result = static_cast<double>(number.mantissa);
+        if (number.exponent >= 0) {
+            result *= EXACT_POWERS_OF_TEN[number.exponent];
+        } else {
+            result /= EXACT_POWERS_OF_TEN[-number.exponent];
+        }
+        if (number.negative) result = -result;
+    } else {
+        // Rare: long mantissas or large exponents go through strtod on a normalized stack copy
+        const char thousands_sep = (locale == NumberLocale::US) ? ',' : '.';
+        const char decimal_sep = (locale == NumberLocale::US) ? '.' : ',';
+        char buffer[128];
+        if (number.body_len >= sizeof(buffer)) return false;
+        idx_t n = 0;
+        for (idx_t i = 0; i < number.body_len; i++) {
+            char c = number.body[i];
+            if (c == thousands_sep) continue;
+            buffer[n++] = (c == decimal_sep) ? '.' : c;
+        }
+        buffer[n] = '\0';
+        errno = 0;
+        char* end = nullptr;
+        result = std::strtod(buffer, &end);
+        if (errno == ERANGE || end != buffer + n) return false;
+    }
+    if (number.percentage) {
+        result /= 100.0;
     }
-    if (digit_count < 1 || digit_count > 3) return false;
+    out_result = result;
+    return true;
+}
 
-    // Subsequent groups: separator + exactly 3 digits
-    bool has_sep = false;
-    while (pos < value.length() && value[pos] == thousands_sep) {
-        has_sep = true;
-        pos++;
-        digit_count = 0;
-        while (pos < value.length() && std::isdigit(static_cast<unsigned char>(value[pos]))) {
-            digit_count++;
-            pos++;
+// Powers of ten up to 10^18 (fit int64)
+static const int64_t INT64_POWERS_OF_TEN[] = {1LL,
+                                              10LL,
+                                              100LL,
+                                              1000LL,
+                                              10000LL,
+                                              100000LL,
+                                              1000000LL,
+                                              10000000LL,
+                                              100000000LL,
+                                              1000000000LL,
+                                              10000000000LL,
+                                              100000000000LL,
+                                              1000000000000LL,
+                                              10000000000000LL,
+                                              100000000000000LL,
+                                              1000000000000000LL,
+                                              10000000000000000LL,
+                                              100000000000000000LL,
+                                              1000000000000000000LL};
+
+bool SmartCastUtils::ScannedToDecimal(const ScannedNumber& number, uint8_t scale, int64_t& out_result) {
+    if (scale > 18) return false;
+    // value * 10^scale = mantissa * 10^shift
+    int64_t shift = static_cast<int64_t>(number.exponent) + scale - (number.percentage ? 2 : 0);
+    const uint64_t limit = 1000000000000000000ULL;  // |unscaled| < 10^18 for DECIMAL(18, s)
+    uint64_t unscaled;
+    if (shift >= 0) {
+        if (number.mantissa == 0) {
+            unscaled = 0;
+        } else {
+            // A truncated mantissa already has 19 digits and overflows here
+            if (shift > 18 || number.mantissa >= limit) return false;
+            uint64_t factor = static_cast<uint64_t>(INT64_POWERS_OF_TEN[shift]);
+            if (number.mantissa > (limit - 1) / factor) return false;
+            unscaled = number.mantissa * factor;
+        }
+    } else {
+        // Round half away from zero on the first dropped digit
+        if (-shift > 19) {
+            unscaled = 0;
+        } else {
+            uint64_t divisor = (-shift == 19) ? 10000000000000000000ULL
+                                              : static_cast<uint64_t>(INT64_POWERS_OF_TEN[-shift]);
+            unscaled = number.mantissa / divisor;
+            uint64_t remainder = number.mantissa % divisor;
+            if (remainder >= divisor / 2) unscaled++;
         }
-        if (digit_count != 3) return false;
     }
+    if (unscaled >= limit) return false;
+    out_result = number.negative ? -static_cast<int64_t>(unscaled) : static_cast<int64_t>(unscaled);
+    return true;
+}
 
-    // Must have at least one separator and reach end of string
-    return has_sep && pos == value.length();
+bool SmartCastUtils::MatchesNumberLayout(const std::string& value, NumberLocale locale) {
+    ScannedNumber number;
+    if (!ScanNumber(value.data(), value.size(), locale, number)) return false;
+    return number.has_decimal_separator && number.fraction_digits > 0 && number.integer_digits > 0 &&
+           number.first_group_digits <= 3 && !number.has_exponent && !number.explicit_plus;
 }
 
 // Parse boolean values
@@ -344,85 +400,51 @@ bool SmartCastUtils::ParseBoolean(const std::string& value, bool& out_result) {
     return false;
 }
 
-bool SmartCastUtils::LooksLikeId(const std::string& value) {
-    // Leading zeros suggest an ID (e.g., "007", "00123")
+// Leading zeros suggest an ID (e.g., "007", "00123")
+static bool LooksLikeIdSpan(const char* p, idx_t n) {
     // But not dates like "01/15/2024" or "01.01.2024"
-    if (value.size() > 1 && value[0] == '0' && std::isdigit(static_cast<unsigned char>(value[1]))) {
+    if (n > 1 && p[0] == '0' && IsDigitByte(p[1])) {
         // Check if it looks like a date (has separators)
-        if (value.find('/') != std::string::npos ||
-            value.find('-') != std::string::npos ||
-            value.find('.') != std::string::npos) {
+        if (std::memchr(p, '/', n) || std::memchr(p, '-', n) || std::memchr(p, '.', n)) {
             return false;  // Might be a date
         }
         return true;
     }
     // Negative with leading zeros
-    if (value.size() > 2 && value[0] == '-' && value[1] == '0' && std::isdigit(static_cast<unsigned char>(value[2]))) {
+    if (n > 2 && p[0] == '-' && p[1] == '0' && IsDigitByte(p[2])) {
         return true;
     }
     return false;
 }
 
-bool SmartCastUtils::ParseInteger(const std::string& value, NumberLocale locale, int64_t& out_result) {
-    std::string processed;
-    if (!Preprocess(value, processed)) {
-        return false;
-    }
+bool SmartCastUtils::LooksLikeId(const std::string& value) {
+    return LooksLikeIdSpan(value.data(), value.size());
+}
 
-    std::string str = processed;
+bool SmartCastUtils::ParseInteger(const std::string& value, NumberLocale locale, int64_t& out_result) {
+    const char* data = value.data();
+    idx_t len = value.size();
+    TrimSpan(data, len);
 
     // Check for leading zeros (likely an ID)
-    if (LooksLikeId(str)) {
+    if (LooksLikeIdSpan(data, len)) {
         return false;
     }
 
-    // Remove currency symbols
-    RemoveCurrencySymbol(str);
-
-    // Trim again after removing currency
-    std::string trimmed;
-    if (!Preprocess(str, trimmed)) return false;
-    str = trimmed;
-
-    // Determine separator to remove based on locale
-    char thousands_sep = (locale == NumberLocale::US) ? ',' : '.';
-
-    // Check if it contains a decimal separator - if so, not an integer
-    char decimal_sep = (locale == NumberLocale::US) ? '.' : ',';
-    if (str.find(decimal_sep) != std::string::npos) {
-        // Has decimal separator, not an integer
+    ScannedNumber number;
+    if (!ScanNumber(data, len, locale, number)) {
         return false;
     }
-
-    // Validate the format of thousands separators if present
-    if (str.find(thousands_sep) != std::string::npos) {
-        if (!IsValidThousandsSeparatorFormat(str, thousands_sep)) {
-            // Not a valid integer with thousands separators - might be a date
-            return false;
-        }
-    }
-
-    // Remove thousands separators
-    std::string clean;
-    for (char c : str) {
-        if (c != thousands_sep) {
-            clean += c;
-        }
+    // Decimal separator, exponent or percent sign: not an integer
+    if (number.has_decimal_separator || number.has_exponent || number.percentage || number.truncated) {
+        return false;
     }
-
-    // Parse as integer
-    try {
-        size_t pos;
-        int64_t result = std::stoll(clean, &pos);
-        if (pos == clean.size()) {
-            out_result = result;
-            return true;
-        }
-    } catch (...) {
-        // Parse failed
+    const uint64_t max_magnitude = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (number.negative ? 1 : 0);
+    if (number.mantissa > max_magnitude) {
+        return false;
     }
-
-    return false;
+    out_result = number.negative ? static_cast<int64_t>(~number.mantissa + 1) : static_cast<int64_t>(number.mantissa);
+    return true;
 }
 
 NumberLocale SmartCastUtils::DetectLocale(const std::vector<std::string>& values) {
@@ -430,21 +452,12 @@ NumberLocale SmartCastUtils::DetectLocale(const std::vector<std::string>& values
     bool found_us = false;
 
     for (const auto& val : values) {
-        std::string processed;
-        if (!Preprocess(val, processed)) continue;
-
-        std::string str = processed;
-        // Remove currency symbols for analysis
-        RemoveCurrencySymbol(str);
-        bool was_pct = false;
-        RemovePercentage(str, was_pct);
-
-        // Unambiguous German: has comma as decimal (e.g., 1234,56 or 1.234,56)
-        if (MatchesGermanNumberFormat(str)) {
+        // Unambiguous German: has comma as decimal (e.g., 1.234,56)
+        if (MatchesNumberLayout(val, NumberLocale::GERMAN)) {
             found_german = true;
         }
         // Unambiguous US: has dot as decimal with comma thousands (e.g., 1,234.56)
-        if (MatchesUSNumberFormat(str)) {
+        if (MatchesNumberLayout(val, NumberLocale::US)) {
             found_us = true;
         }
     }
@@ -462,79 +475,19 @@ NumberLocale SmartCastUtils::DetectLocale(const std::vector<std::string>& values
 }
 
 bool SmartCastUtils::ParseDouble(const std::string& value, NumberLocale locale, double& out_result) {
-    std::string processed;
-    if (!Preprocess(value, processed)) {
+    ScannedNumber number;
+    if (!ScanNumber(value.data(), value.size(), locale, number)) {
         return false;
     }
+    return ScannedToDouble(number, locale, out_result);
+}
 
-    std::string str = processed;
-
-    // Check for percentage
-    bool is_percentage = false;
-    RemovePercentage(str, is_percentage);
-
-    // Remove currency symbols
-    RemoveCurrencySymbol(str);
-
-    // Trim again after removing symbols
-    std::string trimmed;
-    if (!Preprocess(str, trimmed)) return false;
-    str = trimmed;
-
-    // Determine separators based on locale
-    char thousands_sep, decimal_sep;
-    if (locale == NumberLocale::US) {
-        thousands_sep = ',';
-        decimal_sep = '.';
-    } else {
-        // German or AUTO (default to German)
-        thousands_sep = '.';
-        decimal_sep = ',';
-    }
-
-    // Validate thousands separator format if present
-    size_t sep_pos = str.find(thousands_sep);
-    size_t dec_pos = str.find(decimal_sep);
-
-    if (sep_pos != std::string::npos) {
-        // Extract the part before the decimal (if any) to validate thousands separators
-        std::string integer_part = (dec_pos != std::string::npos) ? str.substr(0, dec_pos) : str;
-
-        // Validate format
-        if (!IsValidThousandsSeparatorFormat(integer_part, thousands_sep)) {
-            // Not a valid number with thousands separators - might be a date
-            return false;
-        }
-    }
-
-    // Build clean string: remove thousands, replace decimal with .
-    std::string clean;
-    for (char c : str) {
-        if (c == thousands_sep) {
-            continue;  // Skip thousands separator
-        } else if (c == decimal_sep) {
-            clean += '.';  // Normalize decimal to .
-        } else {
-            clean += c;
-        }
-    }
-
-    // Parse as double
-    try {
-        size_t pos;
-        double result = std::stod(clean, &pos);
-        if (pos == clean.size()) {
-            if (is_percentage) {
-                result /= 100.0;
-            }
-            out_result = result;
-            return true;
-        }
-    } catch (...) {
-        // Parse failed
+bool SmartCastUtils::ParseDecimal(const std::string& value, NumberLocale locale, uint8_t scale, int64_t& out_result) {
+    ScannedNumber number;
+    if (!ScanNumber(value.data(), value.size(), locale, number)) {
+        return false;
     }
-
-    return false;
+    return ScannedToDecimal(number, scale, out_result);
 }
 
 // Helper to parse date parts: DD/MM/YYYY or similar
@@ -555,16 +508,17 @@ static bool ParseDateParts(const std::string& str, int& part1, int& part2, int&
 
     if (sep1 == std::string::npos || sep2 == std::string::npos) return false;
 
-    std::string s1 = str.substr(0, sep1);
-    std::string s2 = str.substr(sep1 + 1, sep2 - sep1 - 1);
-    std::string s3 = str.substr(sep2 + 1);
-
     // All parts must be digits
-    for (char c : s1) if (!std::isdigit(static_cast<unsigned char>(c))) return false;
-    for (char c : s2) if (!std::isdigit(static_cast<unsigned char>(c))) return false;
-    for (char c : s3) if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+    for (size_t i = 0; i < str.length(); i++) {
+        if (i == sep1 || i == sep2) continue;
+        if (!std::isdigit(static_cast<unsigned char>(str[i]))) return false;
+    }
+
+    size_t len1 = sep1;
+    size_t len2 = sep2 - sep1 - 1;
+    size_t len3 = str.length() - sep2 - 1;
 
-    if (s1.empty() || s2.empty() || s3.empty()) return false;
+    if (len1 == 0 || len2 == 0 || len3 == 0) return false;
 
     // Reject patterns that look like thousands-separated numbers rather than dates.
     // Valid date patterns:
@@ -573,41 +527,33 @@ static bool ParseDateParts(const std::string& str, int& part1, int& part2, int&
     // Invalid patterns (likely numbers):
     //   - Both s2 and s3 have exactly 3 digits (e.g., "1.234.567" -> thousands separator format)
     //   - s2 has more than 2 digits when s1 is not a 4-digit year
-    
-    bool s1_is_4digit_year = (s1.length() == 4);
-    bool s2_looks_like_thousands = (s2.length() == 3);
-    bool s3_looks_like_thousands = (s3.length() == 3);
-    
+
     // If s2 and s3 both have exactly 3 digits, this looks like a thousands-separated number
     // (e.g., "1.234.567" or "12.345.678")
-    if (s2_looks_like_thousands && s3_looks_like_thousands) {
+    if (len2 == 3 && len3 == 3) {
         return false;
     }
-    
+
     // Validate date part lengths based on format
-    if (!s1_is_4digit_year) {
+    if (len1 != 4) {
         // D.M.Y format expected
         // s1 (day) should be 1-2 digits
-        if (s1.length() > 2) return false;
-        // s2 (month) should be 1-2 digits  
-        if (s2.length() > 2) return false;
+        if (len1 > 2) return false;
+        // s2 (month) should be 1-2 digits
+        if (len2 > 2) return false;
         // s3 (year) should be 2 or 4 digits - reject 3-digit years as they look like number parts
-        if (s3.length() == 3) return false;
-        if (s3.length() > 4) return false;
+        if (len3 == 3) return false;
+        if (len3 > 4) return false;
     } else {
         // Y.M.D format: s2 and s3 should be 1-2 digits
-        if (s2.length() > 2) return false;
-        if (s3.length() > 2) return false;
+        if (len2 > 2) return false;
+        if (len3 > 2) return false;
     }
 
-    try {
-        part1 = std::stoi(s1);
-        part2 = std::stoi(s2);
-        part3 = std::stoi(s3);
-        return true;
-    } catch (...) {
-        return false;
-    }
+    part1 = DigitsToInt(str.data(), len1);
+    part2 = DigitsToInt(str.data() + sep1 + 1, len2);
+    part3 = DigitsToInt(str.data() + sep2 + 1, len3);
+    return true;
 }
 
 DateFormat SmartCastUtils::DetectDateFormat(const std::vector<std::string>& values) {
@@ -641,60 +587,35 @@ bool SmartCastUtils::ParseDate(const std::string& value, DateFormat format, date
         return false;
     }
 
-    std::string str = processed;
+    const std::string& str = processed;
 
-    // ISO format: 2024-01-15
-    if (str.length() >= 10 && str[4] == '-' && str[7] == '-') {
-        // Check if all other positions are digits
-        bool valid = true;
-        for (size_t i = 0; i < 10 && valid; i++) {
-            if (i == 4 || i == 7) continue;
-            if (!std::isdigit(static_cast<unsigned char>(str[i]))) valid = false;
-        }
-        if (valid && str.length() == 10) {
-            int year = std::stoi(str.substr(0, 4));
-            int month = std::stoi(str.substr(5, 2));
-            int day = std::stoi(str.substr(8, 2));
-            return MakeDate(year, month, day, out_result);
+    // ISO format: 2024-01-15, year-first slash: 2024/01/15
+    if (str.length() == 10 && ((str[4] == '-' && str[7] == '-') || (str[4] == '/' && str[7] == '/'))) {
+        char ymd[8] = {str[0], str[1], str[2], str[3], str[5], str[6], str[8], str[9]};
+        if (AllDigits8(ymd)) {
+            return MakeDate(DigitsToInt(ymd, 4), DigitsToInt(ymd + 4, 2), DigitsToInt(ymd + 6, 2), out_result);
         }
     }
 
     // Compact format: 20240115
-    if (str.length() == 8) {
-        bool all_digits = true;
-        for (char c : str) {
-            if (!std::isdigit(static_cast<unsigned char>(c))) {
-                all_digits = false;
-                break;
-            }
-        }
-        if (all_digits) {
-            int year = std::stoi(str.substr(0, 4));
-            int month = std::stoi(str.substr(4, 2));
-            int day = std::stoi(str.substr(6, 2));
-            return MakeDate(year, month, day, out_result);
-        }
+    if (str.length() == 8 && AllDigits8(str.data())) {
+        return MakeDate(DigitsToInt(str.data(), 4), DigitsToInt(str.data() + 4, 2),
+                        DigitsToInt(str.data() + 6, 2), out_result);
     }
 
-    // Year-first slash: 2024/01/15
-    if (str.length() >= 10 && str[4] == '/' && str[7] == '/') {
-        bool valid = true;
-        for (size_t i = 0; i < 10 && valid; i++) {
-            if (i == 4 || i == 7) continue;
-            if (!std::isdigit(static_cast<unsigned char>(str[i]))) valid = false;
-        }
-        if (valid && str.length() == 10) {
-            int year = std::stoi(str.substr(0, 4));
-            int month = std::stoi(str.substr(5, 2));
-            int day = std::stoi(str.substr(8, 2));
-            return MakeDate(year, month, day, out_result);
-        }
+    // Compact two-digit year: 240115, only for a declared year-first format
+    if (format == DateFormat::YMD && str.length() == 6 &&
+        std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return MakeDate(DigitsToInt(str.data(), 2), DigitsToInt(str.data() + 2, 2), DigitsToInt(str.data() + 4, 2),
+                        out_result);
     }
 
     // Dot/slash/dash separated: try based on format
     int first, second, third;
     if (ParseDateParts(str, first, second, third)) {
-        if (format == DateFormat::MDY) {
+        if (format == DateFormat::YMD) {
+            return MakeDate(first, second, third, out_result);  // Y/M/D
+        } else if (format == DateFormat::MDY) {
             return MakeDate(third, first, second, out_result);  // M/D/Y
         } else {
             return MakeDate(third, second, first, out_result);  // D/M/Y
@@ -869,7 +790,7 @@ bool SmartCastUtils::ParseTimestamp(const std::string& value, DateFormat format,
         return false;
     }
 
-    std::string str = processed;
+    const std::string& str = processed;
 
     // Look for time part (HH:MM or HH:MM:SS)
     size_t time_start = std::string::npos;
@@ -928,6 +849,141 @@ bool SmartCastUtils::ParseTimestamp(const std::string& value, DateFormat format,
     return false;
 }
 
+//=============================================================================
+// Fixed-layout date kernels
+//=============================================================================
+
+static bool IsDateSeparator(char c) {
+    return c == '.' || c == '/' || c == '-';
+}
+
+// Gather the date digits of a value in the kernel's layout into canonical YYYYMMDD order.
+// Returns false if the separators/length do not match; digits are validated by the caller.
+static bool GatherDateDigits(DateKernel kernel, const char* p, idx_t len, DateFormat format, char ymd[8]) {
+    switch (kernel) {
+        case DateKernel::ISO:
+            if (len != 10 || p[4] != '-' || p[7] != '-') return false;
+            std::memcpy(ymd, p, 4);
+            ymd[4] = p[5]; ymd[5] = p[6];
+            ymd[6] = p[8]; ymd[7] = p[9];
+            return true;
+        case DateKernel::DAY_MONTH_YEAR:
+            if (len != 10 || p[2] != p[5] || !IsDateSeparator(p[2])) return false;
+            std::memcpy(ymd, p + 6, 4);
+            if (format == DateFormat::MDY) {
+                ymd[4] = p[0]; ymd[5] = p[1];
+                ymd[6] = p[3]; ymd[7] = p[4];
+            } else {
+                ymd[4] = p[3]; ymd[5] = p[4];
+                ymd[6] = p[0]; ymd[7] = p[1];
+            }
+            return true;
+        case DateKernel::COMPACT_YMD:
+            if (len != 8) return false;
+            std::memcpy(ymd, p, 8);
+            return true;
+        case DateKernel::COMPACT_DMY:
+            if (len != 8) return false;
+            std::memcpy(ymd, p + 4, 4);
+            ymd[4] = p[2]; ymd[5] = p[3];
+            ymd[6] = p[0]; ymd[7] = p[1];
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool MakeDateFromDigits(const char ymd[8], date_t& out_result) {
+    return MakeDate(DigitsToInt(ymd, 4), DigitsToInt(ymd + 4, 2), DigitsToInt(ymd + 6, 2), out_result);
+}
+
+static idx_t KernelDateLength(DateKernel kernel) {
+    return (kernel == DateKernel::COMPACT_YMD || kernel == DateKernel::COMPACT_DMY) ? 8 : 10;
+}
+
+DateKernel SmartCastUtils::SelectDateKernel(const std::vector<std::string>& values, DetectedType type) {
+    if (type != DetectedType::DATE && type != DetectedType::TIMESTAMP) {
+        return DateKernel::GENERIC;
+    }
+
+    idx_t iso_count = 0, dmy_count = 0, compact_count = 0;
+    for (const auto& val : values) {
+        const char* p = val.data();
+        idx_t date_len = val.size();
+        TrimSpan(p, date_len);
+        if (type == DetectedType::TIMESTAMP) {
+            idx_t sep = 0;
+            while (sep < date_len && p[sep] != ' ' && p[sep] != 'T') sep++;
+            if (sep == date_len) continue;
+            date_len = sep;
+        }
+        if (date_len == 10 && p[4] == '-' && p[7] == '-') {
+            iso_count++;
+        } else if (date_len == 10 && p[2] == p[5] && IsDateSeparator(p[2])) {
+            dmy_count++;
+        } else if (date_len == 8 && AllDigits8(p)) {
+            compact_count++;
+        }
+    }
+
+    // A kernel only pays off if it covers most of the column; everything else falls back per value
+    idx_t best = std::max(iso_count, std::max(dmy_count, compact_count));
+    if (best == 0 || best * 2 < values.size()) {
+        return DateKernel::GENERIC;
+    }
+    if (best == iso_count) return DateKernel::ISO;
+    if (best == dmy_count) return DateKernel::DAY_MONTH_YEAR;
+    // ParseDate reads 8 digits as YYYYMMDD; COMPACT_DMY is only used for a declared DDMMYYYY
+    return DateKernel::COMPACT_YMD;
+}
+
+bool SmartCastUtils::ParseDateFast(DateKernel kernel, const char* data, idx_t len, DateFormat format,
+                                   date_t& out_result) {
+    TrimSpan(data, len);
+    if (len == 0) {
+        return false;
+    }
+
+    // A value the kernel does not read as a valid date gets the generic parser, so the result
+    // never depends on which kernel the neighbouring values picked
+    char ymd[8];
+    if (GatherDateDigits(kernel, data, len, format, ymd) && AllDigits8(ymd) && MakeDateFromDigits(ymd, out_result)) {
+        return true;
+    }
+    return ParseDate(std::string(data, len), format, out_result);
+}
+
+bool SmartCastUtils::ParseTimestampFast(DateKernel kernel, const char* data, idx_t len, DateFormat format,
+                                        timestamp_t& out_result) {
+    TrimSpan(data, len);
+    if (len == 0) {
+        return false;
+    }
+
+    // <date>[ T]HH:MM or <date>[ T]HH:MM:SS
+    idx_t date_len = KernelDateLength(kernel);
+    bool has_seconds = len == date_len + 9;
+    if (kernel != DateKernel::GENERIC && (len == date_len + 6 || has_seconds) &&
+        (data[date_len] == ' ' || data[date_len] == 'T')) {
+        const char* t = data + date_len + 1;
+        // HHMMSS (seconds default to 00) through the same SWAR digit check as the date
+        char hms[8] = {t[0], t[1], t[3], t[4], has_seconds ? t[6] : '0', has_seconds ? t[7] : '0', '0', '0'};
+        char ymd[8];
+        if (t[2] == ':' && (!has_seconds || t[5] == ':') && AllDigits8(hms) &&
+            GatherDateDigits(kernel, data, date_len, format, ymd) && AllDigits8(ymd)) {
+            date_t date;
+            int hour = DigitsToInt(hms, 2);
+            int minute = DigitsToInt(hms + 2, 2);
+            int second = DigitsToInt(hms + 4, 2);
+            if (MakeDateFromDigits(ymd, date) && hour < 24 && minute < 60 && second < 60 &&
+                Timestamp::TryFromDatetime(date, Time::FromTime(hour, minute, second, 0), out_result)) {
+                return true;
+            }
+        }
+    }
+    return ParseTimestamp(std::string(data, len), format, out_result);
+}
+
 bool SmartCastUtils::ParseUUID(const std::string& value, std::string& out_result) {
     std::string processed;
     if (!Preprocess(value, processed)) {
@@ -1001,6 +1057,7 @@ DetectedType SmartCastUtils::StringToDetectedType(const std::string& type_str) {
     if (upper == "BOOLEAN" || upper == "BOOL") return DetectedType::BOOLEAN;
     if (upper == "INTEGER" || upper == "INT" || upper == "BIGINT") return DetectedType::INTEGER;
     if (upper == "DOUBLE" || upper == "FLOAT" || upper == "REAL") return DetectedType::DOUBLE;
+    if (upper == "DECIMAL" || upper == "NUMERIC") return DetectedType::DECIMAL;
     if (upper == "DATE") return DetectedType::DATE;
     if (upper == "TIMESTAMP") return DetectedType::TIMESTAMP;
     if (upper == "UUID") return DetectedType::UUID;
@@ -1016,6 +1073,8 @@ LogicalType SmartCastUtils::ToLogicalType(DetectedType type) {
             return LogicalType::BIGINT;
         case DetectedType::DOUBLE:
             return LogicalType::DOUBLE;
+        case DetectedType::DECIMAL:
+            return LogicalType::DECIMAL(18, 2);
         case DetectedType::DATE:
             return LogicalType::DATE;
         case DetectedType::TIMESTAMP:
@@ -2,6 +2,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include <regex>
 #include <algorithm>
@@ -120,14 +122,11 @@ static unique_ptr<FunctionData> LambdaBind(ClientContext &context, TableFunction
         }
     }
 
-    // Create a connection to query table schema
-    Connection conn(context.db->GetDatabase(context));
-
     // Get table schema - table name is validated above for SQL injection
-    auto schema_query = "SELECT * FROM " + result->table_name + " LIMIT 0";
-    auto schema_result = conn.Query(schema_query);
-    if (schema_result->HasError()) {
-        throw BinderException("Table '%s' does not exist: %s", result->table_name, schema_result->GetError());
+    CatalogTableInfo table;
+    string error;
+    if (!DescribeRelation(context, result->table_name, table, error)) {
+        throw BinderException("Table '%s' does not exist: %s", result->table_name, error);
     }
 
     // Parse lambda expression
@@ -135,9 +134,9 @@ static unique_ptr<FunctionData> LambdaBind(ClientContext &context, TableFunction
 
     // Build the SELECT query with transformations
     string select_parts;
-    for (idx_t i = 0; i < schema_result->names.size(); i++) {
-        string col_name = schema_result->names[i];
-        LogicalType col_type = schema_result->types[i];
+    for (idx_t i = 0; i < table.column_names.size(); i++) {
+        string col_name = table.column_names[i];
+        LogicalType col_type = table.column_types[i];
         
         bool should_transform = true;
         
@@ -186,8 +185,8 @@ static unique_ptr<GlobalTableFunctionState> LambdaInit(ClientContext &context, T
     auto &bind_data = input.bind_data->Cast<LambdaBindData>();
     
     // Execute the transformed query
-    Connection conn(context.db->GetDatabase(context));
-    result->result = conn.Query(bind_data.transformed_query);
+    auto session = SessionPool::Acquire(context);
+    result->result = session.Query(bind_data.transformed_query);
     
     if (result->result->HasError()) {
         throw InternalException("Error executing lambda transformation: %s", result->result->GetError());
@@ -38,9 +38,10 @@
 #include "blz_lut_loader.hpp"
 #include "zip_functions.hpp"
 #include "import_folder_functions.hpp"
+#include "profile_function.hpp"
 #include "mask_functions.hpp"
 #include "time_travel.hpp"
-// #include "fill_functions.hpp"  // Temporarily disabled
+#include "fill_functions.hpp"
 
 namespace duckdb {
 namespace stps {
@@ -122,13 +123,16 @@ public:
         stps::RegisterTimeTravelFunctions(loader);
         stps::RegisterTimeTravelOptimizer(loader.GetDatabaseInstance());
 
+        // Register pipeline instrumentation functions
+        stps::RegisterProfileFunctions(loader);
+
         // Register AI functions (Anthropic Claude integration)
 #ifdef HAVE_CURL
         stps::RegisterAIFunctions(loader);
 #endif
 
-        // Register fill window functions
-        // stps::RegisterFillFunctions(loader);  // Temporarily disabled
+        // Register fill aggregate/window functions
+        stps::RegisterFillFunctions(loader);
 
         // Initialize BLZ LUT loader (download if not present)
         // This will check if ~/.stps/blz.lut exists and download if needed
@@ -1,4 +1,7 @@
 #include "time_travel.hpp"
+#include "shared/profiler.hpp"
+#include "shared/session_pool.hpp"
+#include "shared/catalog_helper.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
@@ -11,6 +14,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/function/table_function.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace duckdb {
@@ -50,13 +54,16 @@ static string EscapeLiteral(const string &value) {
     return escaped;
 }
 
+// Tracked-table lookup shared by the functions below (prepared once per pooled connection)
+static const char *TT_TRACKED_QUERY = "SELECT table_name FROM \"_stps_tt_tables\" WHERE table_name = ?";
+
 //===--------------------------------------------------------------------===//
 // stps_tt_enable('table_name', 'pk_column') -> VARCHAR
 //===--------------------------------------------------------------------===//
 
 static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Vector &result) {
     auto &context = state.GetContext();
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
 
     auto &table_name_vec = args.data[0];
     auto &pk_col_vec = args.data[1];
@@ -71,35 +78,23 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
         string history_table = "_stps_history_" + table_name;
         string history_escaped = EscapeIdentifier(history_table);
 
-        // 1. Validate the table exists
+        // 1. Validate the table and PK column exist (columns are reused for the history DDL)
+        CatalogTableInfo table_info;
         {
-            auto res = conn.Query("SELECT * FROM " + table_escaped + " LIMIT 0");
-            if (res->HasError()) {
+            string error;
+            if (!DescribeRelation(context, table_escaped, table_info, error)) {
                 throw InvalidInputException("stps_tt_enable: table '%s' does not exist", table_name);
             }
-        }
-
-        // 2. Validate the PK column exists
-        {
-            auto res = conn.Query(
-                "SELECT column_name FROM information_schema.columns "
-                "WHERE table_name = " + EscapeLiteral(table_name) +
-                " AND column_name = " + EscapeLiteral(pk_column) +
-                " AND table_schema NOT IN ('information_schema', 'pg_catalog')"
-            );
-            if (res->HasError()) {
-                throw InvalidInputException("stps_tt_enable: failed to query schema for table '%s'", table_name);
-            }
-            auto chunk = res->Fetch();
-            if (!chunk || chunk->size() == 0) {
+            if (std::find(table_info.column_names.begin(), table_info.column_names.end(), pk_column) ==
+                table_info.column_names.end()) {
                 throw InvalidInputException("stps_tt_enable: column '%s' does not exist in table '%s'",
                                             pk_column, table_name);
             }
         }
 
-        // 3. Create metadata table if not exists
+        // 2. Create metadata table if not exists
         {
-            auto res = conn.Query(
+            auto res = session.Query(
                 "CREATE TABLE IF NOT EXISTS \"_stps_tt_tables\" ("
                 "table_name VARCHAR, "
                 "pk_column VARCHAR, "
@@ -112,12 +107,9 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
             }
         }
 
-        // 4. Check if the table is already tracked
+        // 3. Check if the table is already tracked
         {
-            auto res = conn.Query(
-                "SELECT table_name FROM \"_stps_tt_tables\" "
-                "WHERE table_name = " + EscapeLiteral(table_name)
-            );
+            auto res = session.Execute(TT_TRACKED_QUERY, {Value(table_name)});
             if (!res->HasError()) {
                 auto chunk = res->Fetch();
                 if (chunk && chunk->size() > 0) {
@@ -127,29 +119,11 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
             }
         }
 
-        // 5. Create history table mirroring all columns + _tt columns
-        //    Get column definitions from the original table
-        vector<string> col_names;
+        // 4. Create history table mirroring all columns + _tt columns
+        const auto &col_names = table_info.column_names;
         vector<string> col_types;
-        {
-            auto res = conn.Query(
-                "SELECT column_name, data_type FROM information_schema.columns "
-                "WHERE table_name = " + EscapeLiteral(table_name) +
-                " AND table_schema NOT IN ('information_schema', 'pg_catalog') "
-                "ORDER BY ordinal_position"
-            );
-            if (res->HasError()) {
-                throw InvalidInputException("stps_tt_enable: failed to query columns for table '%s': %s",
-                                            table_name, res->GetError());
-            }
-            while (true) {
-                auto chunk = res->Fetch();
-                if (!chunk || chunk->size() == 0) break;
-                for (idx_t row = 0; row < chunk->size(); row++) {
-                    col_names.push_back(chunk->data[0].GetValue(row).ToString());
-                    col_types.push_back(chunk->data[1].GetValue(row).ToString());
-                }
-            }
+        for (auto &type : table_info.column_types) {
+            col_types.push_back(type.ToString());
         }
 
         {
@@ -165,17 +139,17 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
             ddl << ", \"_tt_pk_value\" VARCHAR";
             ddl << ")";
 
-            auto res = conn.Query(ddl.str());
+            auto res = session.Query(ddl.str());
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_enable: failed to create history table: %s",
                                             res->GetError());
             }
         }
 
-        // 6. Create index on (_tt_pk_value, _tt_version) on the history table
+        // 5. Create index on (_tt_pk_value, _tt_version) on the history table
         {
             string idx_name = "_stps_tt_idx_" + table_name;
-            auto res = conn.Query(
+            auto res = session.Query(
                 "CREATE INDEX " + EscapeIdentifier(idx_name) +
                 " ON " + history_escaped +
                 " (\"_tt_pk_value\", \"_tt_version\")"
@@ -185,21 +159,17 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
             }
         }
 
-        // 7. Insert metadata row with current_version = 0
+        // 6. Insert metadata row with current_version = 0
         {
-            auto res = conn.Query(
-                "INSERT INTO \"_stps_tt_tables\" VALUES (" +
-                EscapeLiteral(table_name) + ", " +
-                EscapeLiteral(pk_column) + ", " +
-                "0, current_timestamp)"
-            );
+            auto res = session.Execute("INSERT INTO \"_stps_tt_tables\" VALUES (?, ?, 0, current_timestamp)",
+                                       {Value(table_name), Value(pk_column)});
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_enable: failed to insert metadata: %s",
                                             res->GetError());
             }
         }
 
-        // 8. Snapshot all existing rows as version 0 with operation INSERT
+        // 7. Snapshot all existing rows as version 0 with operation INSERT
         {
             std::ostringstream insert_sql;
             insert_sql << "INSERT INTO " << history_escaped << " SELECT ";
@@ -213,7 +183,7 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
             insert_sql << ", CAST(" << pk_escaped << " AS VARCHAR) AS \"_tt_pk_value\"";
             insert_sql << " FROM " << table_escaped;
 
-            auto res = conn.Query(insert_sql.str());
+            auto res = session.Query(insert_sql.str());
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_enable: failed to snapshot existing rows: %s",
                                             res->GetError());
@@ -232,7 +202,7 @@ static void TimeTravelEnableFunction(DataChunk &args, ExpressionState &state, Ve
 
 static void TimeTravelDisableFunction(DataChunk &args, ExpressionState &state, Vector &result) {
     auto &context = state.GetContext();
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
 
     auto &table_name_vec = args.data[0];
 
@@ -244,10 +214,7 @@ static void TimeTravelDisableFunction(DataChunk &args, ExpressionState &state, V
 
         // 1. Validate the table is currently tracked
         {
-            auto res = conn.Query(
-                "SELECT table_name FROM \"_stps_tt_tables\" "
-                "WHERE table_name = " + EscapeLiteral(table_name)
-            );
+            auto res = session.Execute(TT_TRACKED_QUERY, {Value(table_name)});
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_disable: metadata table does not exist. "
                                             "No tables are tracked for time travel.");
@@ -261,7 +228,7 @@ static void TimeTravelDisableFunction(DataChunk &args, ExpressionState &state, V
 
         // 2. Drop the history table
         {
-            auto res = conn.Query("DROP TABLE IF EXISTS " + history_escaped);
+            auto res = session.Query("DROP TABLE IF EXISTS " + history_escaped);
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_disable: failed to drop history table: %s",
                                             res->GetError());
@@ -270,9 +237,8 @@ static void TimeTravelDisableFunction(DataChunk &args, ExpressionState &state, V
 
         // 3. Delete the row from metadata table
         {
-            auto res = conn.Query(
-                "DELETE FROM \"_stps_tt_tables\" WHERE table_name = " + EscapeLiteral(table_name)
-            );
+            auto res = session.Execute("DELETE FROM \"_stps_tt_tables\" WHERE table_name = ?",
+                                       {Value(table_name)});
             if (res->HasError()) {
                 throw InvalidInputException("stps_tt_disable: failed to remove metadata: %s",
                                             res->GetError());
@@ -304,9 +270,9 @@ thread_local PendingCapture g_pending_capture;
 static bool IsTableTracked(ClientContext &context, const string &table_name, string &pk_column) {
     if (g_tt_capturing) return false;
     g_tt_capturing = true;
-    Connection conn(context.db->GetDatabase(context));
-    auto result = conn.Query(
-        "SELECT pk_column FROM \"_stps_tt_tables\" WHERE table_name = " + EscapeLiteral(table_name));
+    auto session = SessionPool::Acquire(context);
+    auto result = session.Execute("SELECT pk_column FROM \"_stps_tt_tables\" WHERE table_name = ?",
+                                  {Value(table_name)});
     g_tt_capturing = false;
     if (result->HasError() || result->RowCount() == 0) return false;
     auto chunk = result->Fetch();
@@ -316,30 +282,21 @@ static bool IsTableTracked(ClientContext &context, const string &table_name, str
 }
 
 // Get column names for a table (excluding internal columns)
-static vector<string> GetTableColumns(Connection &conn, const string &table_name) {
-    vector<string> cols;
-    auto res = conn.Query(
-        "SELECT column_name FROM information_schema.columns "
-        "WHERE table_name = " + EscapeLiteral(table_name) +
-        " AND table_schema NOT IN ('information_schema', 'pg_catalog') "
-        "ORDER BY ordinal_position");
-    if (res->HasError()) return cols;
-    while (true) {
-        auto chunk = res->Fetch();
-        if (!chunk || chunk->size() == 0) break;
-        for (idx_t r = 0; r < chunk->size(); r++) {
-            cols.push_back(chunk->data[0].GetValue(r).ToString());
-        }
+static vector<string> GetTableColumns(ClientContext &context, const string &table_name) {
+    CatalogTableInfo info;
+    if (!LookupTable(context, "", table_name, info)) {
+        return {};
     }
-    return cols;
+    return info.column_names;
 }
 
 // Flush the pending capture: snapshot current table state into history
 static void FlushPendingCapture(ClientContext &context) {
     if (!g_pending_capture.active) return;
+    ::stps::shared::ScopedTimer timer("time_travel.flush");
     g_tt_capturing = true;
 
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
     string table_name = g_pending_capture.table_name;
     string pk_column = g_pending_capture.pk_column;
     int64_t version = g_pending_capture.version;
@@ -349,7 +306,7 @@ static void FlushPendingCapture(ClientContext &context) {
     string history_table = "_stps_history_" + table_name;
     string esc_history = EscapeIdentifier(history_table);
 
-    auto col_names = GetTableColumns(conn, table_name);
+    auto col_names = GetTableColumns(context, table_name);
     if (col_names.empty()) {
         g_pending_capture.active = false;
         g_tt_capturing = false;
@@ -363,12 +320,12 @@ static void FlushPendingCapture(ClientContext &context) {
         if (c > 0) snap << ", ";
         snap << "t." << EscapeIdentifier(col_names[c]);
     }
-    snap << ", " << version
+    snap << ", ?::BIGINT"
          << ", 'SNAPSHOT'"
          << ", current_timestamp"
          << ", CAST(t." << esc_pk << " AS VARCHAR)"
          << " FROM " << esc_table << " t";
-    auto snap_result = conn.Query(snap.str());
+    auto snap_result = session.Execute(snap.str(), {Value::BIGINT(version)});
     if (snap_result->HasError()) {
         g_pending_capture.active = false;
         g_tt_capturing = false;
@@ -382,21 +339,21 @@ static void FlushPendingCapture(ClientContext &context) {
         if (c > 0) del << ", ";
         del << "h." << EscapeIdentifier(col_names[c]);
     }
-    del << ", " << version
+    del << ", ?::BIGINT"
         << ", 'DELETE'"
         << ", current_timestamp"
         << ", h.\"_tt_pk_value\""
         << " FROM ("
         << "  SELECT *, ROW_NUMBER() OVER (PARTITION BY \"_tt_pk_value\" ORDER BY \"_tt_version\" DESC) as rn"
         << "  FROM " << esc_history
-        << "  WHERE \"_tt_version\" < " << version
+        << "  WHERE \"_tt_version\" < ?::BIGINT"
         << ") h"
         << " WHERE h.rn = 1"
         << " AND h.\"_tt_operation\" != 'DELETE'"
         << " AND h.\"_tt_pk_value\" NOT IN ("
         << "  SELECT CAST(" << esc_pk << " AS VARCHAR) FROM " << esc_table
         << ")";
-    conn.Query(del.str());
+    session.Execute(del.str(), {Value::BIGINT(version), Value::BIGINT(version)});
 
     g_pending_capture.active = false;
     g_tt_capturing = false;
@@ -450,12 +407,13 @@ static void TimeTravelPreOptimize(OptimizerExtensionInput &input, unique_ptr<Log
 
         // Increment version
         g_tt_capturing = true;
-        Connection conn(input.context.db->GetDatabase(input.context));
-        conn.Query("UPDATE \"_stps_tt_tables\" SET current_version = current_version + 1 "
-                   "WHERE table_name = " + EscapeLiteral(table_name));
+        auto session = SessionPool::Acquire(input.context);
+        session.Execute("UPDATE \"_stps_tt_tables\" SET current_version = current_version + 1 "
+                        "WHERE table_name = ?",
+                        {Value(table_name)});
 
-        auto ver_result = conn.Query(
-            "SELECT current_version FROM \"_stps_tt_tables\" WHERE table_name = " + EscapeLiteral(table_name));
+        auto ver_result = session.Execute("SELECT current_version FROM \"_stps_tt_tables\" WHERE table_name = ?",
+                                          {Value(table_name)});
         auto ver_chunk = ver_result->Fetch();
         int64_t new_version = ver_chunk->data[0].GetValue(0).GetValue<int64_t>();
         g_tt_capturing = false;
@@ -528,13 +486,11 @@ static unique_ptr<FunctionData> TimeTravelBind(ClientContext &context, TableFunc
         throw BinderException("stps_time_travel requires either 'version' or 'as_of' parameter");
     }
 
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
 
     // Validate table is tracked
     {
-        auto res = conn.Query(
-            "SELECT table_name FROM \"_stps_tt_tables\" WHERE table_name = " +
-            EscapeLiteral(bind_data->table_name));
+        auto res = session.Execute(TT_TRACKED_QUERY, {Value(bind_data->table_name)});
         if (res->HasError()) {
             throw BinderException("stps_time_travel: metadata table does not exist. No tables are tracked.");
         }
@@ -547,13 +503,14 @@ static unique_ptr<FunctionData> TimeTravelBind(ClientContext &context, TableFunc
 
     // Get original column names and types from the actual table
     {
-        auto type_res = conn.Query("SELECT * FROM " + EscapeIdentifier(bind_data->table_name) + " LIMIT 0");
-        if (type_res->HasError()) {
+        CatalogTableInfo info;
+        string error;
+        if (!DescribeRelation(context, EscapeIdentifier(bind_data->table_name), info, error)) {
             throw BinderException("stps_time_travel: failed to query table '%s': %s",
-                                  bind_data->table_name, type_res->GetError());
+                                  bind_data->table_name, error);
         }
-        bind_data->column_names = type_res->names;
-        bind_data->column_types = type_res->types;
+        bind_data->column_names = std::move(info.column_names);
+        bind_data->column_types = std::move(info.column_types);
     }
 
     for (idx_t i = 0; i < bind_data->column_names.size(); i++) {
@@ -595,8 +552,8 @@ static unique_ptr<GlobalTableFunctionState> TimeTravelInit(ClientContext &contex
         << " FROM latest_per_pk"
         << " WHERE rn = 1 AND \"_tt_operation\" != 'DELETE'";
 
-    Connection conn(context.db->GetDatabase(context));
-    gstate->result = conn.Query(sql.str());
+    auto session = SessionPool::Acquire(context);
+    gstate->result = session.Query(sql.str());
     if (gstate->result->HasError()) {
         throw InternalException("stps_time_travel: query failed: %s", gstate->result->GetError());
     }
@@ -643,13 +600,11 @@ static unique_ptr<FunctionData> TTLogBind(ClientContext &context, TableFunctionB
     auto bind_data = make_uniq<TTLogBindData>();
     bind_data->table_name = input.inputs[0].GetValue<string>();
 
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
 
     // Validate table is tracked
     {
-        auto res = conn.Query(
-            "SELECT table_name FROM \"_stps_tt_tables\" WHERE table_name = " +
-            EscapeLiteral(bind_data->table_name));
+        auto res = session.Execute(TT_TRACKED_QUERY, {Value(bind_data->table_name)});
         if (res->HasError()) {
             throw BinderException("stps_tt_log: metadata table does not exist.");
         }
@@ -663,12 +618,13 @@ static unique_ptr<FunctionData> TTLogBind(ClientContext &context, TableFunctionB
     // Get ALL columns from history table (including _tt_* columns)
     string history_table = "_stps_history_" + bind_data->table_name;
     {
-        auto type_res = conn.Query("SELECT * FROM " + EscapeIdentifier(history_table) + " LIMIT 0");
-        if (type_res->HasError()) {
-            throw BinderException("stps_tt_log: failed to query history table: %s", type_res->GetError());
+        CatalogTableInfo info;
+        string error;
+        if (!DescribeRelation(context, EscapeIdentifier(history_table), info, error)) {
+            throw BinderException("stps_tt_log: failed to query history table: %s", error);
         }
-        bind_data->column_names = type_res->names;
-        bind_data->column_types = type_res->types;
+        bind_data->column_names = std::move(info.column_names);
+        bind_data->column_types = std::move(info.column_types);
     }
 
     for (idx_t i = 0; i < bind_data->column_names.size(); i++) {
@@ -743,8 +699,8 @@ static unique_ptr<GlobalTableFunctionState> TTLogInit(ClientContext &context, Ta
         << " FROM history"
         << " ORDER BY \"_tt_version\", \"_tt_pk_value\"";
 
-    Connection conn(context.db->GetDatabase(context));
-    gstate->result = conn.Query(sql.str());
+    auto session = SessionPool::Acquire(context);
+    gstate->result = session.Query(sql.str());
     if (gstate->result->HasError()) {
         throw InternalException("stps_tt_log: query failed: %s", gstate->result->GetError());
     }
@@ -802,13 +758,11 @@ static unique_ptr<FunctionData> TTDiffBind(ClientContext &context, TableFunction
     bind_data->from_version = from_it->second.GetValue<int64_t>();
     bind_data->to_version = to_it->second.GetValue<int64_t>();
 
-    Connection conn(context.db->GetDatabase(context));
+    auto session = SessionPool::Acquire(context);
 
     // Validate table is tracked
     {
-        auto res = conn.Query(
-            "SELECT table_name FROM \"_stps_tt_tables\" WHERE table_name = " +
-            EscapeLiteral(bind_data->table_name));
+        auto res = session.Execute(TT_TRACKED_QUERY, {Value(bind_data->table_name)});
         if (res->HasError()) {
             throw BinderException("stps_tt_diff: metadata table does not exist.");
         }
@@ -821,13 +775,14 @@ static unique_ptr<FunctionData> TTDiffBind(ClientContext &context, TableFunction
 
     // Get original column names and types
     {
-        auto type_res = conn.Query("SELECT * FROM " + EscapeIdentifier(bind_data->table_name) + " LIMIT 0");
-        if (type_res->HasError()) {
+        CatalogTableInfo info;
+        string error;
+        if (!DescribeRelation(context, EscapeIdentifier(bind_data->table_name), info, error)) {
             throw BinderException("stps_tt_diff: failed to query table '%s': %s",
-                                  bind_data->table_name, type_res->GetError());
+                                  bind_data->table_name, error);
         }
-        bind_data->column_names = type_res->names;
-        bind_data->column_types = type_res->types;
+        bind_data->column_names = std::move(info.column_names);
+        bind_data->column_types = std::move(info.column_types);
     }
 
     // Return original columns + _tt_change_type + _tt_changes
@@ -904,8 +859,8 @@ static unique_ptr<GlobalTableFunctionState> TTDiffInit(ClientContext &context, T
         << " SELECT " << cols_f.str() << ", 'DELETE' as \"_tt_change_type\", NULL as \"_tt_changes\""
         << " FROM f WHERE f.\"_tt_pk_value\" NOT IN (SELECT \"_tt_pk_value\" FROM t)";
 
-    Connection conn(context.db->GetDatabase(context));
-    gstate->result = conn.Query(sql.str());
+    auto session = SessionPool::Acquire(context);
+    gstate->result = session.Query(sql.str());
     if (gstate->result->HasError()) {
         throw InternalException("stps_tt_diff: query failed: %s", gstate->result->GetError());
     }
@@ -966,8 +921,8 @@ static unique_ptr<FunctionData> TTStatusBind(ClientContext &context, TableFuncti
 static unique_ptr<GlobalTableFunctionState> TTStatusInit(ClientContext &context, TableFunctionInitInput &input) {
     auto gstate = make_uniq<TTStatusGlobalState>();
 
-    Connection conn(context.db->GetDatabase(context));
-    gstate->result = conn.Query("SELECT * FROM \"_stps_tt_tables\" ORDER BY table_name");
+    auto session = SessionPool::Acquire(context);
+    gstate->result = session.Query("SELECT * FROM \"_stps_tt_tables\" ORDER BY table_name");
     if (gstate->result->HasError()) {
         throw InternalException("stps_tt_status: query failed: %s", gstate->result->GetError());
     }
@@ -1,5 +1,6 @@
 #include "zip_functions.hpp"
 #include "shared/archive_utils.hpp"
+#include "shared/csv_sniffer.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -121,11 +122,17 @@ struct ZipBindData : public TableFunctionData {
     string zip_path;
     string inner_filename;
     bool auto_detect_file = true;
+    // Columns are VARCHAR unless types are sniffed on request
+    bool detect_types = false;
+    // Sniffed from a bounded prefix at bind time; the body is streamed with it
+    CsvSchema schema;
 };
 
 struct ZipGlobalState : public GlobalTableFunctionState {
-    unique_ptr<char[]> file_content;
-    size_t file_size = 0;
+    // Text mode: extracted content streamed through the bound schema
+    string content;
+    unique_ptr<CsvBodyReader> reader;
+    // Binary mode: a single row describing the extracted file
     std::vector<string> column_names;
     std::vector<LogicalType> column_types;
     std::vector<std::vector<Value>> rows;
@@ -149,6 +156,11 @@ static unique_ptr<FunctionData> ZipBind(ClientContext &context, TableFunctionBin
         result->inner_filename = input.inputs[1].GetValue<string>();
         result->auto_detect_file = false;
     }
+    for (auto &kv : input.named_parameters) {
+        if (kv.first == "detect_types") {
+            result->detect_types = kv.second.GetValue<bool>();
+        }
+    }
     
     // We need to actually read the file at bind time to determine the schema
     mz_zip_archive zip_archive;
@@ -230,26 +242,18 @@ static unique_ptr<FunctionData> ZipBind(ClientContext &context, TableFunctionBin
         return result;
     }
 
-    // Parse to determine schema for CSV/text files
-    std::vector<string> column_names;
-    std::vector<LogicalType> column_types;
-    std::vector<std::vector<Value>> temp_rows;
-    
-    ParseCSVContent(content, column_names, column_types, temp_rows);
-    
-    if (column_names.empty()) {
+    // Sniff the schema for CSV/text files from a bounded prefix
+    CsvSniffOptions sniff_options;
+    sniff_options.all_varchar = !result->detect_types;
+    result->schema = SniffCSV(content, sniff_options);
+
+    if (result->schema.Empty()) {
         // If parsing failed, return raw content
         names = {"content"};
         return_types = {LogicalType::VARCHAR};
     } else {
-        names.clear();
-        return_types.clear();
-        for (const auto &name : column_names) {
-            names.push_back(name);
-        }
-        for (const auto &type : column_types) {
-            return_types.push_back(type);
-        }
+        names = result->schema.ColumnNames();
+        return_types = result->schema.ColumnTypes();
     }
     
     return result;
@@ -336,12 +340,14 @@ static unique_ptr<GlobalTableFunctionState> ZipInit(ClientContext &context, Tabl
         return result;
     }
     
-    string content(static_cast<char*>(file_data), file_size);
+    result->content.assign(static_cast<char*>(file_data), file_size);
     mz_free(file_data);
     mz_zip_reader_end(&zip_archive);
     
-    // Parse CSV content
-    ParseCSVContent(content, result->column_names, result->column_types, result->rows);
+    // Rows are converted chunk by chunk during the scan
+    if (!bind_data.schema.Empty()) {
+        result->reader = make_uniq<CsvBodyReader>(result->content, bind_data.schema);
+    }
     result->parsed = true;
     
     return result;
@@ -354,6 +360,11 @@ static void ZipScan(ClientContext &context, TableFunctionInput &data_p, DataChun
     if (!state.error_message.empty()) {
         throw IOException(state.error_message);
     }
+
+    if (state.reader) {
+        state.reader->Read(output);
+        return;
+    }
     
     idx_t count = 0;
     idx_t max_count = STANDARD_VECTOR_SIZE;
@@ -383,9 +394,11 @@ void RegisterZipFunctions(ExtensionLoader &loader) {
     
     // Register stps_zip table function (with optional second argument)
     TableFunction zip_func1("stps_zip", {LogicalType::VARCHAR}, ZipScan, ZipBind, ZipInit);
+    zip_func1.named_parameters["detect_types"] = LogicalType::BOOLEAN;
     loader.RegisterFunction(zip_func1);
     
     TableFunction zip_func2("stps_zip", {LogicalType::VARCHAR, LogicalType::VARCHAR}, ZipScan, ZipBind, ZipInit);
+    zip_func2.named_parameters["detect_types"] = LogicalType::BOOLEAN;
     loader.RegisterFunction(zip_func2);
 }
 